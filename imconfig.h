@@ -48,7 +48,8 @@
 //#define IMGUI_DISABLE_FILE_FUNCTIONS                      // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle at all (replace them with dummies)
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
-//#define IMGUI_DISABLE_DEFAULT_FONT                        // Disable default embedded font (ProggyClean.ttf), remove ~9.5 KB from output binary. AddFontDefault() will assert.
+//#define IMGUI_DISABLE_DEFAULT_FONT                        // Disable default embedded font (ProggyClean.ttf), remove ~7.5 KB from output binary. AddFontDefault() will assert.
+//#define IMGUI_ENABLE_PREBAKED_DEFAULT_FONT                // Embed glyphs of the default font prerasterized at size 13 (~3 KB), so the first frame doesn't need to rasterize them with stb_truetype. See ImFontConfig::PrebakedData.
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
 
 //---- Enable Test Engine / Automation features.
@@ -136,6 +137,14 @@
 //---- Debug Tools: Enable slower asserts
 //#define IMGUI_DEBUG_PARANOID
 
+//---- Debug Tools: Track memory allocations per subsystem (draw lists, text, tables, fonts, storage...): live bytes, peak and allocations per frame.
+// (Adds a 16 bytes header to every allocation. Displayed in 'Metrics->Memory allocations', can be exported as JSON)
+//#define IMGUI_ENABLE_DEBUG_ALLOC_TAGS
+
+//---- Debug Tools: Enable CPU profiler: record time spent in main dear imgui functions and in your own scopes (ImGui::ProfileScope) over the last frames.
+// (Displayed as a timeline in 'Metrics->Profiler', can be exported to Chrome trace format for chrome://tracing or https://ui.perfetto.dev)
+//#define IMGUI_ENABLE_PROFILER
+
 //---- Tip: You can add extra functions within the ImGui:: namespace from anywhere (e.g. your own sources/header files)
 /*
 namespace ImGui
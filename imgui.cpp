@@ -1171,6 +1171,7 @@ IMPLEMENTING SUPPORT for ImGuiBackendFlags_RendererHasTextures:
 // The UWP and GDK Win32 API subsets don't support clipboard nor IME functions
 #define IMGUI_DISABLE_WIN32_DEFAULT_CLIPBOARD_FUNCTIONS
 #define IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS
+#define IMGUI_DISABLE_WIN32_DEFAULT_FILE_MAPPING
 #define IMGUI_DISABLE_DEFAULT_SHELL_FUNCTIONS
 #endif
 #endif
@@ -1255,7 +1256,8 @@ static void             SetCurrentWindow(ImGuiWindow* window);
 static ImGuiWindow*     CreateNewWindow(const char* name, ImGuiWindowFlags flags);
 static ImVec2           CalcNextScrollFromScrollTargetAndClamp(ImGuiWindow* window);
 
-static void             AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window);
+static void             QueueWindowDisplayOrderRelink(ImGuiWindow* window);
+static ImGuiWindow*     RelinkChildWindowsInDisplayOrder(ImGuiWindow* window, ImGuiWindow* prev);
 
 // Settings
 static void             WindowSettingsHandler_ClearAll(ImGuiContext*, ImGuiSettingsHandler*);
@@ -1276,7 +1278,6 @@ namespace ImGui
 static void             ItemHandleShortcut(ImGuiID id);
 
 // Window Focus
-static int              FindWindowFocusIndex(ImGuiWindow* window);
 static void             UpdateWindowInFocusOrderList(ImGuiWindow* window, bool just_created, ImGuiWindowFlags new_flags);
 
 // Navigation
@@ -1321,6 +1322,9 @@ static void             UpdateFontsNewFrame();
 static void             UpdateFontsEndFrame();
 static void             UpdateTexturesNewFrame();
 static void             UpdateTexturesEndFrame();
+static void             UpdateWindowsDisplayOrderEndFrame();
+static void             UpdateWindowsFromDisplayOrder();
+static void             UpdateWindowsHitGridEndFrame();
 static void             UpdateSettings();
 static int              UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_hovered, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
@@ -1379,6 +1383,15 @@ static ImGuiMemAllocFunc    GImAllocatorAllocFunc = MallocWrapper;
 static ImGuiMemFreeFunc     GImAllocatorFreeFunc = FreeWrapper;
 static void*                GImAllocatorUserData = NULL;
 
+// Allocation tags (see IMGUI_ENABLE_DEBUG_ALLOC_TAGS in imconfig.h)
+// - Stats are shared by all contexts, as allocations may outlive them. Like other IM_ALLOC() debug hooks they are not thread-safe.
+#ifdef IMGUI_ENABLE_DEBUG_ALLOC_TAGS
+#define IM_ALLOC_TAG_HEADER_SIZE    16      // Preserve alignment of allocations returned by the allocator
+struct ImGuiAllocTagHeader { size_t Size; ImGuiAllocTag Tag; };
+static thread_local ImGuiAllocTag   GImAllocTag = ImGuiAllocTag_Misc;
+static ImGuiAllocTagStats           GImAllocTagStats[ImGuiAllocTag_COUNT];
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] USER FACING STRUCTURES (ImGuiStyle, ImGuiIO, ImGuiPlatformIO)
 //-----------------------------------------------------------------------------
@@ -1550,11 +1563,13 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsCopyContentsWithCtrlC = false;
     ConfigScrollbarScrollByPage = true;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigMemoryCompactBudget = 0;
     ConfigDebugIsDebuggerPresent = false;
     ConfigDebugHighlightIdConflicts = true;
     ConfigDebugHighlightIdConflictsShowItemPicker = true;
     ConfigDebugBeginReturnValueOnce = false;
     ConfigDebugBeginReturnValueLoop = false;
+    ConfigDebugWindowsCosts = false;
 
     ConfigErrorRecovery = true;
     ConfigErrorRecoveryEnableAssert = true;
@@ -2478,6 +2493,189 @@ void*   ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_f
     return file_data;
 }
 
+// Helper: Map file content into memory, read-only
+// - Mappings are shared and reference counted by file identity (device/inode or volume/file index, size and modification time):
+//   mapping a same file multiple times (e.g. same font used by multiple atlases or contexts) doesn't use more memory, whichever path is used to open it.
+//   A file replaced or modified on disk between two calls gets a new mapping.
+// - Release with ImFileUnmap(). Return NULL if mapping is not supported, in which case you may use ImFileLoadToMemory().
+// - Pages are loaded by the OS on access and don't count toward heap usage. Modifying or truncating the file while mapped is undefined behavior
+//   (on POSIX systems, accessing pages past the new end of a truncated file raises SIGBUS). This is why ImFontAtlas only maps files with ImFontAtlasFlags_FileMapping.
+// - Thread-safe: the table of mappings is shared by all contexts and protected by a lock.
+struct ImFileMapKey
+{
+    ImU64   Device;     // st_dev / dwVolumeSerialNumber
+    ImU64   Index;      // st_ino / nFileIndexHigh:nFileIndexLow
+    ImU64   Size;
+    ImU64   ModTime;    // st_mtime / ftLastWriteTime
+};
+
+#if !defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS) && defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_FILE_MAPPING)
+typedef HANDLE ImFileMapHandle;
+static bool ImFileMapPlatformOpen(const char* filename, ImFileMapHandle* out_handle, ImFileMapKey* out_key)
+{
+    const int filename_wsize = ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, NULL, 0);
+    ImVector<wchar_t> filename_wbuf;
+    filename_wbuf.resize(filename_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, filename_wbuf.Data, filename_wsize);
+    HANDLE file = ::CreateFileW(filename_wbuf.Data, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    BY_HANDLE_FILE_INFORMATION info;
+    if (!::GetFileInformationByHandle(file, &info))
+    {
+        ::CloseHandle(file);
+        return false;
+    }
+    out_key->Device = info.dwVolumeSerialNumber;
+    out_key->Index = ((ImU64)info.nFileIndexHigh << 32) | info.nFileIndexLow;
+    out_key->Size = ((ImU64)info.nFileSizeHigh << 32) | info.nFileSizeLow;
+    out_key->ModTime = ((ImU64)info.ftLastWriteTime.dwHighDateTime << 32) | info.ftLastWriteTime.dwLowDateTime;
+    *out_handle = file;
+    return true;
+}
+static void* ImFileMapPlatformMap(ImFileMapHandle file, size_t)
+{
+    HANDLE mapping = ::CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL)
+        return NULL;
+    void* data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    ::CloseHandle(mapping); // The view keeps the mapping alive
+    return data;
+}
+static void ImFileMapPlatformClose(ImFileMapHandle file) { ::CloseHandle(file); }
+static void ImFileUnmapPlatform(void* data, size_t) { ::UnmapViewOfFile(data); }
+static volatile LONG GImFileMapLock = 0; // Spin lock: calls are rare and short, and a CRITICAL_SECTION would need initialization.
+static void ImFileMapPlatformLock() { while (::InterlockedCompareExchange(&GImFileMapLock, 1, 0) != 0) ::Sleep(0); }
+static void ImFileMapPlatformUnlock() { ::InterlockedExchange(&GImFileMapLock, 0); }
+#elif !defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS) && (defined(__unix__) || defined(__APPLE__))
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+typedef int ImFileMapHandle;
+static bool ImFileMapPlatformOpen(const char* filename, ImFileMapHandle* out_handle, ImFileMapKey* out_key)
+{
+    int fd = open(filename, O_RDONLY);
+    if (fd == -1)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+    {
+        close(fd);
+        return false;
+    }
+    out_key->Device = (ImU64)st.st_dev;
+    out_key->Index = (ImU64)st.st_ino;
+    out_key->Size = (ImU64)st.st_size;
+    out_key->ModTime = (ImU64)st.st_mtime;
+    *out_handle = fd;
+    return true;
+}
+static void* ImFileMapPlatformMap(ImFileMapHandle fd, size_t size)
+{
+    void* data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    return (data == MAP_FAILED) ? NULL : data;
+}
+static void ImFileMapPlatformClose(ImFileMapHandle fd) { close(fd); } // Mappings stay valid
+static void ImFileUnmapPlatform(void* data, size_t size) { munmap(data, size); }
+static pthread_mutex_t GImFileMapMutex = PTHREAD_MUTEX_INITIALIZER;
+static void ImFileMapPlatformLock() { pthread_mutex_lock(&GImFileMapMutex); }
+static void ImFileMapPlatformUnlock() { pthread_mutex_unlock(&GImFileMapMutex); }
+#else
+typedef int ImFileMapHandle;
+static bool ImFileMapPlatformOpen(const char*, ImFileMapHandle*, ImFileMapKey*) { return false; }
+static void* ImFileMapPlatformMap(ImFileMapHandle, size_t) { return NULL; }
+static void ImFileMapPlatformClose(ImFileMapHandle) {}
+static void ImFileUnmapPlatform(void*, size_t) {}
+static void ImFileMapPlatformLock() {}
+static void ImFileMapPlatformUnlock() {}
+#endif
+
+struct ImFileMapping
+{
+    ImFileMapKey    Key;
+    void*           Data;
+    size_t          Size;
+    int             RefCount;
+};
+static ImVector<ImFileMapping> GImFileMappings; // Shared by all contexts, sorted by Data. Protected by ImFileMapPlatformLock().
+
+// Find mapping of 'data', or where to insert it
+static ImFileMapping* ImFileMappingsLowerBound(const void* data)
+{
+    ImFileMapping* in_p = GImFileMappings.begin();
+    for (size_t count = (size_t)GImFileMappings.Size; count > 0; )
+    {
+        size_t count2 = count >> 1;
+        ImFileMapping* mid = in_p + count2;
+        if ((uintptr_t)mid->Data < (uintptr_t)data)
+        {
+            in_p = ++mid;
+            count -= count2 + 1;
+        }
+        else
+        {
+            count = count2;
+        }
+    }
+    return in_p;
+}
+
+const void* ImFileMap(const char* filename, size_t* out_file_size)
+{
+    IM_ASSERT(filename != NULL && out_file_size != NULL);
+    *out_file_size = 0;
+    ImFileMapHandle handle = {};
+    ImFileMapKey key;
+    memset(&key, 0, sizeof(key));
+    if (!ImFileMapPlatformOpen(filename, &handle, &key))
+        return NULL;
+
+    // Share existing mapping of same file (few files are mapped at the same time)
+    ImFileMapPlatformLock();
+    for (ImFileMapping& mapping : GImFileMappings)
+        if (memcmp(&mapping.Key, &key, sizeof(key)) == 0)
+        {
+            mapping.RefCount++;
+            *out_file_size = mapping.Size;
+            const void* data = mapping.Data;
+            ImFileMapPlatformUnlock();
+            ImFileMapPlatformClose(handle);
+            return data;
+        }
+
+    // Map while holding the lock, so concurrent calls for a same file share the mapping
+    void* data = NULL;
+    if (key.Size > 0 && key.Size <= (ImU64)(size_t)-1)
+        data = ImFileMapPlatformMap(handle, (size_t)key.Size);
+    if (data != NULL)
+    {
+        ImFileMapping mapping = { key, data, (size_t)key.Size, 1 };
+        GImFileMappings.insert(ImFileMappingsLowerBound(data), mapping);
+        *out_file_size = mapping.Size;
+    }
+    ImFileMapPlatformUnlock();
+    ImFileMapPlatformClose(handle);
+    return data;
+}
+
+bool ImFileUnmap(const void* data)
+{
+    ImFileMapPlatformLock();
+    ImFileMapping* mapping = ImFileMappingsLowerBound(data);
+    const bool found = (mapping != GImFileMappings.end() && mapping->Data == data);
+    if (found && --mapping->RefCount == 0)
+    {
+        ImFileUnmapPlatform(mapping->Data, mapping->Size);
+        GImFileMappings.erase(mapping);
+        if (GImFileMappings.Size == 0)
+            GImFileMappings.clear(); // Don't leave an allocation behind at shutdown
+    }
+    ImFileMapPlatformUnlock();
+    return found;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 //-----------------------------------------------------------------------------
@@ -2841,6 +3039,7 @@ void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Storage);
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
@@ -2854,6 +3053,7 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Storage);
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
@@ -2862,6 +3062,7 @@ float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Storage);
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
@@ -2871,6 +3072,7 @@ void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 // FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Storage);
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         Data.insert(it, ImGuiStoragePair(key, val));
@@ -2885,6 +3087,7 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Storage);
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         Data.insert(it, ImGuiStoragePair(key, val));
@@ -2894,6 +3097,7 @@ void ImGuiStorage::SetFloat(ImGuiID key, float val)
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Storage);
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         Data.insert(it, ImGuiStoragePair(key, val));
@@ -3023,6 +3227,7 @@ char ImGuiTextBuffer::EmptyString[1] = { 0 };
 
 void ImGuiTextBuffer::append(const char* str, const char* str_end)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Text);
     int len = str_end ? (int)(str_end - str) : (int)ImStrlen(str);
 
     // Add zero-terminator the first time
@@ -3050,6 +3255,7 @@ void ImGuiTextBuffer::appendf(const char* fmt, ...)
 // Helper: Text buffer for logging/accumulating text
 void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Text);
     va_list args_copy;
     va_copy(args_copy, args);
 
@@ -3076,6 +3282,7 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
 
 void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Text);
     IM_ASSERT(old_size >= 0 && new_size >= old_size && new_size >= EndOffset);
     if (old_size == new_size)
         return;
@@ -3088,6 +3295,67 @@ void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
     EndOffset = ImMax(EndOffset, new_size);
 }
 
+void* ImFrameArena::Alloc(size_t size, size_t align)
+{
+    int offset = (int)IM_MEMALIGN((size_t)CurrentOffset, align);
+    if (Blocks.Size == 0 || offset + (int)size > Blocks.back().Size)
+    {
+        // Overflow: continue in a new block. Reset() will merge blocks.
+        if (Blocks.Size > 0)
+            OverflowCount++;
+        const int block_size = ImMax((Blocks.Size == 0) ? BlockSize : IM_FRAME_ARENA_BLOCK_SIZE, (int)IM_MEMALIGN(size, (size_t)IM_FRAME_ARENA_BLOCK_SIZE));
+        ImFrameArenaBlock block = { (char*)IM_ALLOC((size_t)block_size), block_size };
+        Blocks.push_back(block);
+        offset = CurrentOffset = 0;
+    }
+    UsedBytes += offset - CurrentOffset + (int)size;
+    CurrentOffset = offset + (int)size;
+    return Blocks.back().Data + offset;
+}
+
+void ImFrameArena::Reset()
+{
+    PeakUsedBytes = ImMax(PeakUsedBytes, UsedBytes);
+    RecentPeakUsedBytes = ImMax(RecentPeakUsedBytes, UsedBytes);
+    if (Blocks.Size > 1)
+    {
+        // Merge blocks into one sized for this frame, allocated on next use
+        for (ImFrameArenaBlock& block : Blocks)
+            IM_FREE(block.Data);
+        Blocks.resize(0);
+        BlockSize = (int)IM_MEMALIGN((size_t)UsedBytes, (size_t)IM_FRAME_ARENA_BLOCK_SIZE);
+        RecentFrames = 0;
+    }
+    else if (++RecentFrames >= IM_FRAME_ARENA_SHRINK_FRAMES)
+    {
+        // Shrink block when recent frames used less than half of it, allocated on next use
+        const int current_size = (Blocks.Size == 1) ? Blocks[0].Size : BlockSize;
+        const int shrunk_size = ImMax((int)IM_MEMALIGN((size_t)RecentPeakUsedBytes, (size_t)IM_FRAME_ARENA_BLOCK_SIZE), IM_FRAME_ARENA_BLOCK_SIZE);
+        if (shrunk_size * 2 <= current_size)
+        {
+            for (ImFrameArenaBlock& block : Blocks)
+                IM_FREE(block.Data);
+            Blocks.resize(0);
+            BlockSize = shrunk_size;
+        }
+        RecentPeakUsedBytes = RecentFrames = 0;
+    }
+#ifdef IMGUI_DEBUG_PARANOID
+    if (Blocks.Size == 1)
+        memset(Blocks[0].Data, 0xDD, (size_t)CurrentOffset);
+#endif
+    CurrentOffset = UsedBytes = 0;
+}
+
+void ImFrameArena::ClearFreeMemory()
+{
+    for (ImFrameArenaBlock& block : Blocks)
+        IM_FREE(block.Data);
+    Blocks.clear();
+    BlockSize = IM_FRAME_ARENA_BLOCK_SIZE;
+    CurrentOffset = UsedBytes = RecentPeakUsedBytes = RecentFrames = 0;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiListClipper
 //-----------------------------------------------------------------------------
@@ -3710,6 +3978,17 @@ const char* ImGui::FindRenderedTextEnd(const char* text, const char* text_end)
     return text_display_end;
 }
 
+// Attribute text measured or rendered to window->Cost (see Metrics->Windows costs)
+static inline void DebugWindowCostAddTextBytes(ImGuiContext& g, const char* text, const char* text_end)
+{
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    if (g.DebugWindowsCostsEnabled && g.CurrentWindow != NULL && text_end != NULL)
+        g.CurrentWindow->Cost.TextBytes += (int)(text_end - text);
+#else
+    IM_UNUSED(g); IM_UNUSED(text); IM_UNUSED(text_end);
+#endif
+}
+
 // Internal ImGui functions to render text
 // RenderText***() functions calls ImDrawList::AddText() calls ImBitmapFont::RenderText()
 void ImGui::RenderText(ImVec2 pos, const char* text, const char* text_end, bool hide_text_after_hash)
@@ -3733,6 +4012,7 @@ void ImGui::RenderText(ImVec2 pos, const char* text, const char* text_end, bool
     if (text != text_display_end)
     {
         window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_display_end);
+        DebugWindowCostAddTextBytes(g, text, text_display_end);
         if (g.LogEnabled)
             LogRenderedText(&pos, text, text_display_end);
     }
@@ -3749,6 +4029,7 @@ void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end
     if (text != text_end)
     {
         window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_end, wrap_width);
+        DebugWindowCostAddTextBytes(g, text, text_end);
         if (g.LogEnabled)
             LogRenderedText(&pos, text, text_end);
     }
@@ -3785,6 +4066,7 @@ void ImGui::RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, co
     {
         draw_list->AddText(NULL, 0.0f, pos, GetColorU32(ImGuiCol_Text), text, text_display_end, 0.0f, NULL);
     }
+    DebugWindowCostAddTextBytes(*GImGui, text, text_display_end);
 }
 
 void ImGui::RenderTextClipped(const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_end, const ImVec2* text_size_if_known, const ImVec2& align, const ImRect* clip_rect)
@@ -4041,6 +4323,7 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     WithinEndChildID = 0;
     WithinFrameScope = WithinFrameScopeWithImplicitWindow = false;
     GcCompactAll = false;
+    GcTransientMemoryCompactedCount = 0;
     TestEngineHookItems = false;
     TestEngine = NULL;
     memset(ContextName, 0, sizeof(ContextName));
@@ -4050,6 +4333,9 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
 
     WindowsActiveCount = 0;
     WindowsBorderHoverPadding = 0.0f;
+    WindowsDisplayOrderChanged = false;
+    WindowsPoolRecycledCount = WindowsPoolReusedCount = 0;
+    WindowsTransientUnusedLimit = IMGUI_WINDOWS_TRANSIENT_UNUSED_MAX;
     CurrentWindow = NULL;
     HoveredWindow = NULL;
     HoveredWindowUnderMovingWindow = NULL;
@@ -4227,6 +4513,8 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     DebugLocateFrames = 0;
     DebugBeginReturnValueCullDepth = -1;
     DebugItemPickerActive = false;
+    DebugWindowsCostsEnabled = false;
+    DebugWindowsCostsRequestFrame = -1;
     DebugItemPickerMouseButton = ImGuiMouseButton_Left;
     DebugItemPickerBreakId = 0;
     DebugFlashStyleColorTime = 0.0f;
@@ -4337,8 +4625,20 @@ void ImGui::Shutdown()
 
     // Clear everything else
     g.Windows.clear_delete();
-    g.WindowsFocusOrder.clear();
+    g.WindowsPool.clear_delete();
+    g.FrameArena.ClearFreeMemory();
+#ifdef IMGUI_ENABLE_PROFILER
+    for (ImGuiProfilerFrame& frame : g.Profiler.Frames)
+        frame.Events.clear();
+    g.Profiler.Stack.clear();
+    g.Profiler.FramesCount = 0;
+    g.Profiler.Recording = false;
+#endif
+    g.WindowsDisplayOrder.Clear();
+    g.WindowsFocusOrder.Clear();
+    g.WindowsDisplayOrderRelink.clear();
     g.WindowsTempSortBuffer.clear();
+    g.WindowsHitGrid.Clear();
     g.CurrentWindow = NULL;
     g.CurrentWindowStack.clear();
     g.WindowsById.Clear();
@@ -4449,6 +4749,7 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* ctx, const char* name) : DrawListInst(NUL
     FontRefSize = 0.0f;
     FontWindowScale = FontWindowScaleParents = 1.0f;
     SettingsOffset = -1;
+    DisplayOrderIdx = FocusOrderIdx = -1;
     DrawList = &DrawListInst;
     DrawList->_OwnerName = Name;
     DrawList->_SetDrawListSharedData(&Ctx->DrawListSharedData);
@@ -4494,6 +4795,7 @@ void ImGui::GcCompactTransientMiscBuffers()
     TableGcCompactSettings();
     for (ImFontAtlas* atlas : g.FontAtlases)
         atlas->CompactCache();
+    g.FrameArena.ClearFreeMemory();
 }
 
 // Free up/compact internal window buffers, we can use this when a window becomes unused.
@@ -4522,6 +4824,300 @@ void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
     window->MemoryDrawListIdxCapacity = window->MemoryDrawListVtxCapacity = 0;
 }
 
+static int CalcDrawListSplitterMemory(const ImDrawListSplitter* splitter)
+{
+    int bytes = splitter->_Channels.Capacity * (int)sizeof(ImDrawChannel);
+    for (const ImDrawChannel& channel : splitter->_Channels)
+        bytes += channel._CmdBuffer.Capacity * (int)sizeof(ImDrawCmd) + channel._IdxBuffer.Capacity * (int)sizeof(ImDrawIdx);
+    return bytes;
+}
+
+// Buffers freed by GcCompactTransientWindowBuffers()
+static int CalcWindowTransientMemory(const ImGuiWindow* window)
+{
+    const ImDrawList* draw_list = window->DrawList;
+    int bytes = draw_list->CmdBuffer.Capacity * (int)sizeof(ImDrawCmd) + draw_list->IdxBuffer.Capacity * (int)sizeof(ImDrawIdx) + draw_list->VtxBuffer.Capacity * (int)sizeof(ImDrawVert);
+    bytes += draw_list->_Path.Capacity * (int)sizeof(ImVec2) + draw_list->_ClipRectStack.Capacity * (int)sizeof(ImVec4) + draw_list->_TextureStack.Capacity * (int)sizeof(ImTextureRef) + draw_list->_CallbacksDataBuf.Capacity;
+    bytes += CalcDrawListSplitterMemory(&draw_list->_Splitter);
+    bytes += window->IDStack.Capacity * (int)sizeof(ImGuiID) + window->DC.ChildWindows.Capacity * (int)sizeof(ImGuiWindow*);
+    bytes += window->DC.ItemWidthStack.Capacity * (int)sizeof(float) + window->DC.TextWrapPosStack.Capacity * (int)sizeof(float);
+    return bytes;
+}
+
+static void GcAddTransientMemory(ImGuiTransientMemoryUsage* usage, ImGuiTransientMemoryEntry* entries, int* p_entries_count, ImGuiTransientMemoryKind kind, void* ptr, int bytes, bool can_compact, float unused_time)
+{
+    usage->Bytes[kind] += bytes;
+    usage->BytesTotal += bytes;
+    if (!can_compact || bytes == 0)
+        return;
+    if (entries != NULL)
+    {
+        ImGuiTransientMemoryEntry* entry = &entries[*p_entries_count];
+        entry->Kind = kind;
+        entry->Ptr = ptr;
+        entry->Bytes = bytes;
+        entry->Score = (float)bytes * (1.0f + ImMax(unused_time, 0.0f));
+    }
+    (*p_entries_count)++;
+}
+
+// Atlas may be shared by multiple contexts: a baked font can't be freed while any of them has it bound.
+static bool GcIsFontBakedBoundByAnyContext(ImFontAtlas* atlas, ImFontBaked* baked)
+{
+    for (ImDrawListSharedData* shared_data : atlas->DrawListSharedDatas)
+        if (ImGuiContext* ctx = shared_data->Context)
+            if (ctx->FontBaked == baked)
+                return true;
+    return false;
+}
+
+// Calculate transient memory usage, return number of buffers which may be freed now.
+// When 'out_entries' is provided, also output those buffers (caller must use a previous return value as capacity).
+// Buffers used during the last frame are not freed: they would likely be regrown immediately.
+static int GcGatherTransientMemory(ImGuiTransientMemoryUsage* out_usage, ImGuiTransientMemoryEntry* out_entries)
+{
+    ImGuiContext& g = *GImGui;
+    const float time = (float)g.Time;
+    *out_usage = ImGuiTransientMemoryUsage();
+    int entries_count = 0;
+
+    // Windows, including recycled instances which kept their buffers
+    for (int pass = 0; pass < 2; pass++)
+        for (ImGuiWindow* window : (pass == 0) ? g.Windows : g.WindowsPool)
+            GcAddTransientMemory(out_usage, out_entries, &entries_count, ImGuiTransientMemoryKind_Windows, window, CalcWindowTransientMemory(window), !window->WasActive && !window->Active && !window->MemoryCompacted, time - window->LastTimeActive);
+
+    // Tables
+    for (int n = 0; n < g.Tables.GetMapSize(); n++)
+        if (ImGuiTable* table = g.Tables.TryGetMapData(n))
+        {
+            const int table_idx = g.Tables.GetIndex(table);
+            const float last_time_active = (table_idx < g.TablesLastTimeActive.Size) ? g.TablesLastTimeActive[table_idx] : -1.0f;
+            const int bytes = table->SortSpecsMulti.Capacity * (int)sizeof(ImGuiTableColumnSortSpecs) + table->ColumnsNames.Buf.Capacity;
+            GcAddTransientMemory(out_usage, out_entries, &entries_count, ImGuiTransientMemoryKind_Tables, table, bytes, last_time_active >= 0.0f && table->LastFrameActive < g.FrameCount - 1, time - last_time_active);
+        }
+    for (ImGuiTableTempData& temp_data : g.TablesTempData)
+    {
+        const bool can_compact = g.TablesTempDataStacked == 0 && temp_data.LastTimeActive >= 0.0f && temp_data.LastTimeActive < time - g.IO.DeltaTime * 1.5f;
+        GcAddTransientMemory(out_usage, out_entries, &entries_count, ImGuiTransientMemoryKind_TablesTempData, &temp_data, CalcDrawListSplitterMemory(&temp_data.DrawSplitter), can_compact, time - temp_data.LastTimeActive);
+    }
+
+    // Text input (the state may still be accessed by its widget while any item is active, e.g. its scrollbar)
+    ImGuiInputTextState* input_state = &g.InputTextState;
+    const int input_state_bytes = input_state->TextA.Capacity + input_state->TextToRevertTo.Capacity + input_state->CallbackTextBackup.Capacity;
+    GcAddTransientMemory(out_usage, out_entries, &entries_count, ImGuiTransientMemoryKind_InputText, input_state, input_state_bytes, g.ActiveId == 0 && g.ActiveIdPreviousFrame == 0, 0.0f);
+    ImGuiInputTextDeactivatedState* input_deactivated_state = &g.InputTextDeactivatedState;
+    GcAddTransientMemory(out_usage, out_entries, &entries_count, ImGuiTransientMemoryKind_InputText, input_deactivated_state, input_deactivated_state->TextA.Capacity, input_deactivated_state->ID == 0 || input_deactivated_state->ID != g.DeactivatedItemData.ID, 0.0f);
+
+    // Baked fonts
+    for (ImFontAtlas* atlas : g.FontAtlases)
+        if (ImFontAtlasBuilder* builder = atlas->Builder)
+            for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+            {
+                ImFontBaked* baked = &builder->BakedPool[baked_n];
+                if (baked->WantDestroy)
+                    continue;
+                const bool can_compact = !atlas->Locked && !(baked->ContainerFont->Flags & ImFontFlags_LockBakedSizes) && baked->LastUsedFrame < builder->FrameCount - 1 && !GcIsFontBakedBoundByAnyContext(atlas, baked);
+                GcAddTransientMemory(out_usage, out_entries, &entries_count, ImGuiTransientMemoryKind_Fonts, baked, (int)baked->GetMemoryUsage(), can_compact, (builder->FrameCount - baked->LastUsedFrame) * g.IO.DeltaTime);
+            }
+
+    // List clippers
+    int clipper_bytes = g.ClipperTempData.Capacity * (int)sizeof(ImGuiListClipperData);
+    for (const ImGuiListClipperData& clipper_data : g.ClipperTempData)
+        clipper_bytes += clipper_data.Ranges.Capacity * (int)sizeof(ImGuiListClipperRange);
+    GcAddTransientMemory(out_usage, out_entries, &entries_count, ImGuiTransientMemoryKind_Clipper, &g.ClipperTempData, clipper_bytes, g.ClipperTempDataStacked == 0, 0.0f);
+    return entries_count;
+}
+
+void ImGui::GcCalcTransientMemoryUsage(ImGuiTransientMemoryUsage* out_usage)
+{
+    GcGatherTransientMemory(out_usage, NULL);
+}
+
+static int IMGUI_CDECL TransientMemoryEntryComparerByScore(const void* lhs, const void* rhs)
+{
+    const float lhs_score = ((const ImGuiTransientMemoryEntry*)lhs)->Score;
+    const float rhs_score = ((const ImGuiTransientMemoryEntry*)rhs)->Score;
+    return (lhs_score < rhs_score) ? +1 : (lhs_score > rhs_score) ? -1 : 0;
+}
+
+// Free unused transient buffers until memory usage fits within 'budget' bytes, largest and least recently used first.
+// Updates g.GcTransientMemoryUsage. Buffers used during the last frame are never freed, so usage may stay above budget.
+void ImGui::GcCompactTransientBuffersToBudget(int budget)
+{
+    IM_PROFILE_SCOPE("GcCompactTransientBuffersToBudget");
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.CurrentWindowStack.Size == 0); // Can't be called within a Begin()/End() pair
+    ImGuiTransientMemoryUsage* usage = &g.GcTransientMemoryUsage;
+    const int entries_count = GcGatherTransientMemory(usage, NULL);
+    if (usage->BytesTotal <= budget || entries_count == 0)
+        return;
+
+    ImGuiTransientMemoryEntry* entries = g.FrameArena.AllocArray<ImGuiTransientMemoryEntry>(entries_count);
+    GcGatherTransientMemory(usage, entries);
+    ImQsort(entries, (size_t)entries_count, sizeof(ImGuiTransientMemoryEntry), TransientMemoryEntryComparerByScore);
+    for (int entry_n = 0; entry_n < entries_count && usage->BytesTotal > budget; entry_n++)
+    {
+        const ImGuiTransientMemoryEntry& entry = entries[entry_n];
+        switch (entry.Kind)
+        {
+        case ImGuiTransientMemoryKind_Windows:          GcCompactTransientWindowBuffers((ImGuiWindow*)entry.Ptr); break;
+        case ImGuiTransientMemoryKind_Tables:           TableGcCompactTransientBuffers((ImGuiTable*)entry.Ptr); break;
+        case ImGuiTransientMemoryKind_TablesTempData:   TableGcCompactTransientBuffers((ImGuiTableTempData*)entry.Ptr); break;
+        case ImGuiTransientMemoryKind_InputText:
+            if (entry.Ptr == &g.InputTextState)
+            {
+                g.InputTextState.ID = 0; // Widget will reinitialize the state when activated again
+                g.InputTextState.ClearFreeMemory();
+                g.InputTextState.CallbackTextBackup.clear();
+            }
+            else
+            {
+                g.InputTextDeactivatedState.ClearFreeMemory();
+            }
+            break;
+        case ImGuiTransientMemoryKind_Fonts:
+        {
+            ImFontBaked* baked = (ImFontBaked*)entry.Ptr;
+            ImFontAtlasBakedDiscard(baked->ContainerFont->ContainerAtlas, baked->ContainerFont, baked);
+            break;
+        }
+        case ImGuiTransientMemoryKind_Clipper:          g.ClipperTempData.clear_destruct(); break;
+        default: IM_ASSERT(0);
+        }
+        usage->Bytes[entry.Kind] -= entry.Bytes;
+        usage->BytesTotal -= entry.Bytes;
+        g.GcTransientMemoryCompactedCount++;
+    }
+}
+
+// Child windows, popups and tooltips are recreated on demand without user-visible loss beside their state (scrolling, tree nodes open state etc.)
+static inline bool IsWindowRecyclable(ImGuiWindow* window)
+{
+    return (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_Popup | ImGuiWindowFlags_Tooltip)) != 0 && window->SettingsOffset == -1;
+}
+
+static void GcKeepWindow(ImGuiStorage* recycle_set, ImGuiWindow* window, bool* changed)
+{
+    if (window != NULL && recycle_set->GetBool(window->ID))
+    {
+        recycle_set->SetBool(window->ID, false);
+        *changed = true;
+    }
+}
+
+static int IMGUI_CDECL WindowComparerByLastFrameActive(const void* lhs, const void* rhs)
+{
+    return (*(const ImGuiWindow* const*)lhs)->LastFrameActive - (*(const ImGuiWindow* const*)rhs)->LastFrameActive;
+}
+
+// Recycle least recently used transient windows so that no more than 'unused_max' of them are kept while unused.
+// - Windows still referenced by the context, by a kept window, an open popup, a table, a tab bar or a multi-select scope are kept.
+// - Recycled instances are moved to g.WindowsPool[], so CreateNewWindow() can reuse them along with their draw list buffers.
+void ImGui::GcRecycleTransientWindows(int unused_max)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.CurrentWindowStack.Size == 0); // Can't be called within a Begin()/End() pair
+
+    // Select least recently used windows
+    ImVector<ImGuiWindow*>& candidates = g.WindowsTempSortBuffer;
+    candidates.resize(0);
+    for (ImGuiWindow* window : g.Windows)
+        if (!window->WasActive && !window->Active && IsWindowRecyclable(window))
+            candidates.push_back(window);
+    g.WindowsTransientUnusedLimit = ImMax(IMGUI_WINDOWS_TRANSIENT_UNUSED_MAX, candidates.Size);
+    if (candidates.Size <= unused_max)
+        return;
+    ImQsort(candidates.Data, (size_t)candidates.Size, sizeof(ImGuiWindow*), WindowComparerByLastFrameActive);
+    candidates.resize(candidates.Size - unused_max);
+    ImGuiStorage recycle_set;
+    recycle_set.Data.reserve(candidates.Size);
+    for (ImGuiWindow* window : candidates)
+        recycle_set.Data.push_back(ImGuiStoragePair(window->ID, 1));
+    recycle_set.BuildSortByKey();
+
+    // Keep referenced windows
+    bool changed = false;
+    ImGuiWindow* context_refs[] = { g.CurrentWindow, g.HoveredWindow, g.HoveredWindowUnderMovingWindow, g.HoveredWindowBeforeClear, g.MovingWindow, g.WheelingWindow, g.ActiveIdWindow, g.NavWindow, g.NavWindowingTarget, g.NavWindowingTargetAnim, g.NavWindowingListWindow, g.TooltipPreviousWindow, g.LogWindow, g.BoxSelectState.Window,
+        g.NavInitResult.Window, g.NavMoveResultLocal.Window, g.NavMoveResultLocalVisible.Window, g.NavMoveResultOther.Window, g.NavTabbingResultFirst.Window };
+    for (ImGuiWindow* window : context_refs)
+        GcKeepWindow(&recycle_set, window, &changed);
+    for (ImGuiPopupData& popup_data : g.OpenPopupStack)
+    {
+        GcKeepWindow(&recycle_set, popup_data.Window, &changed);
+        GcKeepWindow(&recycle_set, popup_data.RestoreNavWindow, &changed);
+    }
+    for (int n = 0; n < g.Tables.GetMapSize(); n++)
+        if (ImGuiTable* table = g.Tables.TryGetMapData(n))
+        {
+            GcKeepWindow(&recycle_set, table->OuterWindow, &changed);
+            GcKeepWindow(&recycle_set, table->InnerWindow, &changed);
+        }
+    for (int n = 0; n < g.TabBars.GetMapSize(); n++)
+        if (ImGuiTabBar* tab_bar = g.TabBars.TryGetMapData(n))
+            GcKeepWindow(&recycle_set, tab_bar->Window, &changed);
+    for (int n = 0; n < g.MultiSelectStorage.GetMapSize(); n++)
+        if (ImGuiMultiSelectState* ms = g.MultiSelectStorage.TryGetMapData(n))
+            GcKeepWindow(&recycle_set, ms->Window, &changed);
+
+    // Keeping a window keeps the windows it references: iterate until stable
+    do
+    {
+        changed = false;
+        for (ImGuiWindow* window : g.Windows)
+        {
+            if (recycle_set.GetBool(window->ID))
+                continue;
+            GcKeepWindow(&recycle_set, window->ParentWindow, &changed);
+            GcKeepWindow(&recycle_set, window->ParentWindowInBeginStack, &changed);
+            GcKeepWindow(&recycle_set, window->ParentWindowForFocusRoute, &changed);
+            GcKeepWindow(&recycle_set, window->RootWindow, &changed);
+            GcKeepWindow(&recycle_set, window->RootWindowPopupTree, &changed);
+            GcKeepWindow(&recycle_set, window->RootWindowForTitleBarHighlight, &changed);
+            GcKeepWindow(&recycle_set, window->RootWindowForNav, &changed);
+            GcKeepWindow(&recycle_set, window->NavLastChildNavWindow, &changed);
+            for (ImGuiWindow* child : window->DC.ChildWindows)
+                GcKeepWindow(&recycle_set, child, &changed);
+        }
+    }
+    while (changed);
+
+    // Remove from lists
+    int dst_n = 0;
+    for (ImGuiWindow* window : g.Windows)
+    {
+        if (!recycle_set.GetBool(window->ID))
+        {
+            g.Windows[dst_n++] = window;
+            continue;
+        }
+        g.WindowsDisplayOrder.Remove(window);
+        if (g.WindowsFocusOrder.Contains(window))
+            g.WindowsFocusOrder.Remove(window);
+    }
+    if (dst_n == g.Windows.Size)
+        return;
+    g.Windows.resize(dst_n);
+    g.WindowsHitGrid.Dirty = true;
+
+    // Move to pool, least recently used first so most recently used is reused first
+    int recycled_count = 0;
+    for (ImGuiWindow* window : candidates)
+    {
+        if (!recycle_set.GetBool(window->ID))
+            continue;
+        g.WindowsById.SetVoidPtr(window->ID, NULL);
+        if (g.WindowsPool.Size == IMGUI_WINDOWS_POOL_MAX)
+        {
+            IM_DELETE(g.WindowsPool[0]);
+            g.WindowsPool.erase(g.WindowsPool.Data);
+        }
+        g.WindowsPool.push_back(window);
+        recycled_count++;
+    }
+    g.WindowsPoolRecycledCount += recycled_count;
+    g.WindowsTransientUnusedLimit = ImMax(IMGUI_WINDOWS_TRANSIENT_UNUSED_MAX, candidates.Size + unused_max - recycled_count);
+}
+
 void ImGui::SetActiveID(ImGuiID id, ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
@@ -4932,12 +5528,65 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
 }
 
 // IM_ALLOC() == ImGui::MemAlloc()
+#ifdef IMGUI_ENABLE_DEBUG_ALLOC_TAGS
+// Record size and tag in a header preceding the allocation, so MemFree() can attribute it back.
+static void* DebugAllocTagsRecordAlloc(void* base, size_t size)
+{
+    IM_STATIC_ASSERT(sizeof(ImGuiAllocTagHeader) <= IM_ALLOC_TAG_HEADER_SIZE);
+    ImGuiAllocTagHeader* header = (ImGuiAllocTagHeader*)base;
+    header->Size = size;
+    header->Tag = GImAllocTag;
+
+    ImGuiAllocTagStats* stats = &GImAllocTagStats[header->Tag];
+    stats->LiveBytes += size;
+    stats->PeakBytes = ImMax(stats->PeakBytes, stats->LiveBytes);
+    stats->LiveCount++;
+    stats->TotalAllocCount++;
+    const int frame_count = GImGui ? GImGui->FrameCount : 0;
+    if (stats->FrameCount != frame_count)
+    {
+        stats->PrevFrameAllocCount = (stats->FrameCount == frame_count - 1) ? stats->FrameAllocCount : 0;
+        stats->FrameCount = frame_count;
+        stats->FrameAllocCount = 0;
+    }
+    stats->FrameAllocCount++;
+    return (char*)base + IM_ALLOC_TAG_HEADER_SIZE;
+}
+
+static void* DebugAllocTagsRecordFree(void* ptr)
+{
+    ImGuiAllocTagHeader* header = (ImGuiAllocTagHeader*)(void*)((char*)ptr - IM_ALLOC_TAG_HEADER_SIZE);
+    ImGuiAllocTagStats* stats = &GImAllocTagStats[header->Tag];
+    stats->LiveBytes -= header->Size;
+    stats->LiveCount--;
+    return header;
+}
+
+// Number of allocations during the last full frame
+static int DebugAllocTagsGetLastFrameAllocCount(const ImGuiAllocTagStats* stats, int frame_count)
+{
+    if (stats->FrameCount == frame_count)
+        return stats->PrevFrameAllocCount;
+    return (stats->FrameCount == frame_count - 1) ? stats->FrameAllocCount : 0;
+}
+#endif
+
 void* ImGui::MemAlloc(size_t size)
 {
+#ifdef IMGUI_ENABLE_DEBUG_ALLOC_TAGS
+    void* ptr = (*GImAllocatorAllocFunc)(size + IM_ALLOC_TAG_HEADER_SIZE, GImAllocatorUserData);
+    if (ptr != NULL)
+        ptr = DebugAllocTagsRecordAlloc(ptr, size);
+#else
     void* ptr = (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
+#endif
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (ImGuiContext* ctx = GImGui)
+    {
         DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
+        if (ctx->DebugWindowsCostsEnabled && ctx->CurrentWindow)
+            ctx->CurrentWindow->Cost.AllocCount++;
+    }
 #endif
     return ptr;
 }
@@ -4949,6 +5598,10 @@ void ImGui::MemFree(void* ptr)
     if (ptr != NULL)
         if (ImGuiContext* ctx = GImGui)
             DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
+#endif
+#ifdef IMGUI_ENABLE_DEBUG_ALLOC_TAGS
+    if (ptr != NULL)
+        ptr = DebugAllocTagsRecordFree(ptr);
 #endif
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
@@ -4979,6 +5632,190 @@ void ImGui::DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr
     }
 }
 
+#ifdef IMGUI_ENABLE_DEBUG_ALLOC_TAGS
+ImGuiAllocTag ImGui::DebugSetAllocTag(ImGuiAllocTag tag)
+{
+    IM_ASSERT(tag >= 0 && tag < ImGuiAllocTag_COUNT);
+    ImGuiAllocTag backup_tag = GImAllocTag;
+    GImAllocTag = tag;
+    return backup_tag;
+}
+
+const ImGuiAllocTagStats* ImGui::DebugGetAllocTagStats(ImGuiAllocTag tag)
+{
+    IM_ASSERT(tag >= 0 && tag < ImGuiAllocTag_COUNT);
+    return &GImAllocTagStats[tag];
+}
+
+const char* ImGui::DebugGetAllocTagName(ImGuiAllocTag tag)
+{
+    static const char* names[] = { "Misc", "Windows", "DrawList", "Text", "Tables", "Fonts", "Storage" };
+    IM_STATIC_ASSERT(IM_ARRAYSIZE(names) == ImGuiAllocTag_COUNT);
+    IM_ASSERT(tag >= 0 && tag < ImGuiAllocTag_COUNT);
+    return names[tag];
+}
+
+// Output e.g. { "frame": 120, "tags": [ { "name": "Misc", "live_bytes": 1024, "peak_bytes": 2048, "live_count": 4, "total_alloc_count": 10, "frame_alloc_count": 0 }, ... ] }
+// 'frame_alloc_count' is the number of allocations during the last full frame of the current context.
+void ImGui::DebugAllocTagsExportJson(ImGuiTextBuffer* buf)
+{
+    const int frame_count = GImGui ? GImGui->FrameCount : 0;
+    buf->appendf("{\n  \"frame\": %d,\n  \"tags\": [\n", frame_count);
+    for (int tag = 0; tag < ImGuiAllocTag_COUNT; tag++)
+    {
+        const ImGuiAllocTagStats* stats = &GImAllocTagStats[tag];
+        buf->appendf("    { \"name\": \"%s\", \"live_bytes\": %llu, \"peak_bytes\": %llu, \"live_count\": %d, \"total_alloc_count\": %d, \"frame_alloc_count\": %d }%s\n",
+            DebugGetAllocTagName((ImGuiAllocTag)tag), (unsigned long long)stats->LiveBytes, (unsigned long long)stats->PeakBytes, stats->LiveCount, stats->TotalAllocCount,
+            DebugAllocTagsGetLastFrameAllocCount(stats, frame_count), (tag + 1 < ImGuiAllocTag_COUNT) ? "," : "");
+    }
+    buf->append("  ]\n}\n");
+}
+#endif
+
+#ifdef IMGUI_ENABLE_PROFILER
+void ImGui::ProfileBegin(const char* name)
+{
+    ProfileBeginEx(name, 0);
+}
+
+void ImGui::ProfileBeginEx(const char* name, ImGuiID window_id)
+{
+    ImGuiContext* ctx = GImGui;
+    if (ctx == NULL || !ctx->Profiler.Recording)
+        return;
+    ImGuiProfiler* profiler = &ctx->Profiler;
+    ImGuiProfilerFrame* frame = &profiler->Frames[profiler->FramesIdx];
+    if (frame->Events.Size >= IMGUI_PROFILER_MAX_EVENTS)
+    {
+        frame->DroppedEventsCount++;
+        profiler->Stack.push_back(-1);
+        return;
+    }
+    profiler->Stack.push_back(frame->Events.Size);
+    frame->Events.resize(frame->Events.Size + 1);
+    ImGuiProfilerEvent* event = &frame->Events.back();
+    event->Name = name;
+    event->WindowID = window_id;
+    event->Depth = profiler->Stack.Size - 1;
+    event->StartTime = event->EndTime = ImTimeGetMicroseconds();
+}
+
+void ImGui::ProfileEnd()
+{
+    ImGuiContext* ctx = GImGui;
+    if (ctx == NULL || !ctx->Profiler.Recording)
+        return;
+    ImGuiProfiler* profiler = &ctx->Profiler;
+    if (profiler->Stack.Size == 0) // Matching ProfileBegin() may have been called before recording started
+        return;
+    const int event_idx = profiler->Stack.back();
+    profiler->Stack.pop_back();
+    if (event_idx != -1)
+        profiler->Frames[profiler->FramesIdx].Events[event_idx].EndTime = ImTimeGetMicroseconds();
+}
+
+// Called by NewFrame(): complete frame being recorded and start a new one.
+// Events which are still open (e.g. a scope around NewFrame()) are closed in previous frame and reopened in the new one.
+static void ProfilerNewFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    const ImU64 time = ImTimeGetMicroseconds();
+    if (profiler->Recording)
+    {
+        ImGuiProfilerFrame* frame = &profiler->Frames[profiler->FramesIdx];
+        frame->EndTime = time;
+        for (int event_idx : profiler->Stack)
+            if (event_idx != -1)
+                frame->Events[event_idx].EndTime = time;
+        profiler->FramesIdx = (profiler->FramesIdx + 1) % IMGUI_PROFILER_FRAMES;
+        profiler->FramesCount = ImMin(profiler->FramesCount + 1, IMGUI_PROFILER_FRAMES - 1);
+    }
+    if (profiler->Paused)
+    {
+        profiler->Recording = false;
+        profiler->Stack.resize(0);
+        return;
+    }
+
+    const ImGuiProfilerFrame* prev_frame = profiler->Recording ? &profiler->Frames[(profiler->FramesIdx + IMGUI_PROFILER_FRAMES - 1) % IMGUI_PROFILER_FRAMES] : NULL;
+    ImGuiProfilerFrame* frame = &profiler->Frames[profiler->FramesIdx];
+    frame->FrameCount = g.FrameCount;
+    frame->StartTime = frame->EndTime = time;
+    frame->DroppedEventsCount = 0;
+    frame->Events.resize(0);
+    for (int depth = 0; depth < profiler->Stack.Size; depth++)
+    {
+        int* p_event_idx = &profiler->Stack[depth];
+        if (*p_event_idx == -1 || prev_frame == NULL)
+        {
+            *p_event_idx = -1;
+            continue;
+        }
+        ImGuiProfilerEvent event = prev_frame->Events[*p_event_idx];
+        event.StartTime = event.EndTime = time;
+        *p_event_idx = frame->Events.Size;
+        frame->Events.push_back(event);
+    }
+    profiler->Recording = true;
+}
+
+// Event name, along with window name for events associated to a window which is still alive (e.g. "Begin: Dear ImGui Demo")
+static const char* DebugProfilerGetEventName(const ImGuiProfilerEvent* event, char* buf, int buf_size)
+{
+    ImGuiWindow* window = event->WindowID ? ImGui::FindWindowByID(event->WindowID) : NULL;
+    if (window == NULL)
+        return event->Name;
+    ImFormatString(buf, (size_t)buf_size, "%s: %s", event->Name, window->Name);
+    return buf;
+}
+
+static void DebugProfilerAppendJsonString(ImGuiTextBuffer* buf, const char* str)
+{
+    buf->append("\"");
+    for (const char* s = str; *s != 0; s++)
+    {
+        if (*s == '"' || *s == '\\')
+            buf->appendf("\\%c", *s);
+        else if ((unsigned char)*s < 0x20)
+            buf->appendf("\\u%04x", (unsigned char)*s);
+        else
+            buf->append(s, s + 1);
+    }
+    buf->append("\"");
+}
+
+// Output completed frames in Chrome trace event format, e.g.
+// { "displayTimeUnit": "ms", "traceEvents": [ { "name": "Frame 120", "cat": "frame", "ph": "X", "ts": 0, "dur": 16667, "pid": 1, "tid": 1 }, ... ] }
+// Load in chrome://tracing or https://ui.perfetto.dev. Timestamps are in microseconds, relative to the beginning of the oldest frame.
+void ImGui::DebugProfilerExportChromeTrace(ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    buf->append("{\n  \"displayTimeUnit\": \"ms\",\n  \"traceEvents\": [\n");
+    const char* separator = "";
+    ImU64 base_time = 0;
+    for (int frame_n = profiler->FramesCount; frame_n >= 1; frame_n--)
+    {
+        const ImGuiProfilerFrame* frame = &profiler->Frames[(profiler->FramesIdx + IMGUI_PROFILER_FRAMES - frame_n) % IMGUI_PROFILER_FRAMES];
+        if (frame_n == profiler->FramesCount)
+            base_time = frame->StartTime;
+        buf->appendf("%s    { \"name\": \"Frame %d\", \"cat\": \"frame\", \"ph\": \"X\", \"ts\": %llu, \"dur\": %llu, \"pid\": 1, \"tid\": 1 }",
+            separator, frame->FrameCount, (unsigned long long)(frame->StartTime - base_time), (unsigned long long)(frame->EndTime - frame->StartTime));
+        separator = ",\n";
+        for (const ImGuiProfilerEvent& event : frame->Events)
+        {
+            char name_buf[256];
+            buf->appendf("%s    { \"name\": ", separator);
+            DebugProfilerAppendJsonString(buf, DebugProfilerGetEventName(&event, name_buf, IM_ARRAYSIZE(name_buf)));
+            buf->appendf(", \"cat\": \"imgui\", \"ph\": \"X\", \"ts\": %llu, \"dur\": %llu, \"pid\": 1, \"tid\": 1 }",
+                (unsigned long long)(event.StartTime - base_time), (unsigned long long)(event.EndTime - event.StartTime));
+        }
+    }
+    buf->append("\n  ]\n}\n");
+}
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -5236,6 +6073,7 @@ static bool IsWindowActiveAndVisible(ImGuiWindow* window)
 // The reason this is exposed in imgui_internal.h is: on touch-based system that don't have hovering, we want to dispatch inputs to the right target (imgui vs imgui+app)
 void ImGui::UpdateHoveredWindowAndCaptureFlags(const ImVec2& mouse_pos)
 {
+    IM_PROFILE_SCOPE("UpdateHoveredWindow");
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
 
@@ -5362,6 +6200,11 @@ void ImGui::NewFrame()
 
     g.Time += g.IO.DeltaTime;
     g.FrameCount += 1;
+    g.FrameArena.Reset();
+#ifdef IMGUI_ENABLE_PROFILER
+    ProfilerNewFrame();
+#endif
+    IM_PROFILE_SCOPE("NewFrame");
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
@@ -5505,6 +6348,11 @@ void ImGui::NewFrame()
     // Mark all windows as not visible and compact unused memory.
     IM_ASSERT(g.WindowsFocusOrder.Size <= g.Windows.Size);
     const float memory_compact_start_time = (g.GcCompactAll || g.IO.ConfigMemoryCompactTimer < 0.0f) ? FLT_MAX : (float)g.Time - g.IO.ConfigMemoryCompactTimer;
+    int transient_unused_count = 0;
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    const bool windows_costs_were_enabled = g.DebugWindowsCostsEnabled;
+    g.DebugWindowsCostsEnabled = g.IO.ConfigDebugWindowsCosts || g.DebugWindowsCostsRequestFrame >= g.FrameCount - 1;
+#endif
     for (ImGuiWindow* window : g.Windows)
     {
         window->WasActive = window->Active;
@@ -5512,12 +6360,25 @@ void ImGui::NewFrame()
         window->WriteAccessed = false;
         window->BeginCountPreviousFrame = window->BeginCount;
         window->BeginCount = 0;
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+        if (g.DebugWindowsCostsEnabled || windows_costs_were_enabled)
+        {
+            window->CostLastFrame = window->Cost;
+            window->Cost = ImGuiWindowCost();
+        }
+#endif
 
         // Garbage collect transient buffers of recently unused windows
         if (!window->WasActive && !window->MemoryCompacted && window->LastTimeActive < memory_compact_start_time)
             GcCompactTransientWindowBuffers(window);
+        if (!window->WasActive && IsWindowRecyclable(window))
+            transient_unused_count++;
     }
 
+    // Recycle least recently used transient windows when too many are unused (e.g. child windows with unique names)
+    if (g.GcCompactAll || transient_unused_count > g.WindowsTransientUnusedLimit)
+        GcRecycleTransientWindows(g.GcCompactAll ? 0 : IMGUI_WINDOWS_TRANSIENT_UNUSED_MAX);
+
     // Find hovered window
     // (needs to be before UpdateMouseMovingWindowNewFrame so we fill g.HoveredWindowUnderMovingWindow on the mouse release frame)
     // (currently needs to be done after the WasActive=Active loop and FindHoveredWindowEx uses ->Active)
@@ -5553,6 +6414,10 @@ void ImGui::NewFrame()
         GcCompactTransientMiscBuffers();
     g.GcCompactAll = false;
 
+    // Free largest and least recently used transient buffers when above memory budget
+    if (g.IO.ConfigMemoryCompactBudget > 0)
+        GcCompactTransientBuffersToBudget(g.IO.ConfigMemoryCompactBudget);
+
     // Closing the focused window restore focus to the first active root window in descending z-order
     if (g.NavWindow && !g.NavWindow->WasActive)
         FocusTopMostWindowUnderOne(NULL, NULL, NULL, ImGuiFocusRequestFlags_RestoreFocusedChild);
@@ -5620,20 +6485,40 @@ static int IMGUI_CDECL ChildWindowComparer(const void* lhs, const void* rhs)
     return (a->BeginOrderWithinParent - b->BeginOrderWithinParent);
 }
 
-static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window)
+// Request EndFrame() to relink the active child windows of the top-most parent of 'window' (see UpdateWindowsDisplayOrderEndFrame()).
+static void QueueWindowDisplayOrderRelink(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    if (window == NULL || window->DisplayOrderRelinkQueued)
+        return;
+    window->DisplayOrderRelinkQueued = true;
+    g.WindowsDisplayOrderRelink.push_back(window);
+}
+
+// Link active child windows of 'window' (recursively, in sorted order) right after 'prev' in g.WindowsDisplayOrder. Return the last one.
+static ImGuiWindow* RelinkChildWindowsInDisplayOrder(ImGuiWindow* window, ImGuiWindow* prev)
 {
-    out_sorted_windows->push_back(window);
-    if (window->Active)
+    ImGuiContext& g = *GImGui;
+    if (!window->Active)
+        return prev;
+    if (window->DC.ChildWindowsNeedSort)
+    {
+        ImQsort(window->DC.ChildWindows.Data, (size_t)window->DC.ChildWindows.Size, sizeof(ImGuiWindow*), ChildWindowComparer);
+        window->DC.ChildWindowsNeedSort = false;
+    }
+    for (ImGuiWindow* child : window->DC.ChildWindows)
     {
-        int count = window->DC.ChildWindows.Size;
-        ImQsort(window->DC.ChildWindows.Data, (size_t)count, sizeof(ImGuiWindow*), ChildWindowComparer);
-        for (int i = 0; i < count; i++)
+        if (!child->Active)
+            continue;
+        if (g.WindowsDisplayOrder.GetNext(prev) != child)
         {
-            ImGuiWindow* child = window->DC.ChildWindows[i];
-            if (child->Active)
-                AddWindowToSortBuffer(out_sorted_windows, child);
+            g.WindowsDisplayOrder.Remove(child);
+            g.WindowsDisplayOrder.InsertAfter(child, prev);
+            g.WindowsDisplayOrderChanged = true;
         }
+        prev = RelinkChildWindowsInDisplayOrder(child, child);
     }
+    return prev;
 }
 
 static void AddWindowToDrawData(ImGuiWindow* window, int layer)
@@ -5805,6 +6690,7 @@ static void ImGui::RenderDimmedBackgrounds()
 // This is normally called by Render(). You may want to call it directly if you want to avoid calling Render() but the gain will be very minimal.
 void ImGui::EndFrame()
 {
+    IM_PROFILE_SCOPE("EndFrame");
     ImGuiContext& g = *GImGui;
     IM_ASSERT(g.Initialized);
 
@@ -5874,20 +6760,9 @@ void ImGui::EndFrame()
     // Initiate moving window + handle left-click and right-click focus
     UpdateMouseMovingWindowEndFrame();
 
-    // Sort the window list so that all child windows are after their parent
-    // We cannot do that on FocusWindow() because children may not exist yet
-    g.WindowsTempSortBuffer.resize(0);
-    g.WindowsTempSortBuffer.reserve(g.Windows.Size);
-    for (ImGuiWindow* window : g.Windows)
-    {
-        if (window->Active && (window->Flags & ImGuiWindowFlags_ChildWindow))       // if a child is active its parent will add it
-            continue;
-        AddWindowToSortBuffer(&g.WindowsTempSortBuffer, window);
-    }
-
-    // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
-    IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
-    g.Windows.swap(g.WindowsTempSortBuffer);
+    // Keep child windows after their parent in display order
+    UpdateWindowsDisplayOrderEndFrame();
+    UpdateWindowsHitGridEndFrame();
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
     UpdateTexturesEndFrame();
@@ -5910,6 +6785,7 @@ void ImGui::EndFrame()
 // it is the role of the ImGui_ImplXXXX_RenderDrawData() function provided by the renderer backend)
 void ImGui::Render()
 {
+    IM_PROFILE_SCOPE("Render");
     ImGuiContext& g = *GImGui;
     IM_ASSERT(g.Initialized);
 
@@ -5977,35 +6853,195 @@ void ImGui::Render()
             ImFontAtlasDebugLogTextureRequests(atlas);
 #endif
 
-    CallContextHooks(&g, ImGuiContextHookType_RenderPost);
+    CallContextHooks(&g, ImGuiContextHookType_RenderPost);
+}
+
+// Calculate text size. Text can be multi-line. Optionally ignore text after a ## marker.
+// CalcTextSize("") should return ImVec2(0.0f, g.FontSize)
+ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)
+{
+    IM_PROFILE_SCOPE("CalcTextSize");
+    ImGuiContext& g = *GImGui;
+
+    const char* text_display_end;
+    if (hide_text_after_double_hash)
+        text_display_end = FindRenderedTextEnd(text, text_end);      // Hide anything after a '##' string
+    else
+        text_display_end = text_end;
+
+    ImFont* font = g.Font;
+    const float font_size = g.FontSize;
+    if (text == text_display_end)
+        return ImVec2(0.0f, font_size);
+    const char* text_remaining = NULL;
+    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, &text_remaining);
+    DebugWindowCostAddTextBytes(g, text, text_remaining);
+
+    // Round
+    // FIXME: This has been here since Dec 2015 (7b0bf230) but down the line we want this out.
+    // FIXME: Investigate using ceilf or e.g.
+    // - https://git.musl-libc.org/cgit/musl/tree/src/math/ceilf.c
+    // - https://embarkstudios.github.io/rust-gpu/api/src/libm/math/ceilf.rs.html
+    text_size.x = IM_TRUNC(text_size.x + 0.99999f);
+
+    return text_size;
+}
+
+// Calculate sizes of many strings at once, same as calling CalcTextSize() on each of them (without '##' handling).
+void ImGui::CalcTextSizeBatch(const char* const* texts, const char* const* texts_end, int count, ImVec2* out_sizes, float wrap_width)
+{
+    ImGuiContext& g = *GImGui;
+    g.Font->CalcTextSizeBatch(g.FontSize, wrap_width, texts, texts_end, count, out_sizes);
+    for (int n = 0; n < count; n++)
+        out_sizes[n].x = IM_TRUNC(out_sizes[n].x + 0.99999f); // Same rounding as CalcTextSize()
+}
+
+// Map a coordinate to a cell index. Monotonic so a point inside a rectangle always maps within the cells covered by that rectangle.
+static inline int WindowsHitGridCell(float v, float min, float size_inv, int cells_count)
+{
+    return (int)ImClamp((v - min) * size_inv, 0.0f, (float)(cells_count - 1));
+}
+
+// Keep all active child windows right after their parent in g.WindowsDisplayOrder, then update g.Windows[].
+// - We cannot do that on FocusWindow() because children may not exist yet.
+// - Only the hierarchies of windows queued with QueueWindowDisplayOrderRelink() are visited: windows moved by BringWindowToDisplayXXX(),
+//   (de)activated, or which changed parent, flags or child windows submission order this frame. Nothing is done in the common case.
+static void ImGui::UpdateWindowsDisplayOrderEndFrame()
+{
+    ImGuiContext& g = *GImGui;
+    for (ImGuiWindow* window : g.Windows)
+        if (window->Active != window->WasActive)                                    // hovering next frame is based on ->WasActive
+        {
+            QueueWindowDisplayOrderRelink(window);
+            if (window->Flags & ImGuiWindowFlags_ChildWindow)
+                QueueWindowDisplayOrderRelink(window->ParentWindow);                // A deactivated child window stays after its former siblings
+            g.WindowsHitGrid.Dirty = true;
+        }
+
+    // Active child windows are linked by their parent: relink from the top-most one, once.
+    ImVector<ImGuiWindow*>& top_windows = g.WindowsTempSortBuffer;
+    top_windows.resize(0);
+    for (ImGuiWindow* window : g.WindowsDisplayOrderRelink)
+        window->DisplayOrderRelinkQueued = false;
+    for (ImGuiWindow* window : g.WindowsDisplayOrderRelink)
+    {
+        while (window->Active && (window->Flags & ImGuiWindowFlags_ChildWindow) && window->ParentWindow != NULL)
+            window = window->ParentWindow;
+        if (!window->DisplayOrderRelinkQueued)
+        {
+            window->DisplayOrderRelinkQueued = true;
+            top_windows.push_back(window);
+        }
+    }
+    g.WindowsDisplayOrderRelink.resize(0);
+    for (ImGuiWindow* window : top_windows)
+    {
+        window->DisplayOrderRelinkQueued = false;
+        RelinkChildWindowsInDisplayOrder(window, window);
+    }
+    UpdateWindowsFromDisplayOrder();
+}
+
+// Copy g.WindowsDisplayOrder into g.Windows[] if it changed since last call.
+// BringWindowToDisplayXXX() functions only relink windows: this is called by functions reading g.Windows[] order during the frame, and in EndFrame().
+static void ImGui::UpdateWindowsFromDisplayOrder()
+{
+    ImGuiContext& g = *GImGui;
+    if (!g.WindowsDisplayOrderChanged)
+        return;
+    g.WindowsDisplayOrderChanged = false;
+    g.WindowsHitGrid.Dirty = true;                                                  // Grid stores indices into g.Windows[]
+
+    // This usually assert if there is a mismatch between windows in g.Windows[] and in g.WindowsDisplayOrder, aka we've done something wrong.
+    IM_ASSERT(g.Windows.Size == g.WindowsDisplayOrder.Size);
+    int n = 0;
+    for (int node_idx = g.WindowsDisplayOrder.FirstIdx; node_idx != -1; node_idx = g.WindowsDisplayOrder.Nodes[node_idx].NextIdx)
+        g.Windows[n++] = g.WindowsDisplayOrder.Nodes[node_idx].Window;
 }
 
-// Calculate text size. Text can be multi-line. Optionally ignore text after a ## marker.
-// CalcTextSize("") should return ImVec2(0.0f, g.FontSize)
-ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)
+// Rebuild the spatial index used by FindHoveredWindowEx(), only when windows were created, reordered, moved or resized this frame.
+// - Every active window is stored in all the cells overlapped by its OuterRectClipped + largest hit padding.
+// - Cells store indices into g.Windows[] in ascending order, so FindHoveredWindowEx() still walks them front-to-back.
+static void ImGui::UpdateWindowsHitGridEndFrame()
 {
     ImGuiContext& g = *GImGui;
+    ImGuiWindowsHitGrid* grid = &g.WindowsHitGrid;
+    const ImVec2 padding = ImMax(g.Style.TouchExtraPadding, ImVec2(g.Style.WindowBorderHoverPadding, g.Style.WindowBorderHoverPadding));
+    if (!grid->Dirty && (grid->CellsX == 0 || (grid->Padding.x == padding.x && grid->Padding.y == padding.y)))
+        return;
+    grid->Dirty = false;
+    grid->CellsX = grid->CellsY = 0;
+    grid->CellsOffsets.resize(0);
+    grid->WindowsIndices.resize(0);
+    if (g.Windows.Size < IMGUI_WINDOWS_HIT_GRID_MIN_WINDOWS)
+        return;
 
-    const char* text_display_end;
-    if (hide_text_after_double_hash)
-        text_display_end = FindRenderedTextEnd(text, text_end);      // Hide anything after a '##' string
-    else
-        text_display_end = text_end;
+    // Calculate bounds (rectangles may be inverted by clipping, but still hit-testable thanks to padding)
+    ImRect bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    int windows_count = 0;
+    for (ImGuiWindow* window : g.Windows)
+    {
+        if (!window->Active)
+            continue;
+        ImRect r(window->OuterRectClipped.Min - padding, window->OuterRectClipped.Max + padding);
+        if (!(r.Min.x < r.Max.x && r.Min.y < r.Max.y))
+            continue;
+        bounds.Add(r);
+        windows_count++;
+    }
+    if (windows_count < IMGUI_WINDOWS_HIT_GRID_MIN_WINDOWS || !(bounds.GetWidth() < FLT_MAX && bounds.GetHeight() < FLT_MAX))
+        return;
 
-    ImFont* font = g.Font;
-    const float font_size = g.FontSize;
-    if (text == text_display_end)
-        return ImVec2(0.0f, font_size);
-    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+    const int cells_per_axis = ImClamp((int)ImSqrt((float)windows_count), 1, IMGUI_WINDOWS_HIT_GRID_MAX_CELLS);
+    const int cells_x = cells_per_axis;
+    const int cells_y = cells_per_axis;
+    const ImVec2 cell_size_inv((float)cells_x / bounds.GetWidth(), (float)cells_y / bounds.GetHeight());
 
-    // Round
-    // FIXME: This has been here since Dec 2015 (7b0bf230) but down the line we want this out.
-    // FIXME: Investigate using ceilf or e.g.
-    // - https://git.musl-libc.org/cgit/musl/tree/src/math/ceilf.c
-    // - https://embarkstudios.github.io/rust-gpu/api/src/libm/math/ceilf.rs.html
-    text_size.x = IM_TRUNC(text_size.x + 0.99999f);
+    // Counting sort: count entries per cell, convert to offsets, then fill in g.Windows[] order.
+    ImVector<int>& offsets = grid->CellsOffsets;
+    offsets.resize(cells_x * cells_y + 1);
+    memset(offsets.Data, 0, (size_t)offsets.Size * sizeof(int));
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (int window_n = 0; window_n < g.Windows.Size; window_n++)
+        {
+            ImGuiWindow* window = g.Windows[window_n];
+            if (!window->Active)
+                continue;
+            ImRect r(window->OuterRectClipped.Min - padding, window->OuterRectClipped.Max + padding);
+            if (!(r.Min.x < r.Max.x && r.Min.y < r.Max.y))
+                continue;
+            const int x0 = WindowsHitGridCell(r.Min.x, bounds.Min.x, cell_size_inv.x, cells_x);
+            const int x1 = WindowsHitGridCell(r.Max.x, bounds.Min.x, cell_size_inv.x, cells_x);
+            const int y0 = WindowsHitGridCell(r.Min.y, bounds.Min.y, cell_size_inv.y, cells_y);
+            const int y1 = WindowsHitGridCell(r.Max.y, bounds.Min.y, cell_size_inv.y, cells_y);
+            for (int y = y0; y <= y1; y++)
+                for (int x = x0; x <= x1; x++)
+                {
+                    if (pass == 0)
+                        offsets[y * cells_x + x + 1]++;
+                    else
+                        grid->WindowsIndices[offsets[y * cells_x + x]++] = window_n;
+                }
+        }
+        if (pass == 0)
+        {
+            for (int n = 1; n < offsets.Size; n++)
+                offsets[n] += offsets[n - 1];
+            grid->WindowsIndices.resize(offsets.back());
+        }
+    }
 
-    return text_size;
+    // Fill pass advanced each offset to the start of the following cell: shift back.
+    for (int n = offsets.Size - 1; n > 0; n--)
+        offsets[n] = offsets[n - 1];
+    offsets[0] = 0;
+
+    grid->Bounds = bounds;
+    grid->CellSizeInv = cell_size_inv;
+    grid->Padding = padding;
+    grid->CellsX = cells_x;
+    grid->CellsY = cells_y;
 }
 
 // Find window given position, search front-to-back
@@ -6014,20 +7050,40 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
 //   with SetWindowPos() and not SetNextWindowPos() will have that rectangle lagging by a frame at the time FindHoveredWindow() is
 //   called, aka before the next Begin(). Moving window isn't affected.
 // - The 'find_first_and_in_any_viewport = true' mode is only used by TestEngine. It is simpler to maintain here.
+// - With many windows, candidates are taken from g.WindowsHitGrid when it is up to date (see UpdateWindowsHitGridEndFrame()).
 void ImGui::FindHoveredWindowEx(const ImVec2& pos, bool find_first_and_in_any_viewport, ImGuiWindow** out_hovered_window, ImGuiWindow** out_hovered_window_under_moving_window)
 {
     ImGuiContext& g = *GImGui;
     ImGuiWindow* hovered_window = NULL;
     ImGuiWindow* hovered_window_under_moving_window = NULL;
+    UpdateWindowsFromDisplayOrder();
 
     if (find_first_and_in_any_viewport == false && g.MovingWindow && !(g.MovingWindow->Flags & ImGuiWindowFlags_NoMouseInputs))
         hovered_window = g.MovingWindow;
 
     ImVec2 padding_regular = g.Style.TouchExtraPadding;
     ImVec2 padding_for_resize = ImMax(g.Style.TouchExtraPadding, ImVec2(g.Style.WindowBorderHoverPadding, g.Style.WindowBorderHoverPadding));
-    for (int i = g.Windows.Size - 1; i >= 0; i--)
+
+    // Use spatial index if available, otherwise linear scan of all windows
+    const ImGuiWindowsHitGrid* grid = &g.WindowsHitGrid;
+    const int* grid_indices = NULL;
+    int candidates_count = g.Windows.Size;
+    if (!grid->Dirty && grid->CellsX > 0 && padding_for_resize.x <= grid->Padding.x && padding_for_resize.y <= grid->Padding.y)
     {
-        ImGuiWindow* window = g.Windows[i];
+        candidates_count = 0;
+        if (grid->Bounds.Contains(pos))
+        {
+            const int x = WindowsHitGridCell(pos.x, grid->Bounds.Min.x, grid->CellSizeInv.x, grid->CellsX);
+            const int y = WindowsHitGridCell(pos.y, grid->Bounds.Min.y, grid->CellSizeInv.y, grid->CellsY);
+            const int cell_n = y * grid->CellsX + x;
+            grid_indices = grid->WindowsIndices.Data + grid->CellsOffsets[cell_n];
+            candidates_count = grid->CellsOffsets[cell_n + 1] - grid->CellsOffsets[cell_n];
+        }
+    }
+
+    for (int i = candidates_count - 1; i >= 0; i--)
+    {
+        ImGuiWindow* window = g.Windows[grid_indices ? grid_indices[i] : i];
         IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
         if (!window->WasActive || window->Hidden)
             continue;
@@ -6478,10 +7534,36 @@ static void InitOrLoadWindowSettings(ImGuiWindow* window, ImGuiWindowSettings* s
 
 static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Windows);
     // Create window the first time
     //IMGUI_DEBUG_LOG("CreateNewWindow '%s', flags = 0x%08X\n", name, flags);
     ImGuiContext& g = *GImGui;
-    ImGuiWindow* window = IM_NEW(ImGuiWindow)(&g, name);
+    ImGuiWindow* window;
+    if (g.WindowsPool.Size > 0)
+    {
+        // Reuse a recycled window instance along with its draw list buffers (see GcRecycleTransientWindows())
+        window = g.WindowsPool.back();
+        g.WindowsPool.pop_back();
+        ImVector<ImDrawCmd> cmd_buffer;
+        ImVector<ImDrawIdx> idx_buffer;
+        ImVector<ImDrawVert> vtx_buffer;
+        cmd_buffer.swap(window->DrawListInst.CmdBuffer);
+        idx_buffer.swap(window->DrawListInst.IdxBuffer);
+        vtx_buffer.swap(window->DrawListInst.VtxBuffer);
+        window->~ImGuiWindow();
+        IM_PLACEMENT_NEW(window) ImGuiWindow(&g, name);
+        cmd_buffer.resize(0);
+        idx_buffer.resize(0);
+        vtx_buffer.resize(0);
+        window->DrawListInst.CmdBuffer.swap(cmd_buffer);
+        window->DrawListInst.IdxBuffer.swap(idx_buffer);
+        window->DrawListInst.VtxBuffer.swap(vtx_buffer);
+        g.WindowsPoolReusedCount++;
+    }
+    else
+    {
+        window = IM_NEW(ImGuiWindow)(&g, name);
+    }
     window->Flags = flags;
     g.WindowsById.SetVoidPtr(window->ID, window);
 
@@ -6493,9 +7575,11 @@ static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
     InitOrLoadWindowSettings(window, settings);
 
     if (flags & ImGuiWindowFlags_NoBringToFrontOnFocus)
-        g.Windows.push_front(window); // Quite slow but rare and only once
+        g.WindowsDisplayOrder.InsertAfter(window, NULL);
     else
-        g.Windows.push_back(window);
+        g.WindowsDisplayOrder.InsertBefore(window, NULL);
+    g.Windows.push_back(window);
+    g.WindowsDisplayOrderChanged = g.WindowsHitGrid.Dirty = true;
 
     return window;
 }
@@ -7237,6 +8321,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     const bool window_just_created = (window == NULL);
     if (window_just_created)
         window = CreateNewWindow(name, flags);
+    IM_PROFILE_SCOPE_WINDOW("Begin", window->ID);
 
     // [DEBUG] Debug break requested by user
     if (g.DebugBreakInWindow == window->ID)
@@ -7266,11 +8351,17 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     if (first_begin_of_the_frame)
     {
         UpdateWindowInFocusOrderList(window, window_just_created, flags);
+        if ((window->Flags ^ flags) & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_Popup | ImGuiWindowFlags_Tooltip)) // Sorting keys, see ChildWindowComparer()
+        {
+            QueueWindowDisplayOrderRelink(window);
+            QueueWindowDisplayOrderRelink(window->ParentWindow);
+        }
         window->Flags = (ImGuiWindowFlags)flags;
         window->ChildFlags = (g.NextWindowData.HasFlags & ImGuiNextWindowDataFlags_HasChildFlags) ? g.NextWindowData.ChildFlags : 0;
         window->LastFrameActive = current_frame;
         window->LastTimeActive = (float)g.Time;
-        window->BeginOrderWithinParent = 0;
+        if (!(flags & ImGuiWindowFlags_ChildWindow))
+            window->BeginOrderWithinParent = 0; // Child windows compare with their previous value below
         window->BeginOrderWithinContext = (short)(g.WindowsActiveCount++);
     }
     else
@@ -7295,6 +8386,9 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     window_stack_data.ParentLastItemDataBackup = g.LastItemData;
     window_stack_data.DisabledOverrideReenable = (flags & ImGuiWindowFlags_Tooltip) && (g.CurrentItemFlags & ImGuiItemFlags_Disabled);
     window_stack_data.DisabledOverrideReenableAlphaBackup = 0.0f;
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    window_stack_data.BeginTime = g.DebugWindowsCostsEnabled ? ImTimeGetMicroseconds() : 0;
+#endif
     ErrorRecoveryStoreState(&window_stack_data.StackSizesInBegin);
     g.StackSizesInBeginForCurrentWindow = &window_stack_data.StackSizesInBegin;
     if (flags & ImGuiWindowFlags_ChildMenu)
@@ -7303,6 +8397,11 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     // Update ->RootWindow and others pointers (before any possible call to FocusWindow)
     if (first_begin_of_the_frame)
     {
+        if ((flags & ImGuiWindowFlags_ChildWindow) && window->ParentWindow != parent_window)
+        {
+            QueueWindowDisplayOrderRelink(window);
+            QueueWindowDisplayOrderRelink(window->ParentWindow);
+        }
         UpdateWindowParentAndRootLinks(window, flags, parent_window);
         window->ParentWindowInBeginStack = parent_window_in_stack;
 
@@ -7573,8 +8672,16 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         if (flags & ImGuiWindowFlags_ChildWindow)
         {
             IM_ASSERT(parent_window && parent_window->Active);
-            window->BeginOrderWithinParent = (short)parent_window->DC.ChildWindows.Size;
-            parent_window->DC.ChildWindows.push_back(window);
+            ImVector<ImGuiWindow*>& siblings = parent_window->DC.ChildWindows;
+            if (window->BeginOrderWithinParent != (short)siblings.Size)
+                QueueWindowDisplayOrderRelink(parent_window); // Submission order changed
+            window->BeginOrderWithinParent = (short)siblings.Size;
+            if (siblings.Size > 0 && ChildWindowComparer(&siblings.back(), &window) > 0)
+            {
+                QueueWindowDisplayOrderRelink(parent_window); // Siblings need sorting
+                parent_window->DC.ChildWindowsNeedSort = true;
+            }
+            siblings.push_back(window);
             if (!(flags & ImGuiWindowFlags_Popup) && !window_pos_set_by_api && !window_is_child_tooltip)
                 window->Pos = parent_window->DC.CursorPos;
         }
@@ -7710,8 +8817,11 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         const ImRect host_rect = ((flags & ImGuiWindowFlags_ChildWindow) && !(flags & ImGuiWindowFlags_Popup) && !window_is_child_tooltip) ? parent_window->ClipRect : viewport_rect;
         const ImRect outer_rect = window->Rect();
         const ImRect title_bar_rect = window->TitleBarRect();
+        const ImRect outer_rect_clipped_prev = window->OuterRectClipped;
         window->OuterRectClipped = outer_rect;
         window->OuterRectClipped.ClipWith(host_rect);
+        if (memcmp(&outer_rect_clipped_prev, &window->OuterRectClipped, sizeof(ImRect)) != 0)
+            g.WindowsHitGrid.Dirty = true;
 
         // Inner rectangle
         // Not affected by window border size. Used by:
@@ -7850,6 +8960,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->DC.TreeDepth = 0;
         window->DC.TreeHasStackDataDepthMask = window->DC.TreeRecordsClippedNodesY2Mask = 0x00;
         window->DC.ChildWindows.resize(0);
+        window->DC.ChildWindowsNeedSort = false;
         window->DC.StateStorage = &window->StateStorage;
         window->DC.CurrentColumns = NULL;
         window->DC.LayoutType = ImGuiLayoutType_Vertical;
@@ -8057,6 +9168,18 @@ void ImGui::End()
     if (g.IO.ConfigErrorRecovery)
         ErrorRecoveryTryToRecoverWindowState(&window_stack_data.StackSizesInBegin);
 
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    // Cost accounting (time spent in this window is also accounted as nested time in parent in Begin stack)
+    if (g.DebugWindowsCostsEnabled)
+    {
+        const ImU64 time_spent = ImTimeGetMicroseconds() - window_stack_data.BeginTime;
+        window->Cost.TimeTotal += time_spent;
+        window->Cost.DrawCmds = window->DrawList->CmdBuffer.Size;
+        if (g.CurrentWindowStack.Size >= 2)
+            g.CurrentWindowStack[g.CurrentWindowStack.Size - 2].Window->Cost.TimeNested += time_spent;
+    }
+#endif
+
     g.CurrentWindowStack.pop_back();
     SetCurrentWindow(g.CurrentWindowStack.Size == 0 ? NULL : g.CurrentWindowStack.back().Window);
 }
@@ -8221,6 +9344,7 @@ bool ImGui::IsWindowAbove(ImGuiWindow* potential_above, ImGuiWindow* potential_b
     if (display_layer_delta != 0)
         return display_layer_delta > 0;
 
+    UpdateWindowsFromDisplayOrder();
     for (int i = g.Windows.Size - 1; i >= 0; i--)
     {
         ImGuiWindow* candidate_window = g.Windows[i];
@@ -8725,6 +9849,7 @@ static void ImGui::UpdateTexturesNewFrame()
     {
         if (atlas->OwnerContext == &g)
         {
+            atlas->RendererHasSdfTextures = (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasSdfTextures) != 0;
             ImFontAtlasUpdateNewFrame(atlas, g.FrameCount, has_textures);
         }
         else
@@ -9903,6 +11028,7 @@ static ImGuiKeyChord GetMergedModsFromKeys()
 
 static void ImGui::UpdateKeyboardInputs()
 {
+    IM_PROFILE_SCOPE("UpdateKeyboardInputs");
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
 
@@ -9970,6 +11096,7 @@ static void ImGui::UpdateKeyboardInputs()
 
 static void ImGui::UpdateMouseInputs()
 {
+    IM_PROFILE_SCOPE("UpdateMouseInputs");
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
 
@@ -10238,6 +11365,7 @@ static void DebugPrintInputEvent(const char* prefix, const ImGuiInputEvent* e)
 // - trickle_fast_inputs = true  : process as many events as possible (successive down/up/down/up will be trickled over several frames so nothing is lost) (new feature in 1.87)
 void ImGui::UpdateInputEvents(bool trickle_fast_inputs)
 {
+    IM_PROFILE_SCOPE("UpdateInputEvents");
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
 
@@ -11078,6 +12206,14 @@ bool ImGui::ItemAdd(const ImRect& bb, ImGuiID id, const ImRect* nav_bb_arg, ImGu
     // (this is an inline copy of IsClippedEx() so we can reuse the is_rect_visible value, otherwise we'd do 'if (IsClippedEx(bb, id)) return false')
     // g.NavActivateId is not necessarily == g.NavId, in the case of remote activation (e.g. shortcuts)
     const bool is_rect_visible = bb.Overlaps(window->ClipRect);
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    if (g.DebugWindowsCostsEnabled)
+    {
+        window->Cost.ItemsSubmitted++;
+        if (!is_rect_visible)
+            window->Cost.ItemsClipped++;
+    }
+#endif
     if (!is_rect_visible)
         if (id == 0 || (id != g.ActiveId && id != g.ActiveIdPreviousFrame && id != g.NavId && id != g.NavActivateId))
             if (!g.ItemUnclipByLog)
@@ -12529,6 +13665,7 @@ ImVec2 ImGui::FindBestWindowPosForPopup(ImGuiWindow* window)
 // - SetWindowFocus()
 // - SetNextWindowFocus()
 // - IsWindowFocused()
+// - ImGuiWindowOrderList [Internal]
 // - UpdateWindowInFocusOrderList() [Internal]
 // - BringWindowToFocusFront() [Internal]
 // - BringWindowToDisplayFront() [Internal]
@@ -12586,14 +13723,72 @@ bool ImGui::IsWindowFocused(ImGuiFocusedFlags flags)
         return (ref_window == cur_window);
 }
 
-static int ImGui::FindWindowFocusIndex(ImGuiWindow* window)
+static inline int& GetWindowOrderIdx(const ImGuiWindowOrderList* list, ImGuiWindow* window)
 {
-    ImGuiContext& g = *GImGui;
-    IM_UNUSED(g);
-    int order = window->FocusOrder;
-    IM_ASSERT(window->RootWindow == window); // No child window (not testing _ChildWindow because of docking)
-    IM_ASSERT(g.WindowsFocusOrder[order] == window);
-    return order;
+    return (list == &window->Ctx->WindowsFocusOrder) ? window->FocusOrderIdx : window->DisplayOrderIdx;
+}
+
+ImGuiWindow* ImGuiWindowOrderList::GetPrev(ImGuiWindow* window) const
+{
+    const int prev_idx = Nodes[GetWindowOrderIdx(this, window)].PrevIdx;
+    return prev_idx >= 0 ? Nodes[prev_idx].Window : NULL;
+}
+
+ImGuiWindow* ImGuiWindowOrderList::GetNext(ImGuiWindow* window) const
+{
+    const int next_idx = Nodes[GetWindowOrderIdx(this, window)].NextIdx;
+    return next_idx >= 0 ? Nodes[next_idx].Window : NULL;
+}
+
+bool ImGuiWindowOrderList::Contains(ImGuiWindow* window) const
+{
+    return GetWindowOrderIdx(this, window) >= 0;
+}
+
+void ImGuiWindowOrderList::InsertAfter(ImGuiWindow* window, ImGuiWindow* prev)
+{
+    int& idx = GetWindowOrderIdx(this, window);
+    IM_ASSERT(idx == -1);
+    if (FreeIdx >= 0)
+    {
+        idx = FreeIdx;
+        FreeIdx = Nodes[idx].NextIdx;
+    }
+    else
+    {
+        idx = Nodes.Size;
+        Nodes.resize(Nodes.Size + 1);
+    }
+    const int prev_idx = prev ? GetWindowOrderIdx(this, prev) : -1;
+    const int next_idx = (prev_idx >= 0) ? Nodes[prev_idx].NextIdx : FirstIdx;
+    ImGuiWindowOrderNode& node = Nodes[idx];
+    node.Window = window;
+    node.PrevIdx = prev_idx;
+    node.NextIdx = next_idx;
+    if (prev_idx >= 0) { Nodes[prev_idx].NextIdx = idx; } else { FirstIdx = idx; }
+    if (next_idx >= 0) { Nodes[next_idx].PrevIdx = idx; } else { LastIdx = idx; }
+    Size++;
+}
+
+void ImGuiWindowOrderList::InsertBefore(ImGuiWindow* window, ImGuiWindow* next)
+{
+    const int prev_idx = next ? Nodes[GetWindowOrderIdx(this, next)].PrevIdx : LastIdx;
+    InsertAfter(window, prev_idx >= 0 ? Nodes[prev_idx].Window : NULL);
+}
+
+void ImGuiWindowOrderList::Remove(ImGuiWindow* window)
+{
+    int& idx = GetWindowOrderIdx(this, window);
+    IM_ASSERT(idx >= 0 && Nodes[idx].Window == window);
+    ImGuiWindowOrderNode& node = Nodes[idx];
+    if (node.PrevIdx >= 0) { Nodes[node.PrevIdx].NextIdx = node.NextIdx; } else { FirstIdx = node.NextIdx; }
+    if (node.NextIdx >= 0) { Nodes[node.NextIdx].PrevIdx = node.PrevIdx; } else { LastIdx = node.PrevIdx; }
+    node.Window = NULL;
+    node.PrevIdx = -1;
+    node.NextIdx = FreeIdx;
+    FreeIdx = idx;
+    idx = -1;
+    Size--;
 }
 
 static void ImGui::UpdateWindowInFocusOrderList(ImGuiWindow* window, bool just_created, ImGuiWindowFlags new_flags)
@@ -12603,19 +13798,9 @@ static void ImGui::UpdateWindowInFocusOrderList(ImGuiWindow* window, bool just_c
     const bool new_is_explicit_child = (new_flags & ImGuiWindowFlags_ChildWindow) != 0 && ((new_flags & ImGuiWindowFlags_Popup) == 0 || (new_flags & ImGuiWindowFlags_ChildMenu) != 0);
     const bool child_flag_changed = new_is_explicit_child != window->IsExplicitChild;
     if ((just_created || child_flag_changed) && !new_is_explicit_child)
-    {
-        IM_ASSERT(!g.WindowsFocusOrder.contains(window));
-        g.WindowsFocusOrder.push_back(window);
-        window->FocusOrder = (short)(g.WindowsFocusOrder.Size - 1);
-    }
+        g.WindowsFocusOrder.InsertBefore(window, NULL);
     else if (!just_created && child_flag_changed && new_is_explicit_child)
-    {
-        IM_ASSERT(g.WindowsFocusOrder[window->FocusOrder] == window);
-        for (int n = window->FocusOrder + 1; n < g.WindowsFocusOrder.Size; n++)
-            g.WindowsFocusOrder[n]->FocusOrder--;
-        g.WindowsFocusOrder.erase(g.WindowsFocusOrder.Data + window->FocusOrder);
-        window->FocusOrder = -1;
-    }
+        g.WindowsFocusOrder.Remove(window);
     window->IsExplicitChild = new_is_explicit_child;
 }
 
@@ -12624,50 +13809,35 @@ void ImGui::BringWindowToFocusFront(ImGuiWindow* window)
     ImGuiContext& g = *GImGui;
     IM_ASSERT(window == window->RootWindow);
 
-    const int cur_order = window->FocusOrder;
-    IM_ASSERT(g.WindowsFocusOrder[cur_order] == window);
-    if (g.WindowsFocusOrder.back() == window)
+    IM_ASSERT(g.WindowsFocusOrder.Contains(window));
+    if (g.WindowsFocusOrder.GetLast() == window)
         return;
-
-    const int new_order = g.WindowsFocusOrder.Size - 1;
-    for (int n = cur_order; n < new_order; n++)
-    {
-        g.WindowsFocusOrder[n] = g.WindowsFocusOrder[n + 1];
-        g.WindowsFocusOrder[n]->FocusOrder--;
-        IM_ASSERT(g.WindowsFocusOrder[n]->FocusOrder == n);
-    }
-    g.WindowsFocusOrder[new_order] = window;
-    window->FocusOrder = (short)new_order;
+    g.WindowsFocusOrder.Remove(window);
+    g.WindowsFocusOrder.InsertBefore(window, NULL);
 }
 
 // Note technically focus related but rather adjacent and close to BringWindowToFocusFront()
 void ImGui::BringWindowToDisplayFront(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
-    ImGuiWindow* current_front_window = g.Windows.back();
+    ImGuiWindow* current_front_window = g.WindowsDisplayOrder.GetLast();
     if (current_front_window == window || current_front_window->RootWindow == window) // Cheap early out (could be better)
         return;
-    for (int i = g.Windows.Size - 2; i >= 0; i--) // We can ignore the top-most window
-        if (g.Windows[i] == window)
-        {
-            memmove(&g.Windows[i], &g.Windows[i + 1], (size_t)(g.Windows.Size - i - 1) * sizeof(ImGuiWindow*));
-            g.Windows[g.Windows.Size - 1] = window;
-            break;
-        }
+    g.WindowsDisplayOrder.Remove(window);
+    g.WindowsDisplayOrder.InsertBefore(window, NULL);
+    QueueWindowDisplayOrderRelink(window);
+    g.WindowsDisplayOrderChanged = g.WindowsHitGrid.Dirty = true;
 }
 
 void ImGui::BringWindowToDisplayBack(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
-    if (g.Windows[0] == window)
+    if (g.WindowsDisplayOrder.GetFirst() == window)
         return;
-    for (int i = 0; i < g.Windows.Size; i++)
-        if (g.Windows[i] == window)
-        {
-            memmove(&g.Windows[1], &g.Windows[0], (size_t)i * sizeof(ImGuiWindow*));
-            g.Windows[0] = window;
-            break;
-        }
+    g.WindowsDisplayOrder.Remove(window);
+    g.WindowsDisplayOrder.InsertAfter(window, NULL);
+    QueueWindowDisplayOrderRelink(window);
+    g.WindowsDisplayOrderChanged = g.WindowsHitGrid.Dirty = true;
 }
 
 void ImGui::BringWindowToDisplayBehind(ImGuiWindow* window, ImGuiWindow* behind_window)
@@ -12676,25 +13846,18 @@ void ImGui::BringWindowToDisplayBehind(ImGuiWindow* window, ImGuiWindow* behind_
     ImGuiContext& g = *GImGui;
     window = window->RootWindow;
     behind_window = behind_window->RootWindow;
-    int pos_wnd = FindWindowDisplayIndex(window);
-    int pos_beh = FindWindowDisplayIndex(behind_window);
-    if (pos_wnd < pos_beh)
-    {
-        size_t copy_bytes = (pos_beh - pos_wnd - 1) * sizeof(ImGuiWindow*);
-        memmove(&g.Windows.Data[pos_wnd], &g.Windows.Data[pos_wnd + 1], copy_bytes);
-        g.Windows[pos_beh - 1] = window;
-    }
-    else
-    {
-        size_t copy_bytes = (pos_wnd - pos_beh) * sizeof(ImGuiWindow*);
-        memmove(&g.Windows.Data[pos_beh + 1], &g.Windows.Data[pos_beh], copy_bytes);
-        g.Windows[pos_beh] = window;
-    }
+    if (window == behind_window || g.WindowsDisplayOrder.GetNext(window) == behind_window)
+        return;
+    g.WindowsDisplayOrder.Remove(window);
+    g.WindowsDisplayOrder.InsertBefore(window, behind_window);
+    QueueWindowDisplayOrderRelink(window);
+    g.WindowsDisplayOrderChanged = g.WindowsHitGrid.Dirty = true;
 }
 
 int ImGui::FindWindowDisplayIndex(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
+    UpdateWindowsFromDisplayOrder();
     return g.Windows.index_from_ptr(g.Windows.find(window));
 }
 
@@ -12763,22 +13926,22 @@ void ImGui::FocusTopMostWindowUnderOne(ImGuiWindow* under_this_window, ImGuiWind
 {
     ImGuiContext& g = *GImGui;
     IM_UNUSED(filter_viewport); // Unused in master branch.
-    int start_idx = g.WindowsFocusOrder.Size - 1;
+    ImGuiWindow* start_window = g.WindowsFocusOrder.GetLast();
     if (under_this_window != NULL)
     {
         // Aim at root window behind us, if we are in a child window that's our own root (see #4640)
-        int offset = -1;
+        bool start_behind = true;
         while (under_this_window->Flags & ImGuiWindowFlags_ChildWindow)
         {
             under_this_window = under_this_window->ParentWindow;
-            offset = 0;
+            start_behind = false;
         }
-        start_idx = FindWindowFocusIndex(under_this_window) + offset;
+        IM_ASSERT(under_this_window->RootWindow == under_this_window && g.WindowsFocusOrder.Contains(under_this_window)); // No child window (not testing _ChildWindow because of docking)
+        start_window = start_behind ? g.WindowsFocusOrder.GetPrev(under_this_window) : under_this_window;
     }
-    for (int i = start_idx; i >= 0; i--)
+    for (ImGuiWindow* window = start_window; window != NULL; window = g.WindowsFocusOrder.GetPrev(window))
     {
         // We may later decide to test for different NoXXXInputs based on the active navigation input (mouse vs nav) but that may feel more confusing to the user.
-        ImGuiWindow* window = g.WindowsFocusOrder[i];
         if (window == ignore_window || !window->WasActive)
             continue;
         if ((window->Flags & (ImGuiWindowFlags_NoMouseInputs | ImGuiWindowFlags_NoNavInputs)) != (ImGuiWindowFlags_NoMouseInputs | ImGuiWindowFlags_NoNavInputs))
@@ -13457,6 +14620,7 @@ float ImGui::GetNavTweakPressedAmount(ImGuiAxis axis)
 
 static void ImGui::NavUpdate()
 {
+    IM_PROFILE_SCOPE("NavUpdate");
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
 
@@ -14155,12 +15319,12 @@ bool ImGui::IsWindowNavFocusable(ImGuiWindow* window)
     return window->WasActive && window == window->RootWindow && !(window->Flags & ImGuiWindowFlags_NoNavFocus);
 }
 
-static ImGuiWindow* FindWindowNavFocusable(int i_start, int i_stop, int dir) // FIXME-OPT O(N)
+static ImGuiWindow* FindWindowNavFocusable(ImGuiWindow* window_start, ImGuiWindow* window_stop, int dir) // FIXME-OPT O(N)
 {
     ImGuiContext& g = *GImGui;
-    for (int i = i_start; i >= 0 && i < g.WindowsFocusOrder.Size && i != i_stop; i += dir)
-        if (ImGui::IsWindowNavFocusable(g.WindowsFocusOrder[i]))
-            return g.WindowsFocusOrder[i];
+    for (ImGuiWindow* window = window_start; window != NULL && window != window_stop; window = (dir < 0) ? g.WindowsFocusOrder.GetPrev(window) : g.WindowsFocusOrder.GetNext(window))
+        if (ImGui::IsWindowNavFocusable(window))
+            return window;
     return NULL;
 }
 
@@ -14171,10 +15335,11 @@ static void NavUpdateWindowingTarget(int focus_change_dir)
     if (g.NavWindowingTarget->Flags & ImGuiWindowFlags_Modal)
         return;
 
-    const int i_current = ImGui::FindWindowFocusIndex(g.NavWindowingTarget);
-    ImGuiWindow* window_target = FindWindowNavFocusable(i_current + focus_change_dir, -INT_MAX, focus_change_dir);
+    ImGuiWindow* window_current = g.NavWindowingTarget;
+    IM_ASSERT(g.WindowsFocusOrder.Contains(window_current));
+    ImGuiWindow* window_target = FindWindowNavFocusable((focus_change_dir < 0) ? g.WindowsFocusOrder.GetPrev(window_current) : g.WindowsFocusOrder.GetNext(window_current), NULL, focus_change_dir);
     if (!window_target)
-        window_target = FindWindowNavFocusable((focus_change_dir < 0) ? (g.WindowsFocusOrder.Size - 1) : 0, i_current, focus_change_dir);
+        window_target = FindWindowNavFocusable((focus_change_dir < 0) ? g.WindowsFocusOrder.GetLast() : g.WindowsFocusOrder.GetFirst(), window_current, focus_change_dir);
     if (window_target) // Don't reset windowing target if there's a single window in the list
     {
         g.NavWindowingTarget = g.NavWindowingTargetAnim = window_target;
@@ -14253,7 +15418,7 @@ static void ImGui::NavUpdateWindowing()
         g.NavWindowingInputSource = g.NavInputSource = ImGuiInputSource_Gamepad;
     }
     if (start_windowing_with_gamepad || start_windowing_with_keyboard)
-        if (ImGuiWindow* window = g.NavWindow ? g.NavWindow : FindWindowNavFocusable(g.WindowsFocusOrder.Size - 1, -INT_MAX, -1))
+        if (ImGuiWindow* window = g.NavWindow ? g.NavWindow : FindWindowNavFocusable(g.WindowsFocusOrder.GetLast(), NULL, -1))
         {
             if (start_windowing_with_keyboard || g.ConfigNavWindowingWithGamepad)
                 g.NavWindowingTarget = g.NavWindowingTargetAnim = window->RootWindow; // Current location
@@ -14438,10 +15603,8 @@ void ImGui::NavUpdateWindowingOverlay()
     Begin("##NavWindowingOverlay", NULL, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings);
     if (g.ContextName[0] != 0)
         SeparatorText(g.ContextName);
-    for (int n = g.WindowsFocusOrder.Size - 1; n >= 0; n--)
+    for (ImGuiWindow* window = g.WindowsFocusOrder.GetLast(); window != NULL; window = g.WindowsFocusOrder.GetPrev(window))
     {
-        ImGuiWindow* window = g.WindowsFocusOrder[n];
-        IM_ASSERT(window != NULL); // Fix static analyzers
         if (!IsWindowNavFocusable(window))
             continue;
         const char* label = window->Name;
@@ -15505,6 +16668,7 @@ static void ImGui::UpdateViewportsNewFrame()
 // - Default clipboard handlers
 // - Default shell function handlers
 // - Default IME handlers
+// - High resolution timer
 //-----------------------------------------------------------------------------
 
 #if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_CLIPBOARD_FUNCTIONS)
@@ -15731,6 +16895,35 @@ static void Platform_SetImeDataFn_DefaultImpl(ImGuiContext*, ImGuiViewport*, ImG
 
 #endif // Default IME handlers
 
+//-----------------------------------------------------------------------------
+
+// Monotonic timer used for internal measurements (e.g. ImFontAtlas::BakeBudgetMicroseconds). Only differences between two values are meaningful.
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+ImU64 ImTimeGetMicroseconds()
+{
+    static LARGE_INTEGER frequency = {};
+    if (frequency.QuadPart == 0)
+        ::QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+    return (ImU64)(counter.QuadPart / frequency.QuadPart) * 1000000 + (ImU64)(counter.QuadPart % frequency.QuadPart) * 1000000 / (ImU64)frequency.QuadPart;
+}
+#elif defined(__unix__) || defined(__APPLE__)
+#include <time.h>
+ImU64 ImTimeGetMicroseconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ImU64)ts.tv_sec * 1000000 + (ImU64)ts.tv_nsec / 1000;
+}
+#else
+#include <chrono>   // Not clock(), which measures CPU time of the process rather than elapsed time
+ImU64 ImTimeGetMicroseconds()
+{
+    return (ImU64)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] METRICS/DEBUGGER WINDOW
 //-----------------------------------------------------------------------------
@@ -15750,6 +16943,7 @@ static void Platform_SetImeDataFn_DefaultImpl(ImGuiContext*, ImGuiViewport*, ImG
 // - DebugNodeDrawCmdShowMeshAndBoundingBox() [Internal]
 // - DebugNodeFont() [Internal]
 // - DebugNodeFontGlyph() [Internal]
+// - DebugNodeProfiler() [Internal]
 // - DebugNodeStorage() [Internal]
 // - DebugNodeTabBar() [Internal]
 // - DebugNodeViewport() [Internal]
@@ -15975,6 +17169,7 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
 
     BeginDisabled();
     CheckboxFlags("io.BackendFlags: RendererHasTextures", &io.BackendFlags, ImGuiBackendFlags_RendererHasTextures);
+    CheckboxFlags("io.BackendFlags: RendererHasSdfTextures", &io.BackendFlags, ImGuiBackendFlags_RendererHasSdfTextures);
     EndDisabled();
     ShowFontSelector("Font");
     //BeginDisabled((io.BackendFlags & ImGuiBackendFlags_RendererHasTextures) == 0);
@@ -16079,6 +17274,45 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
     const int discarded_surface_sqrt = (int)sqrtf((float)atlas->Builder->RectsDiscardedSurface);
     Text("Packed rects: %d, area: about %d px ~%dx%d px", atlas->Builder->RectsPackedCount, atlas->Builder->RectsPackedSurface, packed_surface_sqrt, packed_surface_sqrt);
     Text("incl. Discarded rects: %d, area: about %d px ~%dx%d px", atlas->Builder->RectsDiscardedCount, atlas->Builder->RectsDiscardedSurface, discarded_surface_sqrt, discarded_surface_sqrt);
+    int free_surface = 0, free_surface_largest = 0;
+    for (const ImTextureRect& r : atlas->Builder->FreeRects)
+    {
+        free_surface += r.w * r.h;
+        free_surface_largest = ImMax(free_surface_largest, r.w * r.h);
+    }
+    Text("Free rects: %d, area: %d px, fragmentation: %.0f%%, moved: %d", atlas->Builder->FreeRects.Size, free_surface, free_surface > 0 ? 100.0f * (1.0f - (float)free_surface_largest / free_surface) : 0.0f, atlas->Builder->DefragMovesTotal);
+    SameLine(); MetricsHelpMarker("Space left by discarded rects below the packer skyline, reused for new rects. Rects at the bottom of the texture are moved into it over a few frames.\nFragmentation is the share of free space outside of the largest free rect.");
+    CheckboxFlags("ImFontAtlasFlags_DeferGlyphLoading", &atlas->Flags, ImFontAtlasFlags_DeferGlyphLoading);
+    SameLine(); MetricsHelpMarker("Rasterize new glyphs on following frames instead of immediately. Newly requested glyphs are invisible until loaded.");
+    Text("Deferred glyphs: %d pending, %d loaded total.", atlas->Builder->DeferredGlyphs.Size - atlas->Builder->DeferredGlyphsHead, atlas->Builder->DeferredGlyphsLoadedTotal);
+    SetNextItemWidth(GetFontSize() * 8);
+    InputInt("BakeBudgetGlyphs", &atlas->BakeBudgetGlyphs);
+    SameLine();
+    SetNextItemWidth(GetFontSize() * 8);
+    InputInt("BakeBudgetMicroseconds", &atlas->BakeBudgetMicroseconds);
+    SameLine(); MetricsHelpMarker("Per-frame budget for rasterizing glyphs (0 = no limit). Once exhausted, new font sizes are rendered by scaling the closest existing size until baked on a following frame.");
+    atlas->BakeBudgetGlyphs = ImMax(atlas->BakeBudgetGlyphs, 0);
+    atlas->BakeBudgetMicroseconds = ImMax(atlas->BakeBudgetMicroseconds, 0);
+    Text("Last frame: %d glyphs baked in %d us, %d sizes deferred (%d total).", atlas->Builder->LastFrameBakeGlyphs, atlas->Builder->LastFrameBakeMicroseconds, atlas->Builder->LastFrameBakesDeferred, atlas->Builder->BakesDeferredTotal);
+    SetNextItemWidth(GetFontSize() * 8);
+    SliderInt("TexMaxPages", &atlas->TexMaxPages, 1, 32);
+    SameLine(); MetricsHelpMarker("Use additional textures once the main texture reached TexMaxWidth x TexMaxHeight.");
+    for (int page_n = 1; page_n <= atlas->Builder->Pages.Size; page_n++)
+    {
+        ImFontAtlasPage* page = atlas->Builder->Pages[page_n - 1];
+        if (page->Tex != NULL)
+            BulletText("Page %d: Texture #%03d%s, %d rects, last used frame %d", page_n, page->Tex->UniqueID, page->Tex->UseSdf ? " (SDF)" : "", page->RectsCount, page->LastUsedFrame);
+        else
+            BulletText("Page %d: free", page_n);
+    }
+    if (atlas->Builder->PagesEvictedTotal > 0)
+        Text("Pages evicted: %d", atlas->Builder->PagesEvictedTotal);
+    int tex_memory_target_kb = atlas->TexMemoryTarget / 1024;
+    SetNextItemWidth(GetFontSize() * 8);
+    if (DragInt("TexMemoryTarget", &tex_memory_target_kb, 16.0f, 0, 256 * 1024, tex_memory_target_kb > 0 ? "%d KB" : "Disabled"))
+        atlas->TexMemoryTarget = tex_memory_target_kb * 1024;
+    SameLine(); MetricsHelpMarker("Evict least recently used glyphs when texture memory exceeds this amount. Evicted glyphs are reloaded on demand.");
+    Text("Texture memory: %d KB, glyphs evicted: %d", ImFontAtlasTextureGetMemoryUsage(atlas) / 1024, atlas->Builder->GlyphsEvictedTotal);
 
     ImFontAtlasRectId highlight_r_id = ImFontAtlasRectId_Invalid;
     if (TreeNode("Rects Index", "Rects Index (%d)", atlas->Builder->RectsPackedCount)) // <-- Use count of used rectangles
@@ -16099,7 +17333,7 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
                     if (IsItemHovered())
                         highlight_r_id = id;
                     TableNextColumn();
-                    Image(atlas->TexRef, ImVec2(r.w, r.h), r.uv0, r.uv1);
+                    Image(ImFontAtlasPageGetTexture(atlas, entry.PageIndex)->GetTexRef(), ImVec2(r.w, r.h), r.uv0, r.uv1);
                 }
             EndTable();
         }
@@ -16110,13 +17344,17 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
     // Texture list
     // (ensure the last texture always use the same ID, so we can keep it open neatly)
     ImFontAtlasRect highlight_r;
+    ImTextureData* highlight_tex = NULL;
     if (highlight_r_id != ImFontAtlasRectId_Invalid)
+    {
         atlas->GetCustomRect(highlight_r_id, &highlight_r);
+        highlight_tex = ImFontAtlasPageGetTexture(atlas, ImFontAtlasPackGetRectPage(atlas, highlight_r_id));
+    }
     for (int tex_n = 0; tex_n < atlas->TexList.Size; tex_n++)
     {
         if (tex_n == atlas->TexList.Size - 1)
             SetNextItemOpen(true, ImGuiCond_Once);
-        DebugNodeTexture(atlas->TexList[tex_n], atlas->TexList.Size - 1 - tex_n, (highlight_r_id != ImFontAtlasRectId_Invalid) ? &highlight_r : NULL);
+        DebugNodeTexture(atlas->TexList[tex_n], atlas->TexList.Size - 1 - tex_n, (atlas->TexList[tex_n] == highlight_tex) ? &highlight_r : NULL);
     }
 }
 
@@ -16347,8 +17585,14 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     if (TreeNode("Windows", "Windows (%d)", g.Windows.Size))
     {
         //SetNextItemOpen(true, ImGuiCond_Once);
+        UpdateWindowsFromDisplayOrder();
         DebugNodeWindowsList(&g.Windows, "By display order");
-        DebugNodeWindowsList(&g.WindowsFocusOrder, "By focus order (root windows)");
+        ImVector<ImGuiWindow*> windows_by_focus_order;
+        for (ImGuiWindow* window = g.WindowsFocusOrder.GetFirst(); window != NULL; window = g.WindowsFocusOrder.GetNext(window))
+            windows_by_focus_order.push_back(window);
+        DebugNodeWindowsList(&windows_by_focus_order, "By focus order (root windows)");
+        DebugNodeWindowsCosts();
+        BulletText("Recycled windows pool: %d/%d (recycled %d, reused %d)", g.WindowsPool.Size, IMGUI_WINDOWS_POOL_MAX, g.WindowsPoolRecycledCount, g.WindowsPoolReusedCount);
         if (TreeNode("By submission order (begin stack)"))
         {
             // Here we display windows in their submitted order/hierarchy, however note that the Begin stack doesn't constitute a Parent<>Child relationship!
@@ -16522,12 +17766,58 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
+#ifdef IMGUI_ENABLE_PROFILER
+    DebugNodeProfiler(&g.Profiler);
+#endif
+
     // Settings
     if (TreeNode("Memory allocations"))
     {
         ImGuiDebugAllocInfo* info = &g.DebugAllocInfo;
         Text("%d current allocations", info->TotalAllocCount - info->TotalFreeCount);
         if (SmallButton("GC now")) { g.GcCompactAll = true; }
+        int frame_arena_blocks_size = 0;
+        for (const ImFrameArenaBlock& block : g.FrameArena.Blocks)
+            frame_arena_blocks_size += block.Size;
+        Text("Frame arena: %d KB peak usage, %d KB blocks, %d overflows", g.FrameArena.PeakUsedBytes / 1024, frame_arena_blocks_size / 1024, g.FrameArena.OverflowCount);
+        ImGuiTransientMemoryUsage transient_memory;
+        GcCalcTransientMemoryUsage(&transient_memory);
+        if (TreeNode("TransientMemory", "Transient memory: %d KB, budget: %d KB, freed buffers: %d", transient_memory.BytesTotal / 1024, io.ConfigMemoryCompactBudget / 1024, g.GcTransientMemoryCompactedCount))
+        {
+            static const char* kind_names[ImGuiTransientMemoryKind_COUNT] = { "Windows", "Tables", "Tables temp data", "Text input", "Baked fonts", "Clipper" };
+            for (int kind = 0; kind < ImGuiTransientMemoryKind_COUNT; kind++)
+                BulletText("%s: %d KB", kind_names[kind], transient_memory.Bytes[kind] / 1024);
+            TreePop();
+        }
+#ifdef IMGUI_ENABLE_DEBUG_ALLOC_TAGS
+        if (BeginTable("##alloc_tags", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+        {
+            TableSetupColumn("Tag");
+            TableSetupColumn("Live");
+            TableSetupColumn("Peak");
+            TableSetupColumn("Live count");
+            TableSetupColumn("Allocs/frame");
+            TableSetupColumn("Allocs total");
+            TableHeadersRow();
+            for (int tag = 0; tag < ImGuiAllocTag_COUNT; tag++)
+            {
+                const ImGuiAllocTagStats* stats = DebugGetAllocTagStats((ImGuiAllocTag)tag);
+                TableNextColumn(); TextUnformatted(DebugGetAllocTagName((ImGuiAllocTag)tag));
+                TableNextColumn(); Text("%.1f KB", stats->LiveBytes / 1024.0f);
+                TableNextColumn(); Text("%.1f KB", stats->PeakBytes / 1024.0f);
+                TableNextColumn(); Text("%d", stats->LiveCount);
+                TableNextColumn(); Text("%d", DebugAllocTagsGetLastFrameAllocCount(stats, g.FrameCount));
+                TableNextColumn(); Text("%d", stats->TotalAllocCount);
+            }
+            EndTable();
+        }
+        if (SmallButton("Copy as JSON"))
+        {
+            ImGuiTextBuffer buf;
+            DebugAllocTagsExportJson(&buf);
+            SetClipboardText(buf.c_str());
+        }
+#endif
         Text("Recent frames with allocations:");
         int buf_size = IM_ARRAYSIZE(info->LastEntriesBuf);
         for (int n = buf_size - 1; n >= 0; n--)
@@ -17016,6 +18306,8 @@ void ImGui::DebugNodeFont(ImFont* font)
         {
             const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
             Text("Loader: '%s'", loader->Name ? loader->Name : "N/A");
+            if (src->SdfBakeSize > 0.0f)
+                Text("SDF: baked at %.1fpx for sizes %.1f..%.1f, spread %d px%s", src->SdfBakeSize, src->SdfMinSize, src->SdfMaxSize, src->SdfSpread, atlas->RendererHasSdfTextures ? "" : " (disabled: renderer doesn't support ImGuiBackendFlags_RendererHasSdfTextures)");
 #ifdef IMGUI_ENABLE_FREETYPE
             if (loader->Name != NULL && strcmp(loader->Name, "FreeType") == 0)
             {
@@ -17075,7 +18367,7 @@ void ImGui::DebugNodeFont(ImFont* font)
         if (baked->ContainerFont != font)
             continue;
         PushID(baked_n);
-        if (TreeNode("Glyphs", "Baked at { %.2fpx, d.%.2f }: %d glyphs%s", baked->Size, baked->RasterizerDensity, baked->Glyphs.Size, (baked->LastUsedFrame < atlas->Builder->FrameCount - 1) ? " *Unused*" : ""))
+        if (TreeNode("Glyphs", "Baked at { %.2fpx, d.%.2f%s }: %d glyphs%s", baked->Size, baked->RasterizerDensity, baked->IsSdf ? ", SDF" : "", baked->Glyphs.Size, (baked->LastUsedFrame < atlas->Builder->FrameCount - 1) ? " *Unused*" : ""))
         {
             if (SmallButton("Load all"))
                 for (unsigned int base = 0; base <= IM_UNICODE_CODEPOINT_MAX; base++)
@@ -17084,6 +18376,7 @@ void ImGui::DebugNodeFont(ImFont* font)
             const int surface_sqrt = (int)ImSqrt((float)baked->MetricsTotalSurface);
             Text("Ascent: %f, Descent: %f, Ascent-Descent: %f", baked->Ascent, baked->Descent, baked->Ascent - baked->Descent);
             Text("Texture Area: about %d px ~%dx%d px", baked->MetricsTotalSurface, surface_sqrt, surface_sqrt);
+            Text("Memory: %d bytes (glyphs + index)", (int)baked->GetMemoryUsage());
             for (int src_n = 0; src_n < font->Sources.Size; src_n++)
             {
                 ImFontConfig* src = font->Sources[src_n];
@@ -17164,11 +18457,179 @@ void ImGui::DebugNodeFontGlyph(ImFont* font, const ImFontGlyph* glyph)
     if (glyph->PackId >= 0)
     {
         ImTextureRect* r = ImFontAtlasPackGetRect(font->ContainerAtlas, glyph->PackId);
-        Text("PackId: 0x%X (%dx%d rect at %d,%d)", glyph->PackId, r->w, r->h, r->x, r->y);
+        Text("PackId: 0x%X (%dx%d rect at %d,%d, page %d)", glyph->PackId, r->w, r->h, r->x, r->y, glyph->PageIndex);
     }
     Text("SourceIdx: %d", glyph->SourceIdx);
 }
 
+#ifdef IMGUI_ENABLE_PROFILER
+struct ImGuiProfilerSummaryEntry
+{
+    const ImGuiProfilerEvent* Event;    // First event with this name/window
+    int         Count;
+    ImU64       TotalTime;
+    ImU64       SelfTime;               // Excluding time spent in child events
+};
+
+static int IMGUI_CDECL ProfilerSummaryEntryComparerByTotalTime(const void* lhs, const void* rhs)
+{
+    const ImU64 a = ((const ImGuiProfilerSummaryEntry*)lhs)->TotalTime;
+    const ImU64 b = ((const ImGuiProfilerSummaryEntry*)rhs)->TotalTime;
+    return (a < b) ? +1 : (a > b) ? -1 : 0;
+}
+
+// [DEBUG] Display recorded frames: frame times, timeline of selected frame, and summary of time spent per scope.
+void ImGui::DebugNodeProfiler(ImGuiProfiler* profiler)
+{
+    ImGuiContext& g = *GImGui;
+    if (!TreeNode("Profiler", "Profiler (%d frames)", profiler->FramesCount))
+        return;
+    Checkbox("Pause", &profiler->Paused);
+    SameLine();
+    const bool export_to_clipboard = SmallButton("Copy Chrome trace");
+    SameLine();
+    const bool export_to_file = SmallButton("Save to 'imgui_trace.json'");
+    if (export_to_clipboard || export_to_file)
+    {
+        ImGuiTextBuffer buf;
+        DebugProfilerExportChromeTrace(&buf);
+        if (export_to_clipboard)
+            SetClipboardText(buf.c_str());
+        if (ImFileHandle f = export_to_file ? ImFileOpen("imgui_trace.json", "wb") : NULL)
+        {
+            ImFileWrite(buf.c_str(), sizeof(char), (ImU64)buf.size(), f);
+            ImFileClose(f);
+        }
+    }
+    if (profiler->FramesCount == 0)
+    {
+        TextDisabled("No recorded frame.");
+        TreePop();
+        return;
+    }
+
+    // Frame times, oldest first. Click to select a frame.
+    float frame_times[IMGUI_PROFILER_FRAMES];
+    for (int n = 0; n < profiler->FramesCount; n++)
+    {
+        const ImGuiProfilerFrame* frame = &profiler->Frames[(profiler->FramesIdx + IMGUI_PROFILER_FRAMES - profiler->FramesCount + n) % IMGUI_PROFILER_FRAMES];
+        frame_times[n] = (float)(frame->EndTime - frame->StartTime) / 1000.0f;
+    }
+    PlotHistogram("##FrameTimes", frame_times, profiler->FramesCount, 0, "Frame times (ms)", 0.0f, FLT_MAX, ImVec2(-FLT_MIN, GetTextLineHeight() * 3.0f));
+    if (IsItemHovered() && IsMouseDown(ImGuiMouseButton_Left))
+    {
+        const float t = (g.IO.MousePos.x - g.LastItemData.Rect.Min.x) / ImMax(g.LastItemData.Rect.GetWidth(), 1.0f);
+        profiler->ViewFrameOffset = profiler->FramesCount - 1 - (int)(t * profiler->FramesCount);
+    }
+    profiler->ViewFrameOffset = ImClamp(profiler->ViewFrameOffset, 0, profiler->FramesCount - 1);
+    SetNextItemWidth(GetFontSize() * 10);
+    SliderInt("##FrameOffset", &profiler->ViewFrameOffset, 0, profiler->FramesCount - 1, "%d frames ago");
+    SameLine();
+    SetNextItemWidth(GetFontSize() * 10);
+    SliderFloat("##Zoom", &profiler->ViewZoom, 1.0f, 100.0f, "Zoom %.1fx", ImGuiSliderFlags_Logarithmic);
+
+    const ImGuiProfilerFrame* frame = &profiler->Frames[(profiler->FramesIdx + IMGUI_PROFILER_FRAMES - 1 - profiler->ViewFrameOffset) % IMGUI_PROFILER_FRAMES];
+    Text("Frame %d: %.3f ms, %d events", frame->FrameCount, (frame->EndTime - frame->StartTime) / 1000.0f, frame->Events.Size);
+    if (frame->DroppedEventsCount > 0)
+    {
+        SameLine();
+        TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "(%d dropped: over IMGUI_PROFILER_MAX_EVENTS)", frame->DroppedEventsCount);
+    }
+
+    // Timeline
+    char name_buf[256];
+    int max_depth = 0;
+    for (const ImGuiProfilerEvent& event : frame->Events)
+        max_depth = ImMax(max_depth, event.Depth);
+    const float row_height = GetTextLineHeight() + 2.0f;
+    const float timeline_height = row_height * (max_depth + 1);
+    if (BeginChild("##Timeline", ImVec2(-FLT_MIN, timeline_height + g.Style.ScrollbarSize + g.Style.WindowPadding.y * 2.0f), ImGuiChildFlags_Borders, ImGuiWindowFlags_HorizontalScrollbar))
+    {
+        ImGuiWindow* window = g.CurrentWindow;
+        ImDrawList* draw_list = window->DrawList;
+        const ImVec2 origin = window->DC.CursorPos;
+        const float timeline_width = GetContentRegionAvail().x * profiler->ViewZoom;
+        Dummy(ImVec2(timeline_width, timeline_height));
+        const float scale = timeline_width / (float)ImMax(frame->EndTime - frame->StartTime, (ImU64)1);
+        for (const ImGuiProfilerEvent& event : frame->Events)
+        {
+            const float x1 = origin.x + (float)(event.StartTime - frame->StartTime) * scale;
+            const float x2 = ImMax(origin.x + (float)(event.EndTime - frame->StartTime) * scale, x1 + 1.0f);
+            if (x2 < window->ClipRect.Min.x || x1 > window->ClipRect.Max.x)
+                continue;
+            const ImRect bb(x1, origin.y + event.Depth * row_height, x2, origin.y + (event.Depth + 1) * row_height - 1.0f);
+            const ImU32 name_hash = ImHashStr(event.Name);
+            draw_list->AddRectFilled(bb.Min, bb.Max, ImColor::HSV((name_hash & 0xFF) / 255.0f, 0.50f, 0.65f));
+            const char* name = DebugProfilerGetEventName(&event, name_buf, IM_ARRAYSIZE(name_buf));
+            if (bb.GetWidth() > GetFontSize())
+                RenderTextClipped(bb.Min + ImVec2(2.0f, 1.0f), bb.Max, name, NULL, NULL);
+            if (IsWindowHovered() && IsMouseHoveringRect(bb.Min, bb.Max))
+                SetTooltip("%s\n%.3f ms (depth %d)", name, (event.EndTime - event.StartTime) / 1000.0f, event.Depth);
+        }
+    }
+    EndChild();
+
+    // Summary, by name and window. Use frame arena for temporary storage.
+    if (TreeNode("Summary"))
+    {
+        ImGuiProfilerSummaryEntry* entries = g.FrameArena.AllocArray<ImGuiProfilerSummaryEntry>(frame->Events.Size);
+        int* entry_idx_per_event = g.FrameArena.AllocArray<int>(frame->Events.Size);
+        int* event_idx_per_depth = g.FrameArena.AllocArray<int>(max_depth + 1);
+        for (int depth = 0; depth <= max_depth; depth++)
+            event_idx_per_depth[depth] = -1;
+        int entries_count = 0;
+        ImGuiStorage entries_map;
+        for (int event_n = 0; event_n < frame->Events.Size; event_n++)
+        {
+            const ImGuiProfilerEvent* event = &frame->Events[event_n];
+            const ImGuiID key = ImHashStr(event->Name, 0, event->WindowID);
+            int entry_idx = entries_map.GetInt(key, -1);
+            if (entry_idx == -1)
+            {
+                entry_idx = entries_count++;
+                entries_map.SetInt(key, entry_idx);
+                ImGuiProfilerSummaryEntry* entry = &entries[entry_idx];
+                entry->Event = event;
+                entry->Count = 0;
+                entry->TotalTime = entry->SelfTime = 0;
+            }
+            const ImU64 duration = event->EndTime - event->StartTime;
+            entries[entry_idx].Count++;
+            entries[entry_idx].TotalTime += duration;
+            entries[entry_idx].SelfTime += duration;
+            entry_idx_per_event[event_n] = entry_idx;
+            event_idx_per_depth[event->Depth] = event_n;
+            if (event->Depth > 0 && event_idx_per_depth[event->Depth - 1] != -1) // Parent may be missing if it was dropped
+                entries[entry_idx_per_event[event_idx_per_depth[event->Depth - 1]]].SelfTime -= duration;
+        }
+        ImQsort(entries, (size_t)entries_count, sizeof(ImGuiProfilerSummaryEntry), ProfilerSummaryEntryComparerByTotalTime);
+        if (BeginTable("##Summary", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY, ImVec2(0.0f, GetTextLineHeightWithSpacing() * 16)))
+        {
+            TableSetupScrollFreeze(0, 1);
+            TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch);
+            TableSetupColumn("Calls");
+            TableSetupColumn("Total ms");
+            TableSetupColumn("Self ms");
+            TableHeadersRow();
+            ImGuiListClipper clipper;
+            clipper.Begin(entries_count);
+            while (clipper.Step())
+                for (int entry_n = clipper.DisplayStart; entry_n < clipper.DisplayEnd; entry_n++)
+                {
+                    const ImGuiProfilerSummaryEntry* entry = &entries[entry_n];
+                    TableNextColumn(); TextUnformatted(DebugProfilerGetEventName(entry->Event, name_buf, IM_ARRAYSIZE(name_buf)));
+                    TableNextColumn(); Text("%d", entry->Count);
+                    TableNextColumn(); Text("%.3f", entry->TotalTime / 1000.0f);
+                    TableNextColumn(); Text("%.3f", entry->SelfTime / 1000.0f);
+                }
+            EndTable();
+        }
+        TreePop();
+    }
+    TreePop();
+}
+#endif
+
 // [DEBUG] Display contents of ImGuiStorage
 void ImGui::DebugNodeStorage(ImGuiStorage* storage, const char* label)
 {
@@ -17287,6 +18748,9 @@ void ImGui::DebugNodeWindow(ImGuiWindow* window, const char* label)
     BulletText("Scroll: (%.2f/%.2f,%.2f/%.2f) Scrollbar:%s%s", window->Scroll.x, window->ScrollMax.x, window->Scroll.y, window->ScrollMax.y, window->ScrollbarX ? "X" : "", window->ScrollbarY ? "Y" : "");
     BulletText("Active: %d/%d, WriteAccessed: %d, BeginOrderWithinContext: %d", window->Active, window->WasActive, window->WriteAccessed, (window->Active || window->WasActive) ? window->BeginOrderWithinContext : -1);
     BulletText("Appearing: %d, Hidden: %d (CanSkip %d Cannot %d), SkipItems: %d", window->Appearing, window->Hidden, window->HiddenFramesCanSkipItems, window->HiddenFramesCannotSkipItems, window->SkipItems);
+    const ImGuiWindowCost& cost = window->CostLastFrame;
+    if (g.DebugWindowsCostsEnabled)
+        BulletText("CostLastFrame: Self %d us, Total %d us, Items %d (Clipped %d), TextBytes %d, DrawCmds %d, Allocs %d", (int)cost.GetTimeSelf(), (int)cost.TimeTotal, cost.ItemsSubmitted, cost.ItemsClipped, cost.TextBytes, cost.DrawCmds, cost.AllocCount);
     for (int layer = 0; layer < ImGuiNavLayer_COUNT; layer++)
     {
         ImRect r = window->NavRectRel[layer];
@@ -17355,6 +18819,142 @@ void ImGui::DebugNodeWindowsListByBeginStackParent(ImGuiWindow** windows, int wi
     }
 }
 
+ImU64 ImGuiWindowCost::GetValue(ImGuiWindowCostMetric metric) const
+{
+    switch (metric)
+    {
+    case ImGuiWindowCostMetric_TimeSelf:        return GetTimeSelf();
+    case ImGuiWindowCostMetric_TimeTotal:       return TimeTotal;
+    case ImGuiWindowCostMetric_ItemsSubmitted:  return (ImU64)ItemsSubmitted;
+    case ImGuiWindowCostMetric_ItemsClipped:    return (ImU64)ItemsClipped;
+    case ImGuiWindowCostMetric_TextBytes:       return (ImU64)TextBytes;
+    case ImGuiWindowCostMetric_DrawCmds:        return (ImU64)DrawCmds;
+    case ImGuiWindowCostMetric_AllocCount:      return (ImU64)AllocCount;
+    default: break;
+    }
+    IM_ASSERT(0);
+    return 0;
+}
+
+// Return cost of last complete frame, or NULL if the window wasn't active during that frame.
+// Between EndFrame() and NewFrame() this is the frame which just ended, otherwise it is the previous one.
+static const ImGuiWindowCost* DebugGetWindowCostLastCompleteFrame(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    if (g.WithinFrameScope)
+        return window->WasActive ? &window->CostLastFrame : NULL;
+    return window->Active ? &window->Cost : NULL;
+}
+
+void ImGui::DebugGetWindowsSortedByCost(ImVector<ImGuiWindow*>* out_windows, ImGuiWindowCostMetric metric, bool ascending)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(metric >= 0 && metric < ImGuiWindowCostMetric_COUNT);
+    struct Entry { ImU64 Value; ImGuiWindow* Window; };
+    struct Func
+    {
+        static int IMGUI_CDECL EntryComparerByValueDesc(const void* lhs, const void* rhs)
+        {
+            const Entry* a = (const Entry*)lhs;
+            const Entry* b = (const Entry*)rhs;
+            if (a->Value != b->Value)
+                return (a->Value > b->Value) ? -1 : +1;
+            return a->Window->BeginOrderWithinContext - b->Window->BeginOrderWithinContext;
+        }
+    };
+
+    Entry* entries = g.FrameArena.AllocArray<Entry>(g.Windows.Size);
+    int entries_count = 0;
+    for (ImGuiWindow* window : g.Windows)
+        if (const ImGuiWindowCost* cost = DebugGetWindowCostLastCompleteFrame(window))
+        {
+            Entry entry = { cost->GetValue(metric), window };
+            entries[entries_count++] = entry;
+        }
+    ImQsort(entries, (size_t)entries_count, sizeof(Entry), Func::EntryComparerByValueDesc);
+
+    out_windows->resize(entries_count);
+    for (int n = 0; n < entries_count; n++)
+        (*out_windows)[n] = entries[ascending ? entries_count - 1 - n : n].Window;
+}
+
+void ImGui::DebugNodeWindowsCosts()
+{
+    ImGuiContext& g = *GImGui;
+    if (!TreeNode("Windows costs"))
+        return;
+    g.DebugWindowsCostsRequestFrame = g.FrameCount; // Collect while this is open
+    Checkbox("io.ConfigDebugWindowsCosts", &g.IO.ConfigDebugWindowsCosts);
+    SameLine();
+    MetricsHelpMarker("Collect costs even when this is closed, e.g. to use ImGui::DebugLogWindowsCosts().");
+    TextDisabled("Last complete frame. Self time excludes windows begun in-between (e.g. child windows).");
+
+    const ImGuiTableFlags table_flags = ImGuiTableFlags_Sortable | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY;
+    if (BeginTable("##windowscosts", 1 + ImGuiWindowCostMetric_COUNT, table_flags, ImVec2(0.0f, GetTextLineHeightWithSpacing() * 16)))
+    {
+        const ImGuiTableColumnFlags column_flags = ImGuiTableColumnFlags_PreferSortDescending;
+        TableSetupScrollFreeze(0, 1);
+        TableSetupColumn("Name", ImGuiTableColumnFlags_NoSort | ImGuiTableColumnFlags_WidthStretch);
+        TableSetupColumn("Self (us)", column_flags | ImGuiTableColumnFlags_DefaultSort, 0.0f, ImGuiWindowCostMetric_TimeSelf);
+        TableSetupColumn("Total (us)", column_flags, 0.0f, ImGuiWindowCostMetric_TimeTotal);
+        TableSetupColumn("Items", column_flags, 0.0f, ImGuiWindowCostMetric_ItemsSubmitted);
+        TableSetupColumn("Clipped", column_flags, 0.0f, ImGuiWindowCostMetric_ItemsClipped);
+        TableSetupColumn("Text bytes", column_flags, 0.0f, ImGuiWindowCostMetric_TextBytes);
+        TableSetupColumn("DrawCmds", column_flags, 0.0f, ImGuiWindowCostMetric_DrawCmds);
+        TableSetupColumn("Allocs", column_flags, 0.0f, ImGuiWindowCostMetric_AllocCount);
+        TableHeadersRow();
+
+        // Sort every frame: costs are changing constantly
+        ImGuiWindowCostMetric sort_metric = ImGuiWindowCostMetric_TimeSelf;
+        bool sort_ascending = false;
+        if (ImGuiTableSortSpecs* sort_specs = TableGetSortSpecs())
+            if (sort_specs->SpecsCount > 0)
+            {
+                sort_metric = (ImGuiWindowCostMetric)sort_specs->Specs[0].ColumnUserID;
+                sort_ascending = (sort_specs->Specs[0].SortDirection == ImGuiSortDirection_Ascending);
+            }
+        ImVector<ImGuiWindow*> windows;
+        DebugGetWindowsSortedByCost(&windows, sort_metric, sort_ascending);
+
+        for (ImGuiWindow* window : windows)
+        {
+            const ImGuiWindowCost* cost = DebugGetWindowCostLastCompleteFrame(window);
+            TableNextRow();
+            TableNextColumn();
+            TextUnformatted(window->Name, FindRenderedTextEnd(window->Name));
+            if (IsItemHovered())
+                GetForegroundDrawList(window)->AddRect(window->Pos, window->Pos + window->Size, IM_COL32(255, 255, 0, 255));
+            for (int metric = 0; metric < ImGuiWindowCostMetric_COUNT; metric++)
+            {
+                TableNextColumn();
+                Text("%llu", (unsigned long long)cost->GetValue((ImGuiWindowCostMetric)metric));
+            }
+        }
+        EndTable();
+    }
+    TreePop();
+}
+
+// Log most expensive windows of last complete frame. Can be called e.g. after Render() when the frame was slow.
+void ImGui::DebugLogWindowsCosts(int count)
+{
+    ImGuiContext& g = *GImGui;
+    if (!g.DebugWindowsCostsEnabled)
+    {
+        IMGUI_DEBUG_LOG("[windows] Windows costs are not collected: set io.ConfigDebugWindowsCosts = true.\n");
+        return;
+    }
+    ImVector<ImGuiWindow*> windows;
+    DebugGetWindowsSortedByCost(&windows, ImGuiWindowCostMetric_TimeSelf);
+    IMGUI_DEBUG_LOG("[windows] Frame %d: %d active windows, most expensive by self time:\n", g.WithinFrameScope ? g.FrameCount - 1 : g.FrameCount, windows.Size);
+    for (int n = 0; n < windows.Size && n < count; n++)
+    {
+        const ImGuiWindowCost* cost = DebugGetWindowCostLastCompleteFrame(windows[n]);
+        IMGUI_DEBUG_LOG("[windows] #%d '%s': self %d us, total %d us, items %d (clipped %d), text %d bytes, %d draw cmds, %d allocs\n",
+            n + 1, windows[n]->Name, (int)cost->GetTimeSelf(), (int)cost->TimeTotal, cost->ItemsSubmitted, cost->ItemsClipped, cost->TextBytes, cost->DrawCmds, cost->AllocCount);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] DEBUG LOG WINDOW
 //-----------------------------------------------------------------------------
@@ -17847,10 +19447,16 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList*, const ImDrawList
 void ImGui::DebugNodeFont(ImFont*) {}
 void ImGui::DebugNodeFontGlyphesForSrcMask(ImFont*, ImFontBaked*, int) {}
 void ImGui::DebugNodeStorage(ImGuiStorage*, const char*) {}
+#ifdef IMGUI_ENABLE_PROFILER
+void ImGui::DebugNodeProfiler(ImGuiProfiler*) {}
+#endif
 void ImGui::DebugNodeTabBar(ImGuiTabBar*, const char*) {}
 void ImGui::DebugNodeWindow(ImGuiWindow*, const char*) {}
 void ImGui::DebugNodeWindowSettings(ImGuiWindowSettings*) {}
 void ImGui::DebugNodeWindowsList(ImVector<ImGuiWindow*>*, const char*) {}
+void ImGui::DebugNodeWindowsCosts() {}
+void ImGui::DebugGetWindowsSortedByCost(ImVector<ImGuiWindow*>* out_windows, ImGuiWindowCostMetric, bool) { out_windows->resize(0); }
+void ImGui::DebugLogWindowsCosts(int) {}
 void ImGui::DebugNodeViewport(ImGuiViewportP*) {}
 
 void ImGui::ShowDebugLogWindow(bool*) {}
@@ -1033,6 +1033,7 @@ namespace ImGui
 
     // Text Utilities
     IMGUI_API ImVec2        CalcTextSize(const char* text, const char* text_end = NULL, bool hide_text_after_double_hash = false, float wrap_width = -1.0f);
+    IMGUI_API void          CalcTextSizeBatch(const char* const* texts, const char* const* texts_end, int count, ImVec2* out_sizes, float wrap_width = -1.0f); // same as calling CalcTextSize() on 'count' strings, faster for many short strings (e.g. measuring a column). 'texts_end' may be NULL for zero-terminated strings.
 
     // Color Utilities
     IMGUI_API ImVec4        ColorConvertU32ToFloat4(ImU32 in);
@@ -1119,12 +1120,27 @@ namespace ImGui
     IMGUI_API void          DebugTextEncoding(const char* text);
     IMGUI_API void          DebugFlashStyleColor(ImGuiCol idx);
     IMGUI_API void          DebugStartItemPicker();
+    IMGUI_API void          DebugLogWindowsCosts(int count = 5);                 // Log the 'count' most expensive windows of last frame (by self time) to the Debug Log. Requires io.ConfigDebugWindowsCosts. Also see Metrics->Windows costs.
     IMGUI_API bool          DebugCheckVersionAndDataLayout(const char* version_str, size_t sz_io, size_t sz_style, size_t sz_vec2, size_t sz_vec4, size_t sz_drawvert, size_t sz_drawidx); // This is called by IMGUI_CHECKVERSION() macro.
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     IMGUI_API void          DebugLog(const char* fmt, ...)           IM_FMTARGS(1); // Call via IMGUI_DEBUG_LOG() for maximum stripping in caller code!
     IMGUI_API void          DebugLogV(const char* fmt, va_list args) IM_FMTLIST(1);
 #endif
 
+    // Profiler
+    // - Record time spent between ProfileBegin()/ProfileEnd() during current frame. Displayed in Metrics->Profiler, along with main dear imgui functions.
+    // - Only enabled when IMGUI_ENABLE_PROFILER is defined in imconfig.h, otherwise those are empty and compiled out.
+    // - 'name' is stored as a pointer: use a literal or a string which outlives recorded frames.
+    // - Prefer using a 'ImGui::ProfileScope scope("Name");' variable, which calls ProfileEnd() when leaving the C++ scope.
+#ifdef IMGUI_ENABLE_PROFILER
+    IMGUI_API void          ProfileBegin(const char* name);
+    IMGUI_API void          ProfileEnd();
+#else
+    inline void             ProfileBegin(const char*)   {}
+    inline void             ProfileEnd()                {}
+#endif
+    struct ProfileScope     { ProfileScope(const char* name) { ProfileBegin(name); } ~ProfileScope() { ProfileEnd(); } };
+
     // Memory Allocators
     // - Those functions are not reliant on the current context.
     // - DLL users: heaps and globals are not shared across DLL boundaries! You will need to call SetCurrentContext() + SetAllocatorFunctions()
@@ -1696,12 +1712,13 @@ enum ImGuiConfigFlags_
 // Backend capabilities flags stored in io.BackendFlags. Set by imgui_impl_xxx or custom backend.
 enum ImGuiBackendFlags_
 {
-    ImGuiBackendFlags_None                  = 0,
-    ImGuiBackendFlags_HasGamepad            = 1 << 0,   // Backend Platform supports gamepad and currently has one connected.
-    ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
-    ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if io.ConfigNavMoveSetMousePos is set).
-    ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
-    ImGuiBackendFlags_RendererHasTextures   = 1 << 4,   // Backend Renderer supports ImTextureData requests to create/update/destroy textures. This enables incremental texture updates and texture reloads. See https://github.com/ocornut/imgui/blob/master/docs/BACKENDS.md for instructions on how to upgrade your custom backend.
+    ImGuiBackendFlags_None                   = 0,
+    ImGuiBackendFlags_HasGamepad             = 1 << 0,   // Backend Platform supports gamepad and currently has one connected.
+    ImGuiBackendFlags_HasMouseCursors        = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
+    ImGuiBackendFlags_HasSetMousePos         = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if io.ConfigNavMoveSetMousePos is set).
+    ImGuiBackendFlags_RendererHasVtxOffset   = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasTextures    = 1 << 4,   // Backend Renderer supports ImTextureData requests to create/update/destroy textures. This enables incremental texture updates and texture reloads. See https://github.com/ocornut/imgui/blob/master/docs/BACKENDS.md for instructions on how to upgrade your custom backend.
+    ImGuiBackendFlags_RendererHasSdfTextures = 1 << 5,   // Backend Renderer supports textures with ImTextureData::UseSdf set, by thresholding alpha around 0.5 in its shader. Enables ImFontConfig::SdfBakeSize. Requires ImGuiBackendFlags_RendererHasTextures.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -2396,6 +2413,7 @@ struct ImGuiIO
     bool        ConfigWindowsCopyContentsWithCtrlC; // = false      // [EXPERIMENTAL] CTRL+C copy the contents of focused window into the clipboard. Experimental because: (1) has known issues with nested Begin/End pairs (2) text output quality varies (3) text output is in submission order rather than spatial order.
     bool        ConfigScrollbarScrollByPage;    // = true           // Enable scrolling page by page when clicking outside the scrollbar grab. When disabled, always scroll to clicked location. When enabled, Shift+Click scrolls to clicked location.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    int         ConfigMemoryCompactBudget;      // = 0              // Budget (in bytes) for transient memory buffers (windows draw lists, tables, text input, baked fonts, clipper). When exceeded, the largest and least recently used buffers are freed first. Set to 0 to disable.
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2456,6 +2474,10 @@ struct ImGuiIO
     // Option to audit .ini data
     bool        ConfigDebugIniSettings;         // = false          // Save .ini data with extra comments (particularly helpful for Docking, but makes saving slower)
 
+    // Option to collect per-window costs (time, items, text, draw commands, allocations), see Metrics->Windows->Windows costs and ImGui::DebugLogWindowsCosts().
+    // - Collection has a small cost (e.g. two clock reads per window), so it is disabled by default. It is also enabled while the Metrics node is open.
+    bool        ConfigDebugWindowsCosts;        // = false          // Collect per-window costs every frame.
+
     //------------------------------------------------------------------
     // Platform Identifiers
     // (the imgui_impl_xxxx backend files are setting those up for you)
@@ -3463,6 +3485,7 @@ struct ImTextureData
     int                 UnusedFrames;           // w    r   // In order to facilitate handling Status==WantDestroy in some backend: this is a count successive frames where the texture was not used. Always >0 when Status==WantDestroy.
     unsigned short      RefCount;               // w    r   // Number of contexts using this texture. Used during backend shutdown.
     bool                UseColors;              // w    r   // Tell whether our texture data is known to use colors (rather than just white + alpha).
+    bool                UseSdf;                 // w    r   // Tell whether our texture data stores signed distance fields in alpha (0.5 == glyph edge). Renderer needs to threshold alpha instead of blending it. Only set with ImGuiBackendFlags_RendererHasSdfTextures.
     bool                WantDestroyNextFrame;   // rw   -   // [Internal] Queued to set ImTextureStatus_WantDestroy next frame. May still be used in the current frame.
 
     // Functions
@@ -3494,6 +3517,8 @@ struct ImFontConfig
     void*           FontData;               //          // TTF/OTF data
     int             FontDataSize;           //          // TTF/OTF data size
     bool            FontDataOwnedByAtlas;   // true     // TTF/OTF data ownership taken by the container ImFontAtlas (will delete memory itself).
+    const void*     PrebakedData;           // NULL     // Glyphs prerasterized by 'binary_to_compressed_c -prebake' from the same TTF/OTF data, uncompressed or with -lz4. Imported instead of rasterizing when one of their sizes is first used (stb_truetype loader, no oversampling). Not owned: must persist as long as the font.
+    int             PrebakedDataSize;       //          // Prerasterized glyphs data size
 
     // Options
     bool            MergeMode;              // false    // Merge into previous ImFont, so you can combine multiple inputs font into one ImFont (e.g. ASCII font + icons + Japanese glyphs). You may want to use GlyphOffset.y when merge font of different heights.
@@ -3515,6 +3540,10 @@ struct ImFontConfig
     //unsigned int  FontBuilderFlags;       // --       // [Renamed in 1.92] Ue FontLoaderFlags.
     float           RasterizerMultiply;     // 1.0f     // Linearly brighten (>1.0f) or darken (<1.0f) font output. Brightening small fonts may be a good workaround to make them more readable. This is a silly thing we may remove in the future.
     float           RasterizerDensity;      // 1.0f     // [LEGACY: this only makes sense when ImGuiBackendFlags_RendererHasTextures is not supported] DPI scale multiplier for rasterization. Not altering other font metrics: makes it easy to swap between e.g. a 100% and a 400% fonts for a zooming display, or handle Retina screen. IMPORTANT: If you change this it is expected that you increase/decrease font scale roughly to the inverse of this, otherwise quality may look lowered.
+    float           SdfBakeSize;            // 0.0f     // Bake signed distance fields at this size, and use them for all sizes within SdfMinSize..SdfMaxSize, instead of baking each size. 0.0f = disabled. Requires ImGuiBackendFlags_RendererHasSdfTextures, otherwise regular bakes are used. e.g. 32.0f. When merging fonts, the first source decides.
+    float           SdfMinSize;             // 0.0f     // Smallest size rendered with SDF glyphs. SDF rendering tends to look softer than regular bakes at small sizes.
+    float           SdfMaxSize;             // FLT_MAX  // Largest size rendered with SDF glyphs.
+    ImU8            SdfSpread;              // 4        // Distance in pixels (at SdfBakeSize) encoded on each side of glyph edges. Larger values allow larger magnification and outline effects but use more texture space.
 
     // [Internal]
     ImFontFlags     Flags;                  // Font flags (don't use just yet, will be exposed in upcoming 1.92.X updates)
@@ -3532,11 +3561,13 @@ struct ImFontGlyph
     unsigned int    Colored : 1;        // Flag to indicate glyph is colored and should generally ignore tinting (make it usable with no shift on little-endian as this is used in loops)
     unsigned int    Visible : 1;        // Flag to indicate glyph has no visible pixels (e.g. space). Allow early out when rendering.
     unsigned int    SourceIdx : 4;      // Index of source in parent font
-    unsigned int    Codepoint : 26;     // 0x0000..0x10FFFF
+    unsigned int    Codepoint : 21;     // 0x0000..0x10FFFF
+    unsigned int    PageIndex : 5;      // Atlas page the glyph is stored in. 0 = main texture (ImFontAtlas->TexRef), >0 = secondary page (see ImFontAtlas::TexMaxPages).
     float           AdvanceX;           // Horizontal distance to advance cursor/layout position.
     float           X0, Y0, X1, Y1;     // Glyph corners. Offsets from current cursor/layout position.
-    float           U0, V0, U1, V1;     // Texture coordinates for the current value of ImFontAtlas->TexRef. Cached equivalent of calling GetCustomRect() with PackId.
+    float           U0, V0, U1, V1;     // Texture coordinates for the texture of PageIndex. Cached equivalent of calling GetCustomRect() with PackId.
     int             PackId;             // [Internal] ImFontAtlasRectId value (FIXME: Cold data, could be moved elsewhere?)
+    int             LastUsedFrame;      // [Internal] Last frame the glyph was rendered or loaded. Used for eviction when ImFontAtlas::TexMemoryTarget is set.
 
     ImFontGlyph()   { memset(this, 0, sizeof(*this)); PackId = -1; }
 };
@@ -3581,6 +3612,9 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_DeferGlyphLoading  = 1 << 3,   // Rasterize newly requested glyphs on following frames (up to GlyphLoadMaxPerFrame per frame) instead of immediately. Until then they are invisible but have a correct advance, so layout is unaffected. Avoid stalls when lots of new glyphs (e.g. CJK text) or new sizes appear. Requires ImGuiBackendFlags_RendererHasTextures.
+    ImFontAtlasFlags_FileMapping        = 1 << 4,   // Memory-map font files in AddFontFromFileTTF()/LoadCacheFromDisk() instead of loading them into a heap copy (when supported by the platform). Mappings are shared between atlases and contexts. Files must not be modified nor truncated while in use (that may crash, e.g. SIGBUS on POSIX). Atlases must be created/modified from a single thread.
+    ImFontAtlasFlags_MetricsOnly        = 1 << 5,   // Headless mode: load glyph metrics (advance, bounding box) but never rasterize nor pack glyphs. Text is still rendered as quads but with dummy UVs. Layout and hit-testing are identical. Texture stays small and never grows with glyphs. For test runners, servers, layout validation etc. where nothing is displayed.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -3618,6 +3652,14 @@ struct ImFontAtlas
     IMGUI_API void              CompactCache();             // Compact cached glyphs and texture.
     IMGUI_API void              SetFontLoader(const ImFontLoader* font_loader); // Change font loader at runtime.
 
+    // [BETA] Persistent cache: save texture + packed glyphs, and reload them on next run to skip rasterization.
+    // - Load after adding fonts, and before adding custom rectangles or using the atlas.
+    // - Load functions return false and leave the atlas untouched when data is missing or stale (different fonts, font data, settings, loader or version).
+    IMGUI_API bool              LoadCacheFromDisk(const char* filename);
+    IMGUI_API bool              LoadCacheFromMemory(const void* data, size_t data_size);
+    IMGUI_API bool              SaveCacheToDisk(const char* filename);
+    IMGUI_API void              SaveCacheToMemory(ImVector<unsigned char>* out_data); // Append to 'out_data'.
+
     // As we are transitioning toward a new font system, we expect to obsolete those soon:
     IMGUI_API void              ClearInputData();           // [OBSOLETE] Clear input data (all ImFontConfig structures including sizes, TTF data, glyph ranges, etc.) = all the data used to build the texture and fonts.
     IMGUI_API void              ClearFonts();               // [OBSOLETE] Clear input+output font data (same as ClearInputData() + glyphs storage, UV coordinates).
@@ -3698,6 +3740,11 @@ struct ImFontAtlas
     int                         TexMinHeight;       // Minimum desired texture height. Must be a power of two. Default to 128.
     int                         TexMaxWidth;        // Maximum desired texture width. Must be a power of two. Default to 8192.
     int                         TexMaxHeight;       // Maximum desired texture height. Must be a power of two. Default to 8192.
+    int                         TexMaxPages;        // Maximum number of textures (pages) used for glyphs. Default to 1 (disabled). When >1 and the main texture reached TexMaxWidth x TexMaxHeight, new glyphs are packed into additional pages of the same size instead of repacking, and least recently used pages are recycled when all are full. Consider also lowering TexMaxWidth/TexMaxHeight (e.g. 2048). Max 32. Requires ImGuiBackendFlags_RendererHasTextures.
+    int                         TexMemoryTarget;    // Target texture memory in bytes for the atlas (main texture + pages). Default to 0 (disabled). When exceeded, glyphs unused for a while are evicted (least recently used first) and the texture is compacted. Evicted glyphs are reloaded on demand. Requires ImGuiBackendFlags_RendererHasTextures.
+    int                         GlyphLoadMaxPerFrame; // Maximum number of deferred glyphs rasterized per frame when using ImFontAtlasFlags_DeferGlyphLoading. 0 = no limit. Default to 64.
+    int                         BakeBudgetGlyphs;   // Maximum number of glyphs rasterized per frame before new font sizes stop being baked. 0 = no limit (default). Once exhausted, a font size without an existing bake is rendered by scaling the closest existing size, and the exact size is baked on a following frame. Useful with animated font sizes or rasterizer density changes.
+    int                         BakeBudgetMicroseconds; // Same as BakeBudgetGlyphs but measured in time spent rasterizing glyphs. 0 = no limit (default).
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
 
     // Output
@@ -3711,9 +3758,10 @@ struct ImFontAtlas
     ImTextureData*              TexData;            // Latest texture.
 
     // [Internal]
-    ImVector<ImTextureData*>    TexList;            // Texture list (most often TexList.Size == 1). TexData is always == TexList.back(). DO NOT USE DIRECTLY, USE GetDrawData().Textures[]/GetPlatformIO().Textures[] instead!
+    ImVector<ImTextureData*>    TexList;            // Texture list (most often TexList.Size == 1). TexData is the main texture, additional pages are also stored here (see TexMaxPages). DO NOT USE DIRECTLY, USE GetDrawData().Textures[]/GetPlatformIO().Textures[] instead!
     bool                        Locked;             // Marked as locked during ImGui::NewFrame()..EndFrame() scope if TexUpdates are not supported. Any attempt to modify the atlas will assert.
     bool                        RendererHasTextures;// Copy of (BackendFlags & ImGuiBackendFlags_RendererHasTextures) from supporting context.
+    bool                        RendererHasSdfTextures; // Copy of (BackendFlags & ImGuiBackendFlags_RendererHasSdfTextures) from supporting context.
     bool                        TexIsBuilt;         // Set when texture was built matching current font input. Mostly useful for legacy IsBuilt() call.
     bool                        TexPixelsUseColors; // Tell whether our texture data is known to use colors (rather than just alpha channel), in order to help backend select a format or conversion process.
     ImVec2                      TexUvScale;         // = (1.0f/TexData->TexWidth, 1.0f/TexData->TexHeight). May change as new texture gets created.
@@ -3749,18 +3797,26 @@ struct ImFontAtlas
     //typedef ImFontGlyphRangesBuilder  GlyphRangesBuilder;      // OBSOLETED in 1.67+
 };
 
+// [Internal] Page of ImFontBaked's glyph index, covering 256 consecutive code-points.
+// Pages are allocated on demand, so a single high code-point (e.g. emoji) doesn't grow the index for all code-points below it.
+#define IM_FONTBAKED_INDEX_PAGE_SIZE    256
+struct ImFontBakedIndexPage
+{
+    float                       AdvanceX[IM_FONTBAKED_INDEX_PAGE_SIZE]; // Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this info, and are often bottleneck in large UI). -1.0f when not loaded.
+    ImU16                       Lookup[IM_FONTBAKED_INDEX_PAGE_SIZE];   // Index into ImFontBaked::Glyphs[]. 0xFFFF when not loaded, 0xFFFE when not found in font.
+};
+
 // Font runtime data for a given size
 // Important: pointers to ImFontBaked are only valid for the current frame.
 struct ImFontBaked
 {
     // [Internal] Members: Hot ~20/24 bytes (for CalcTextSize)
-    ImVector<float>             IndexAdvanceX;      // 12-16 // out // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this info, and are often bottleneck in large UI).
+    ImVector<ImFontBakedIndexPage*> IndexPages;     // 12-16 // out // Sparse. Index glyphs by Unicode code-point: IndexPages[c / 256]->AdvanceX[c % 256] and ->Lookup[c % 256]. Pages with no loaded code-points point to a shared read-only empty page.
     float                       FallbackAdvanceX;   // 4     // out // FindGlyph(FallbackChar)->AdvanceX
     float                       Size;               // 4     // in  // Height of characters/line, set during loading (doesn't change after loading)
     float                       RasterizerDensity;  // 4     // in  // Density this is baked at
 
-    // [Internal] Members: Hot ~28/36 bytes (for RenderText loop)
-    ImVector<ImU16>             IndexLookup;        // 12-16 // out // Sparse. Index glyphs by Unicode code-point.
+    // [Internal] Members: Hot ~16/24 bytes (for RenderText loop)
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out // All glyphs.
     int                         FallbackGlyphIndex; // 4     // out // Index of FontFallbackChar
 
@@ -3770,6 +3826,7 @@ struct ImFontBaked
     unsigned int                WantDestroy:1;         // 0  //     // Queued for destroy
     unsigned int                LoadNoFallback:1;      // 0  //     // Disable loading fallback in lower-level calls.
     unsigned int                LoadNoRenderOnLayout:1;// 0  //     // Enable a two-steps mode where CalcTextSize() calls will load AdvanceX *without* rendering/packing glyphs. Only advantagous if you know that the glyph is unlikely to actually be rendered, otherwise it is slower because we'd do one query on the first CalcTextSize and one query on the first Draw.
+    unsigned int                IsSdf:1;               // 0  // out // Glyphs are signed distance fields stored in ImTextureData::UseSdf pages, serving all sizes within ImFontConfig::SdfMinSize..SdfMaxSize (see ImFontConfig::SdfBakeSize).
     int                         LastUsedFrame;         // 4  //     // Record of that time this was bounds
     ImGuiID                     BakedId;            // 4     //     // Unique ID for this baked storage
     ImFont*                     ContainerFont;      // 4-8   // in  // Parent font
@@ -3782,6 +3839,7 @@ struct ImFontBaked
     IMGUI_API ImFontGlyph*      FindGlyphNoFallback(ImWchar c);     // Return NULL if glyph doesn't exist
     IMGUI_API float             GetCharAdvance(ImWchar c);
     IMGUI_API bool              IsGlyphLoaded(ImWchar c);
+    IMGUI_API size_t            GetMemoryUsage() const;             // Glyphs + index, in bytes (for metrics)
 };
 
 // Font flags
@@ -3833,6 +3891,7 @@ struct ImFont
     // 'wrap_width' enable automatic word-wrapping across multiple lines to fit into given width. 0.0f to disable.
     IMGUI_API ImFontBaked*      GetFontBaked(float font_size, float density = -1.0f);  // Get or create baked data for given size
     IMGUI_API ImVec2            CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end = NULL, const char** remaining = NULL); // utf8
+    IMGUI_API void              CalcTextSizeBatch(float size, float wrap_width, const char* const* texts_begin, const char* const* texts_end, int count, ImVec2* out_sizes); // Same as CalcTextSizeA() with max_width = FLT_MAX on 'count' strings, faster. 'texts_end' may be NULL for zero-terminated strings.
     IMGUI_API const char*       CalcWordWrapPosition(float size, const char* text, const char* text_end, float wrap_width);
     IMGUI_API void              RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, ImWchar c, const ImVec4* cpu_fine_clip = NULL);
     IMGUI_API void              RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width = 0.0f, bool cpu_fine_clip = false);
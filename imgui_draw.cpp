@@ -14,6 +14,7 @@ Index of this file:
 // [SECTION] Helpers ShadeVertsXXX functions
 // [SECTION] ImFontConfig
 // [SECTION] ImFontAtlas, ImFontAtlasBuilder
+// [SECTION] ImFontAtlas: persistent cache
 // [SECTION] ImFontAtlas: backend for stb_truetype
 // [SECTION] ImFontAtlas: glyph ranges helpers
 // [SECTION] ImFontGlyphRangesBuilder
@@ -491,6 +492,7 @@ ImDrawList* ImDrawList::CloneOutput() const
 
 void ImDrawList::AddDrawCmd()
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_DrawList);
     ImDrawCmd draw_cmd;
     draw_cmd.ClipRect = _CmdHeader.ClipRect;    // Same as calling ImDrawCmd_HeaderCopy()
     draw_cmd.TexRef = _CmdHeader.TexRef;
@@ -705,6 +707,7 @@ void ImDrawList::_SetTexture(ImTextureRef tex_ref)
 // submit the intermediate results. PrimUnreserve() can be used to release unused allocations.
 void ImDrawList::PrimReserve(int idx_count, int vtx_count)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_DrawList);
     // Large mesh support (when enabled)
     IM_ASSERT_PARANOID(idx_count >= 0 && vtx_count >= 0);
     if (sizeof(ImDrawIdx) == 2 && (_VtxCurrentIdx + vtx_count >= (1 << 16)) && (Flags & ImDrawListFlags_AllowVtxOffset))
@@ -2117,6 +2120,7 @@ void ImDrawListSplitter::ClearFreeMemory()
 
 void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_DrawList);
     IM_UNUSED(draw_list);
     IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
     int old_channels_count = _Channels.Size;
@@ -2411,6 +2415,8 @@ ImFontConfig::ImFontConfig()
     GlyphMaxAdvanceX = FLT_MAX;
     RasterizerMultiply = 1.0f;
     RasterizerDensity = 1.0f;
+    SdfMaxSize = FLT_MAX;
+    SdfSpread = 4;
     EllipsisChar = 0;
 }
 
@@ -2493,6 +2499,7 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlas::ClearFonts()
 //-----------------------------------------------------------------------------
 // - ImFontAtlasUpdateNewFrame()
+// - ImFontAtlasTextureRowXXX() kernels
 // - ImFontAtlasTextureBlockConvert()
 // - ImFontAtlasTextureBlockPostProcess()
 // - ImFontAtlasTextureBlockPostProcessMultiply()
@@ -2530,6 +2537,7 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlasBuildAddFont()
 // - ImFontAtlasBuildSetupFontBakedEllipsis()
 // - ImFontAtlasBuildSetupFontBakedBlanks()
+// - ImFontAtlasBuildSetupFontBakedPrebaked()
 // - ImFontAtlasBuildSetupFontBakedFallback()
 // - ImFontAtlasBuildSetupFontSpecialGlyphs()
 // - ImFontAtlasBuildDiscardBakes()
@@ -2556,12 +2564,26 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlasPackInit()
 // - ImFontAtlasPackAllocRectEntry()
 // - ImFontAtlasPackReuseRectEntry()
+// - ImFontAtlasPackAddFreeRect()
+// - ImFontAtlasPackAllocFreeRect()
 // - ImFontAtlasPackDiscardRect()
+// - ImFontAtlasPageDiscard()
+// - ImFontAtlasPageAlloc()
+// - ImFontAtlasPackAddSdfRect()
+// - ImFontAtlasPagesUpdateNewFrame()
+// - ImFontAtlasBuildEvictGlyph()
+// - ImFontAtlasBuildEvictUnusedGlyphs()
+// - ImFontAtlasBuildCompactEvictedGlyphs()
 // - ImFontAtlasPackAddRect()
+// - ImFontAtlasPackRebuildSkyline()
+// - ImFontAtlasPackDefrag()
 // - ImFontAtlasPackGetRect()
 //-----------------------------------------------------------------------------
-// - ImFontBaked_BuildGrowIndex()
+// - ImFontBaked_BuildGetIndexPage()
+// - ImFontAtlasBuildLoaderLoadGlyph()
 // - ImFontBaked_BuildLoadGlyph()
+// - ImFontBaked_BuildLoadDeferredGlyphs()
+// - ImFontAtlasBuildLoadDeferredGlyphs()
 // - ImFontBaked_BuildLoadGlyphAdvanceX()
 // - ImFontAtlasDebugLogTextureRequests()
 //-----------------------------------------------------------------------------
@@ -2622,6 +2644,26 @@ static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3
 
 #define IM_FONTGLYPH_INDEX_UNUSED           ((ImU16)-1) // 0xFFFF
 #define IM_FONTGLYPH_INDEX_NOT_FOUND        ((ImU16)-2) // 0xFFFE
+#define IM_FONTATLAS_MAX_PAGES              32          // Including main texture. Limited by ImFontGlyph::PageIndex bit count.
+#define IM_FONTATLAS_SDF_PAGE_SIZE          512         // Default size of pages storing SDF glyphs (ImFontConfig::SdfBakeSize)
+
+// Shared read-only page for ImFontBaked::IndexPages[] entries with no loaded code-points, so lookups don't need a NULL check.
+#define IM_FONTBAKED_INDEX_X4(_V)           _V, _V, _V, _V
+IM_STATIC_ASSERT(IM_FONTBAKED_INDEX_PAGE_SIZE == 256);
+static const ImFontBakedIndexPage ImFontBakedIndexPageEmpty =
+{
+    { IM_FONTBAKED_INDEX_X4(IM_FONTBAKED_INDEX_X4(IM_FONTBAKED_INDEX_X4(IM_FONTBAKED_INDEX_X4(-1.0f)))) },
+    { IM_FONTBAKED_INDEX_X4(IM_FONTBAKED_INDEX_X4(IM_FONTBAKED_INDEX_X4(IM_FONTBAKED_INDEX_X4(IM_FONTGLYPH_INDEX_UNUSED)))) },
+};
+#undef IM_FONTBAKED_INDEX_X4
+
+// Return index page for given code-point, NULL if not allocated
+static inline ImFontBakedIndexPage* ImFontBaked_GetIndexPage(ImFontBaked* baked, unsigned int codepoint)
+{
+    const unsigned int page_n = codepoint / IM_FONTBAKED_INDEX_PAGE_SIZE;
+    ImFontBakedIndexPage* index_page = (page_n < (unsigned int)baked->IndexPages.Size) ? baked->IndexPages.Data[page_n] : NULL;
+    return (index_page != &ImFontBakedIndexPageEmpty) ? index_page : NULL;
+}
 
 ImFontAtlas::ImFontAtlas()
 {
@@ -2632,6 +2674,8 @@ ImFontAtlas::ImFontAtlas()
     TexMinHeight = 128;
     TexMaxWidth = 8192;
     TexMaxHeight = 8192;
+    TexMaxPages = 1;
+    GlyphLoadMaxPerFrame = 64;
     TexRef._TexID = ImTextureID_Invalid;
     RendererHasTextures = false; // Assumed false by default, as apps can call e.g Atlas::Build() after backend init and before ImGui can update.
     TexNextUniqueID = 1;
@@ -2722,16 +2766,21 @@ static void ImFontAtlasBuildUpdateRendererHasTexturesFromContext(ImFontAtlas* at
         if (ImGuiContext* imgui_ctx = shared_data->Context)
         {
             atlas->RendererHasTextures = (imgui_ctx->IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures) != 0;
+            atlas->RendererHasSdfTextures = (imgui_ctx->IO.BackendFlags & ImGuiBackendFlags_RendererHasSdfTextures) != 0;
             break;
         }
 }
 
+// Maximum number of rectangles moved by ImFontAtlasPackDefrag() each frame
+#define IM_FONTATLAS_DEFRAG_MAX_MOVES_PER_FRAME     32
+
 // Called by NewFrame() for atlases owned by a context.
 // If you manually manage font atlases, you'll need to call this yourself.
 // - 'frame_count' needs to be provided because we can gc/prioritize baked fonts based on their age.
 // - 'frame_count' may not match those of all imgui contexts using this atlas, as contexts may be updated as different frequencies. But generally you can use ImGui::GetFrameCount() on one of your context.
 void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool renderer_has_textures)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Fonts);
     IM_ASSERT(atlas->Builder == NULL || atlas->Builder->FrameCount < frame_count); // Protection against being called twice.
     atlas->RendererHasTextures = renderer_has_textures;
 
@@ -2755,6 +2804,13 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
     for (ImFont* font : atlas->Fonts)
         font->LastBaked = NULL;
 
+    // Reset per-frame bake budget
+    builder->LastFrameBakeGlyphs = builder->FrameBakeGlyphs;
+    builder->LastFrameBakeMicroseconds = builder->FrameBakeMicroseconds;
+    builder->LastFrameBakesDeferred = builder->FrameBakesDeferred.Size;
+    builder->FrameBakeGlyphs = builder->FrameBakeMicroseconds = 0;
+    builder->FrameBakesDeferred.resize(0);
+
     // Garbage collect BakedPool
     if (builder->BakedDiscardedCount > 0)
     {
@@ -2775,6 +2831,13 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
         builder->BakedDiscardedCount = 0;
     }
 
+    // Evict unused glyphs, compact evicted glyphs, release empty secondary pages
+    if (atlas->TexMemoryTarget > 0 && atlas->RendererHasTextures && !atlas->Locked)
+        ImFontAtlasBuildEvictUnusedGlyphs(atlas);
+    ImFontAtlasBuildCompactEvictedGlyphs(atlas);
+    if (builder->Pages.Size > 0)
+        ImFontAtlasPagesUpdateNewFrame(atlas);
+
     // Update texture status
     for (int tex_n = 0; tex_n < atlas->TexList.Size; tex_n++)
     {
@@ -2824,7 +2887,187 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
             tex_n--;
         }
     }
+
+    // Move a few rectangles into space left by discarded ones
+    if (builder->DefragWanted && atlas->RendererHasTextures && !atlas->Locked)
+        ImFontAtlasPackDefrag(atlas, IM_FONTATLAS_DEFRAG_MAX_MOVES_PER_FRAME);
+
+    // Rasterize glyphs requested during previous frames (ImFontAtlasFlags_DeferGlyphLoading)
+    // If the flag was cleared in the meanwhile, flush everything.
+    if (builder->DeferredGlyphs.Size > 0)
+    {
+        const bool is_deferring = (atlas->Flags & ImFontAtlasFlags_DeferGlyphLoading) && atlas->RendererHasTextures;
+        ImFontAtlasBuildLoadDeferredGlyphs(atlas, (is_deferring && atlas->GlyphLoadMaxPerFrame > 0) ? atlas->GlyphLoadMaxPerFrame : -1);
+    }
+}
+
+// Row kernels used by texture conversion, post-processing and fill.
+// - SSE2 paths process 16 (or 4) pixels at a time. Remaining pixels are processed by the *Scalar() version of each kernel.
+// - SSE2 paths must give bit-exact results with the *Scalar() versions. Both are exposed in imgui_internal.h so this can be tested.
+// - Alpha is always stored at IM_COL32_A_SHIFT == 24, regardless of IMGUI_USE_BGRA_PACKED_COLOR.
+IM_MSVC_RUNTIME_CHECKS_OFF
+void ImFontAtlasTextureRowAlpha8ToRGBA32Scalar(const ImU8* src, ImU32* dst, int w)
+{
+    for (int x = 0; x < w; x++)
+        dst[x] = IM_COL32(255, 255, 255, (unsigned int)src[x]);
+}
+
+void ImFontAtlasTextureRowAlpha8ToRGBA32(const ImU8* src, ImU32* dst, int w)
+{
+    int x = 0;
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i white = _mm_set1_epi32(0x00FFFFFF);
+    for (; x + 16 <= w; x += 16)
+    {
+        const __m128i a = _mm_loadu_si128((const __m128i*)(const void*)(src + x));
+        const __m128i a_lo = _mm_unpacklo_epi8(zero, a); // a << 8 in 16-bit lanes
+        const __m128i a_hi = _mm_unpackhi_epi8(zero, a);
+        _mm_storeu_si128((__m128i*)(void*)(dst + x + 0),  _mm_or_si128(_mm_unpacklo_epi16(zero, a_lo), white));
+        _mm_storeu_si128((__m128i*)(void*)(dst + x + 4),  _mm_or_si128(_mm_unpackhi_epi16(zero, a_lo), white));
+        _mm_storeu_si128((__m128i*)(void*)(dst + x + 8),  _mm_or_si128(_mm_unpacklo_epi16(zero, a_hi), white));
+        _mm_storeu_si128((__m128i*)(void*)(dst + x + 12), _mm_or_si128(_mm_unpackhi_epi16(zero, a_hi), white));
+    }
+#endif
+    ImFontAtlasTextureRowAlpha8ToRGBA32Scalar(src + x, dst + x, w - x);
+}
+
+void ImFontAtlasTextureRowRGBA32ToAlpha8Scalar(const ImU32* src, ImU8* dst, int w)
+{
+    for (int x = 0; x < w; x++)
+        dst[x] = (src[x] >> IM_COL32_A_SHIFT) & 0xFF;
+}
+
+void ImFontAtlasTextureRowRGBA32ToAlpha8(const ImU32* src, ImU8* dst, int w)
+{
+    int x = 0;
+#if defined(IMGUI_ENABLE_SSE2)
+    for (; x + 16 <= w; x += 16)
+    {
+        const __m128i a0 = _mm_srli_epi32(_mm_loadu_si128((const __m128i*)(const void*)(src + x + 0)), 24);
+        const __m128i a1 = _mm_srli_epi32(_mm_loadu_si128((const __m128i*)(const void*)(src + x + 4)), 24);
+        const __m128i a2 = _mm_srli_epi32(_mm_loadu_si128((const __m128i*)(const void*)(src + x + 8)), 24);
+        const __m128i a3 = _mm_srli_epi32(_mm_loadu_si128((const __m128i*)(const void*)(src + x + 12)), 24);
+        _mm_storeu_si128((__m128i*)(void*)(dst + x), _mm_packus_epi16(_mm_packs_epi32(a0, a1), _mm_packs_epi32(a2, a3)));
+    }
+#endif
+    ImFontAtlasTextureRowRGBA32ToAlpha8Scalar(src + x, dst + x, w - x);
+}
+
+void ImFontAtlasTextureRowMultiplyAlpha8Scalar(ImU8* p, int w, float multiply_factor)
+{
+    for (int x = 0; x < w; x++)
+        p[x] = (ImU8)ImMin((unsigned int)(p[x] * multiply_factor), (unsigned int)255);
+}
+
+// SSE2 path clamps before truncating, which gives the same result as the scalar version.
+void ImFontAtlasTextureRowMultiplyAlpha8(ImU8* p, int w, float multiply_factor)
+{
+    int x = 0;
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 factor = _mm_set1_ps(multiply_factor);
+    const __m128 max_value = _mm_set1_ps(255.0f);
+    for (; x + 16 <= w; x += 16)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(const void*)(p + x));
+        const __m128i v_lo = _mm_unpacklo_epi8(v, zero);
+        const __m128i v_hi = _mm_unpackhi_epi8(v, zero);
+        __m128i r[4];
+        r[0] = _mm_unpacklo_epi16(v_lo, zero);
+        r[1] = _mm_unpackhi_epi16(v_lo, zero);
+        r[2] = _mm_unpacklo_epi16(v_hi, zero);
+        r[3] = _mm_unpackhi_epi16(v_hi, zero);
+        for (int n = 0; n < 4; n++)
+            r[n] = _mm_cvttps_epi32(_mm_min_ps(_mm_mul_ps(_mm_cvtepi32_ps(r[n]), factor), max_value));
+        _mm_storeu_si128((__m128i*)(void*)(p + x), _mm_packus_epi16(_mm_packs_epi32(r[0], r[1]), _mm_packs_epi32(r[2], r[3])));
+    }
+#endif
+    ImFontAtlasTextureRowMultiplyAlpha8Scalar(p + x, w - x, multiply_factor);
+}
+
+void ImFontAtlasTextureRowMultiplyRGBA32Scalar(ImU32* p, int w, float multiply_factor)
+{
+    for (int x = 0; x < w; x++)
+    {
+        unsigned int a = ImMin((unsigned int)(((p[x] >> IM_COL32_A_SHIFT) & 0xFF) * multiply_factor), (unsigned int)255);
+        p[x] = IM_COL32((p[x] >> IM_COL32_R_SHIFT) & 0xFF, (p[x] >> IM_COL32_G_SHIFT) & 0xFF, (p[x] >> IM_COL32_B_SHIFT) & 0xFF, a);
+    }
+}
+
+void ImFontAtlasTextureRowMultiplyRGBA32(ImU32* p, int w, float multiply_factor)
+{
+    int x = 0;
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128 factor = _mm_set1_ps(multiply_factor);
+    const __m128 max_value = _mm_set1_ps(255.0f);
+    const __m128i rgb_mask = _mm_set1_epi32(0x00FFFFFF);
+    for (; x + 4 <= w; x += 4)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(const void*)(p + x));
+        const __m128i a = _mm_cvttps_epi32(_mm_min_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(v, 24)), factor), max_value));
+        _mm_storeu_si128((__m128i*)(void*)(p + x), _mm_or_si128(_mm_and_si128(v, rgb_mask), _mm_slli_epi32(a, 24)));
+    }
+#endif
+    ImFontAtlasTextureRowMultiplyRGBA32Scalar(p + x, w - x, multiply_factor);
+}
+
+void ImFontAtlasTextureRowFillRGBA32Scalar(ImU32* p, int w, ImU32 col)
+{
+    for (int x = 0; x < w; x++)
+        p[x] = col;
+}
+
+void ImFontAtlasTextureRowFillRGBA32(ImU32* p, int w, ImU32 col)
+{
+    int x = 0;
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128i v = _mm_set1_epi32((int)col);
+    for (; x + 4 <= w; x += 4)
+        _mm_storeu_si128((__m128i*)(void*)(p + x), v);
+#endif
+    ImFontAtlasTextureRowFillRGBA32Scalar(p + x, w - x, col);
+}
+
+// Convert pre-multiplied BGRA (e.g. FreeType color glyphs) to straight alpha RGBA32.
+// FIXME: Converting pre-multiplied alpha to straight. Doesn't smell good.
+// Adding FLT_MIN to alpha avoids dividing by zero, and clamping before the cast avoids overflowing when alpha == 0.
+#define IM_DE_MULTIPLY(color, alpha) (ImU32)ImMin(255.0f * (float)(color) / (float)((alpha) + FLT_MIN) + 0.5f, 255.0f)
+void ImFontAtlasTextureRowPremulBGRA32ToRGBA32Scalar(const ImU8* src, ImU32* dst, int w)
+{
+    for (int x = 0; x < w; x++)
+    {
+        const ImU8 b = src[x * 4 + 0], g = src[x * 4 + 1], r = src[x * 4 + 2], a = src[x * 4 + 3];
+        dst[x] = IM_COL32(IM_DE_MULTIPLY(r, a), IM_DE_MULTIPLY(g, a), IM_DE_MULTIPLY(b, a), a);
+    }
 }
+#undef IM_DE_MULTIPLY
+
+void ImFontAtlasTextureRowPremulBGRA32ToRGBA32(const ImU8* src, ImU32* dst, int w)
+{
+    int x = 0;
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    const __m128 k255 = _mm_set1_ps(255.0f);
+    const __m128 k_half = _mm_set1_ps(0.5f);
+    const __m128 k_min = _mm_set1_ps(FLT_MIN);
+    for (; x + 4 <= w; x += 4)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(const void*)(src + x * 4)); // B,G,R,A bytes
+        const __m128i a = _mm_srli_epi32(v, 24);
+        const __m128 a_f = _mm_add_ps(_mm_cvtepi32_ps(a), k_min);
+        #define IM_DE_MULTIPLY_SSE(color) _mm_cvttps_epi32(_mm_min_ps(_mm_add_ps(_mm_div_ps(_mm_mul_ps(k255, _mm_cvtepi32_ps(color)), a_f), k_half), k255))
+        const __m128i b = IM_DE_MULTIPLY_SSE(_mm_and_si128(v, mask));
+        const __m128i g = IM_DE_MULTIPLY_SSE(_mm_and_si128(_mm_srli_epi32(v, 8), mask));
+        const __m128i r = IM_DE_MULTIPLY_SSE(_mm_and_si128(_mm_srli_epi32(v, 16), mask));
+        #undef IM_DE_MULTIPLY_SSE
+        const __m128i out = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, IM_COL32_R_SHIFT), _mm_slli_epi32(g, IM_COL32_G_SHIFT)), _mm_or_si128(_mm_slli_epi32(b, IM_COL32_B_SHIFT), _mm_slli_epi32(a, IM_COL32_A_SHIFT)));
+        _mm_storeu_si128((__m128i*)(void*)(dst + x), out);
+    }
+#endif
+    ImFontAtlasTextureRowPremulBGRA32ToRGBA32Scalar(src + x * 4, dst + x, w - x);
+}
+IM_MSVC_RUNTIME_CHECKS_RESTORE
 
 void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h)
 {
@@ -2838,22 +3081,12 @@ void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFo
     else if (src_fmt == ImTextureFormat_Alpha8 && dst_fmt == ImTextureFormat_RGBA32)
     {
         for (int ny = h; ny > 0; ny--, src_pixels += src_pitch, dst_pixels += dst_pitch)
-        {
-            const ImU8* src_p = (const ImU8*)src_pixels;
-            ImU32* dst_p = (ImU32*)(void*)dst_pixels;
-            for (int nx = w; nx > 0; nx--)
-                *dst_p++ = IM_COL32(255, 255, 255, (unsigned int)(*src_p++));
-        }
+            ImFontAtlasTextureRowAlpha8ToRGBA32((const ImU8*)src_pixels, (ImU32*)(void*)dst_pixels, w);
     }
     else if (src_fmt == ImTextureFormat_RGBA32 && dst_fmt == ImTextureFormat_Alpha8)
     {
         for (int ny = h; ny > 0; ny--, src_pixels += src_pitch, dst_pixels += dst_pitch)
-        {
-            const ImU32* src_p = (const ImU32*)(void*)src_pixels;
-            ImU8* dst_p = (ImU8*)dst_pixels;
-            for (int nx = w; nx > 0; nx--)
-                *dst_p++ = ((*src_p++) >> IM_COL32_A_SHIFT) & 0xFF;
-        }
+            ImFontAtlasTextureRowRGBA32ToAlpha8((const ImU32*)(const void*)src_pixels, (ImU8*)dst_pixels, w);
     }
     else
     {
@@ -2865,8 +3098,8 @@ void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFo
 // Post-process hooks may eventually be added here.
 void ImFontAtlasTextureBlockPostProcess(ImFontAtlasPostProcessData* data)
 {
-    // Multiply operator (legacy)
-    if (data->FontSrc->RasterizerMultiply != 1.0f)
+    // Multiply operator (legacy). Not applied to distance fields as it would move glyph edges.
+    if (data->FontSrc->RasterizerMultiply != 1.0f && !data->FontBaked->IsSdf)
         ImFontAtlasTextureBlockPostProcessMultiply(data, data->FontSrc->RasterizerMultiply);
 }
 
@@ -2877,26 +3110,12 @@ void ImFontAtlasTextureBlockPostProcessMultiply(ImFontAtlasPostProcessData* data
     if (data->Format == ImTextureFormat_Alpha8)
     {
         for (int ny = data->Height; ny > 0; ny--, pixels += pitch)
-        {
-            ImU8* p = (ImU8*)pixels;
-            for (int nx = data->Width; nx > 0; nx--, p++)
-            {
-                unsigned int v = ImMin((unsigned int)(*p * multiply_factor), (unsigned int)255);
-                *p = (unsigned char)v;
-            }
-        }
+            ImFontAtlasTextureRowMultiplyAlpha8((ImU8*)pixels, data->Width, multiply_factor);
     }
     else if (data->Format == ImTextureFormat_RGBA32) //-V547
     {
         for (int ny = data->Height; ny > 0; ny--, pixels += pitch)
-        {
-            ImU32* p = (ImU32*)(void*)pixels;
-            for (int nx = data->Width; nx > 0; nx--, p++)
-            {
-                unsigned int a = ImMin((unsigned int)(((*p >> IM_COL32_A_SHIFT) & 0xFF) * multiply_factor), (unsigned int)255);
-                *p = IM_COL32((*p >> IM_COL32_R_SHIFT) & 0xFF, (*p >> IM_COL32_G_SHIFT) & 0xFF, (*p >> IM_COL32_B_SHIFT) & 0xFF, a);
-            }
-        }
+            ImFontAtlasTextureRowMultiplyRGBA32((ImU32*)(void*)pixels, data->Width, multiply_factor);
     }
     else
     {
@@ -2904,7 +3123,7 @@ void ImFontAtlasTextureBlockPostProcessMultiply(ImFontAtlasPostProcessData* data
     }
 }
 
-// Fill with single color. We don't use this directly but it is convenient for anyone working on uploading custom rects.
+// Fill with single color. Used to clear discarded rectangles, also convenient for anyone working on uploading custom rects.
 void ImFontAtlasTextureBlockFill(ImTextureData* dst_tex, int dst_x, int dst_y, int w, int h, ImU32 col)
 {
     if (dst_tex->Format == ImTextureFormat_Alpha8)
@@ -2916,11 +3135,7 @@ void ImFontAtlasTextureBlockFill(ImTextureData* dst_tex, int dst_x, int dst_y, i
     else
     {
         for (int y = 0; y < h; y++)
-        {
-            ImU32* p = (ImU32*)(void*)dst_tex->GetPixelsAt(dst_x, dst_y + y);
-            for (int x = w; x > 0; x--, p++)
-                *p = col;
-        }
+            ImFontAtlasTextureRowFillRGBA32((ImU32*)(void*)dst_tex->GetPixelsAt(dst_x, dst_y + y), w, col);
     }
 }
 
@@ -3000,6 +3215,7 @@ bool ImFontAtlas::Build()
 
 ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg_in)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Fonts);
     // Sanity Checks
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas!");
     IM_ASSERT((font_cfg_in->FontData != NULL && font_cfg_in->FontDataSize > 0) || (font_cfg_in->FontLoader != NULL));
@@ -3078,9 +3294,20 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg_in)
     return font;
 }
 
-// Default font TTF is compressed with stb_compress then base85 encoded (see misc/fonts/binary_to_compressed_c.cpp for encoder)
+// Default font TTF is compressed with the LZ4-style codec (see misc/fonts/binary_to_compressed_c.cpp for encoder)
 static unsigned int stb_decompress_length(const unsigned char* input);
 static unsigned int stb_decompress(unsigned char* output, const unsigned char* input, unsigned int length);
+static unsigned int stb_adler32(unsigned int adler32, unsigned char* buffer, unsigned int buflen);
+static bool         ImLz4IsCompressed(const unsigned char* input, unsigned int input_size);
+static unsigned int ImLz4DecompressLength(const unsigned char* input);
+static unsigned int ImLz4Decompress(unsigned char* output, const unsigned char* input, unsigned int input_size);
+
+// Cheap fingerprint of font data, used along with its size to recognize it (prebaked glyphs, atlas cache) without reading it all.
+// The first 4 KB of TTF/OTF data include the table directory, which stores a checksum of each table.
+static unsigned int ImFontAtlasBuildCalcFontDataKey(const void* font_data, int font_data_size)
+{
+    return stb_adler32(1, (unsigned char*)font_data, (unsigned int)ImMin(font_data_size, 4096));
+}
 static unsigned int Decode85Byte(char c)                                    { return c >= '\\' ? c-36 : c-35; }
 static void         Decode85(const unsigned char* src, unsigned char* dst)
 {
@@ -3094,6 +3321,9 @@ static void         Decode85(const unsigned char* src, unsigned char* dst)
 }
 #ifndef IMGUI_DISABLE_DEFAULT_FONT
 static const char* GetDefaultCompressedFontDataTTF(int* out_size);
+#ifdef IMGUI_ENABLE_PREBAKED_DEFAULT_FONT
+static const void* GetDefaultPrebakedFontData(int* out_size);
+#endif
 #endif
 
 // Load embedded ProggyClean.ttf at size 13, disable oversampling
@@ -3114,6 +3344,11 @@ ImFont* ImFontAtlas::AddFontDefault(const ImFontConfig* font_cfg_template)
     font_cfg.EllipsisChar = (ImWchar)0x0085;
     font_cfg.GlyphOffset.y += 1.0f * IM_TRUNC(font_cfg.SizePixels / 13.0f);  // Add +1 offset per 13 units
 
+#ifdef IMGUI_ENABLE_PREBAKED_DEFAULT_FONT
+    if (font_cfg.PrebakedData == NULL)
+        font_cfg.PrebakedData = GetDefaultPrebakedFontData(&font_cfg.PrebakedDataSize);
+#endif
+
     int ttf_compressed_size = 0;
     const char* ttf_compressed = GetDefaultCompressedFontDataTTF(&ttf_compressed_size);
     return AddFontFromMemoryCompressedTTF(ttf_compressed, ttf_compressed_size, font_cfg.SizePixels, &font_cfg);
@@ -3128,7 +3363,9 @@ ImFont* ImFontAtlas::AddFontFromFileTTF(const char* filename, float size_pixels,
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas!");
     size_t data_size = 0;
-    void* data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
+    void* data = (Flags & ImFontAtlasFlags_FileMapping) ? (void*)ImFileMap(filename, &data_size) : NULL; // Released by ImFontAtlasFontDestroySourceData()
+    if (!data)
+        data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
     if (!data)
     {
         if (font_cfg_template == NULL || (font_cfg_template->Flags & ImFontFlags_NoLoadError) == 0)
@@ -3164,11 +3401,20 @@ ImFont* ImFontAtlas::AddFontFromMemoryTTF(void* font_data, int font_data_size, f
     return AddFont(&font_cfg);
 }
 
+// Accepts data compressed with either stb_compress() or the LZ4-style codec (binary_to_compressed_c.exe -lz4), detected from the stream header.
 ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_data, int compressed_ttf_size, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
-    const unsigned int buf_decompressed_size = stb_decompress_length((const unsigned char*)compressed_ttf_data);
+    const unsigned char* compressed_data = (const unsigned char*)compressed_ttf_data;
+    const bool is_lz4 = ImLz4IsCompressed(compressed_data, (unsigned int)compressed_ttf_size);
+    const unsigned int buf_decompressed_size = is_lz4 ? ImLz4DecompressLength(compressed_data) : stb_decompress_length(compressed_data);
     unsigned char* buf_decompressed_data = (unsigned char*)IM_ALLOC(buf_decompressed_size);
-    stb_decompress(buf_decompressed_data, (const unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size);
+    const unsigned int decompressed_size = is_lz4 ? ImLz4Decompress(buf_decompressed_data, compressed_data, (unsigned int)compressed_ttf_size) : stb_decompress(buf_decompressed_data, compressed_data, (unsigned int)compressed_ttf_size);
+    if (decompressed_size != buf_decompressed_size)
+    {
+        IM_FREE(buf_decompressed_data);
+        IM_ASSERT_USER_ERROR(0, "Could not decompress font data!");
+        return NULL;
+    }
 
     ImFontConfig font_cfg = font_cfg_template ? *font_cfg_template : ImFontConfig();
     IM_ASSERT(font_cfg.FontData == NULL);
@@ -3250,9 +3496,13 @@ ImFontAtlasRectId ImFontAtlas::AddCustomRect(int width, int height, ImFontAtlasR
     if (Builder == NULL)
         ImFontAtlasBuildInit(this);
 
+    // Custom rectangles are always stored in the main texture (TexRef)
+    Builder->LockDisablePages = true;
     ImFontAtlasRectId r_id = ImFontAtlasPackAddRect(this, width, height);
+    Builder->LockDisablePages = false;
     if (r_id == ImFontAtlasRectId_Invalid)
         return ImFontAtlasRectId_Invalid;
+    Builder->RectsIndex[ImFontAtlasRectId_GetIndex(r_id)].IsCustom = 1; // Never evicted
     if (out_r != NULL)
         GetCustomRect(r_id, out_r);
 
@@ -3296,9 +3546,12 @@ ImFontAtlasRectId ImFontAtlas::AddCustomRectFontGlyphForSize(ImFont* font, float
 
     ImFontBaked* baked = font->GetFontBaked(font_size);
 
+    Builder->LockDisablePages = true;
     ImFontAtlasRectId r_id = ImFontAtlasPackAddRect(this, width, height);
+    Builder->LockDisablePages = false;
     if (r_id == ImFontAtlasRectId_Invalid)
         return ImFontAtlasRectId_Invalid;
+    Builder->RectsIndex[ImFontAtlasRectId_GetIndex(r_id)].IsCustom = 1; // Never evicted
     ImTextureRect* r = ImFontAtlasPackGetRect(this, r_id);
     if (RendererHasTextures)
         ImFontAtlasTextureBlockQueueUpload(this, TexData, r->x, r->y, r->w, r->h);
@@ -3333,8 +3586,11 @@ bool ImFontAtlas::GetCustomRect(ImFontAtlasRectId id, ImFontAtlasRect* out_r) co
     out_r->y = r->y;
     out_r->w = r->w;
     out_r->h = r->h;
-    out_r->uv0 = ImVec2((float)(r->x), (float)(r->y)) * TexUvScale;
-    out_r->uv1 = ImVec2((float)(r->x + r->w), (float)(r->y + r->h)) * TexUvScale;
+    const int page_n = ImFontAtlasPackGetRectPage((ImFontAtlas*)this, id); // Glyphs may be stored in secondary pages
+    ImTextureData* tex = ImFontAtlasPageGetTexture((ImFontAtlas*)this, page_n);
+    const ImVec2 uv_scale = (page_n == 0) ? TexUvScale : ImVec2(1.0f / tex->Width, 1.0f / tex->Height);
+    out_r->uv0 = ImVec2((float)(r->x), (float)(r->y)) * uv_scale;
+    out_r->uv1 = ImVec2((float)(r->x + r->w), (float)(r->y + r->h)) * uv_scale;
     return true;
 }
 
@@ -3361,6 +3617,7 @@ bool ImFontAtlasGetMouseCursorTexData(ImFontAtlas* atlas, ImGuiMouseCursor curso
 // When atlas->RendererHasTextures = true, this is only called if no font were loaded.
 void ImFontAtlasBuildMain(ImFontAtlas* atlas)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Fonts);
     IM_ASSERT(!atlas->Locked && "Cannot modify a locked ImFontAtlas!");
     if (atlas->TexData && atlas->TexData->Format != atlas->TexDesiredFormat)
         ImFontAtlasBuildClear(atlas);
@@ -3381,6 +3638,13 @@ void ImFontAtlasBuildMain(ImFontAtlas* atlas)
 
 void ImFontAtlasBuildGetOversampleFactors(ImFontConfig* src, ImFontBaked* baked, int* out_oversample_h, int* out_oversample_v)
 {
+    // Distance fields are interpolated by the renderer, oversampling them would only waste texture space
+    if (baked->IsSdf)
+    {
+        *out_oversample_h = *out_oversample_v = 1;
+        return;
+    }
+
     // Automatically disable horizontal oversampling over size 36
     const float raster_size = baked->Size * baked->RasterizerDensity * src->RasterizerDensity;
     *out_oversample_h = (src->OversampleH != 0) ? src->OversampleH : (raster_size > 36.0f || src->PixelSnapH) ? 1 : 2;
@@ -3621,7 +3885,7 @@ void ImFontAtlasFontSourceAddToFont(ImFontAtlas* atlas, ImFont* font, ImFontConf
 void ImFontAtlasFontDestroySourceData(ImFontAtlas* atlas, ImFontConfig* src)
 {
     IM_UNUSED(atlas);
-    if (src->FontDataOwnedByAtlas)
+    if (src->FontDataOwnedByAtlas && !ImFileUnmap(src->FontData)) // Either mapped by AddFontFromFileTTF() or allocated
         IM_FREE(src->FontData);
     src->FontData = NULL;
     if (src->GlyphExcludeRanges)
@@ -3643,13 +3907,9 @@ static ImFontGlyph* ImFontAtlasBuildSetupFontBakedEllipsis(ImFontAtlas* atlas, I
     if (dot_glyph == NULL)
         return NULL;
     ImFontAtlasRectId dot_r_id = dot_glyph->PackId; // Deep copy to avoid invalidation of glyphs and rect pointers
-    ImTextureRect* dot_r = ImFontAtlasPackGetRect(atlas, dot_r_id);
     const int dot_spacing = 1;
     const float dot_step = (dot_glyph->X1 - dot_glyph->X0) + dot_spacing;
 
-    ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, (dot_r->w * 3 + dot_spacing * 2), dot_r->h);
-    ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
-
     ImFontGlyph glyph_in = {};
     ImFontGlyph* glyph = &glyph_in;
     glyph->Codepoint = font->EllipsisChar;
@@ -3659,16 +3919,37 @@ static ImFontGlyph* ImFontAtlasBuildSetupFontBakedEllipsis(ImFontAtlas* atlas, I
     glyph->X1 = dot_glyph->X0 + dot_step * 3 - dot_spacing;
     glyph->Y1 = dot_glyph->Y1;
     glyph->Visible = true;
+    dot_glyph = NULL; // Invalidated by ImFontAtlasBakedAddFontGlyph()
+
+    // Metrics only mode (ImFontAtlasFlags_MetricsOnly): no pixels to copy
+    if (atlas->Flags & ImFontAtlasFlags_MetricsOnly)
+        return ImFontAtlasBakedAddFontGlyph(atlas, baked, NULL, glyph);
+
+    ImTextureRect* dot_r = ImFontAtlasPackGetRect(atlas, dot_r_id);
+    ImFontAtlasRectId pack_id;
+    if (baked->IsSdf)
+    {
+        pack_id = ImFontAtlasPackAddSdfRect(atlas, (dot_r->w * 3 + dot_spacing * 2), dot_r->h);
+    }
+    else
+    {
+        atlas->Builder->LockDisablePages = true;
+        pack_id = ImFontAtlasPackAddRect(atlas, (dot_r->w * 3 + dot_spacing * 2), dot_r->h);
+        atlas->Builder->LockDisablePages = false;
+    }
+    if (pack_id == ImFontAtlasRectId_Invalid)
+        return NULL;
+    ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
     glyph->PackId = pack_id;
     glyph = ImFontAtlasBakedAddFontGlyph(atlas, baked, NULL, glyph);
-    dot_glyph = NULL; // Invalidated
 
     // Copy to texture, post-process and queue update for backend
     // FIXME-NEWATLAS-V2: Dot glyph is already post-processed as this point, so this would damage it.
     dot_r = ImFontAtlasPackGetRect(atlas, dot_r_id);
-    ImTextureData* tex = atlas->TexData;
+    ImTextureData* dot_tex = ImFontAtlasPageGetTexture(atlas, ImFontAtlasPackGetRectPage(atlas, dot_r_id)); // Dot may be stored in a secondary page
+    ImTextureData* tex = ImFontAtlasPageGetTexture(atlas, ImFontAtlasPackGetRectPage(atlas, pack_id));
     for (int n = 0; n < 3; n++)
-        ImFontAtlasTextureBlockCopy(tex, dot_r->x, dot_r->y, tex, r->x + (dot_r->w + dot_spacing) * n, r->y, dot_r->w, dot_r->h);
+        ImFontAtlasTextureBlockCopy(dot_tex, dot_r->x, dot_r->y, tex, r->x + (dot_r->w + dot_spacing) * n, r->y, dot_r->w, dot_r->h);
     ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, r->w, r->h);
 
     return glyph;
@@ -3683,7 +3964,13 @@ static void ImFontAtlasBuildSetupFontBakedFallback(ImFontBaked* baked)
     ImFont* font = baked->ContainerFont;
     ImFontGlyph* fallback_glyph = NULL;
     if (font->FallbackChar != 0)
+    {
+        // Fallback glyph is stored in the main texture unless it is full
+        ImFontAtlasBuilder* builder = font->ContainerAtlas->Builder;
+        builder->LockPreferMainTexture = true;
         fallback_glyph = baked->FindGlyphNoFallback(font->FallbackChar);
+        builder->LockPreferMainTexture = false;
+    }
     if (fallback_glyph == NULL)
     {
         ImFontGlyph* space_glyph = baked->FindGlyphNoFallback((ImWchar)' ');
@@ -3714,6 +4001,173 @@ static void ImFontAtlasBuildSetupFontBakedBlanks(ImFontAtlas* atlas, ImFontBaked
     }
 }
 
+struct ImFontAtlasPrebakedReader
+{
+    const unsigned char*    Data;
+    const unsigned char*    DataEnd;
+    bool                    Error;
+
+    ImFontAtlasPrebakedReader(const void* data, size_t data_size) { Data = (const unsigned char*)data; DataEnd = Data + data_size; Error = false; }
+    const unsigned char*    Read(size_t size)   { if (Error || size > (size_t)(DataEnd - Data)) { Error = true; return NULL; } const unsigned char* p = Data; Data += size; return p; }
+    unsigned int            ReadU16()           { const unsigned char* p = Read(2); return p ? (p[0] | (p[1] << 8)) : 0; }
+    unsigned int            ReadU32()           { const unsigned char* p = Read(4); return p ? (p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24)) : 0; }
+    float                   ReadF32()           { unsigned int u = ReadU32(); float f; memcpy(&f, &u, sizeof(f)); return f; }
+};
+
+// Decompress and index ImFontConfig::PrebakedData, once per atlas.
+// Invalid data gets an entry with no sizes, so we don't try again.
+static ImFontAtlasPrebakedData* ImFontAtlasBuildGetPrebakedData(ImFontAtlas* atlas, const void* src_data, int src_data_size)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    for (ImFontAtlasPrebakedData* prebaked_data : builder->PrebakedData)
+        if (prebaked_data->SrcData == src_data && prebaked_data->SrcDataSize == src_data_size)
+            return prebaked_data;
+    ImFontAtlasPrebakedData* prebaked_data = IM_NEW(ImFontAtlasPrebakedData)();
+    prebaked_data->SrcData = src_data;
+    prebaked_data->SrcDataSize = src_data_size;
+    builder->PrebakedData.push_back(prebaked_data);
+
+    // Data may be compressed with 'binary_to_compressed_c -lz4'
+    if (ImLz4IsCompressed((const unsigned char*)src_data, (unsigned int)src_data_size))
+    {
+        prebaked_data->DecompressedData.resize((int)ImLz4DecompressLength((const unsigned char*)src_data));
+        if (ImLz4Decompress(prebaked_data->DecompressedData.Data, (const unsigned char*)src_data, (unsigned int)src_data_size) != (unsigned int)prebaked_data->DecompressedData.Size)
+        {
+            prebaked_data->DecompressedData.clear();
+            IM_ASSERT_USER_ERROR(0, "Could not decompress ImFontConfig::PrebakedData!");
+            return prebaked_data;
+        }
+    }
+
+    // Header
+    const unsigned char* data = prebaked_data->GetData();
+    ImFontAtlasPrebakedReader r(data, (size_t)prebaked_data->GetDataSize());
+    const unsigned char* magic = r.Read(4);
+    const unsigned int version = r.ReadU32();
+    prebaked_data->FontDataSize = r.ReadU32();
+    prebaked_data->FontDataKey = r.ReadU32(); // See ImFontAtlasBuildCalcFontDataKey()
+    const unsigned char* loader_name = r.Read(16);
+    const unsigned int sizes_count = r.ReadU32();
+    const bool valid = !r.Error && memcmp(magic, "IMPB", 4) == 0 && version == 1;
+    IM_ASSERT(valid && "Invalid ImFontConfig::PrebakedData! Use 'binary_to_compressed_c -prebake' with either no compression or -lz4.");
+    if (!valid)
+    {
+        prebaked_data->DecompressedData.clear();
+        return prebaked_data;
+    }
+    memcpy(prebaked_data->LoaderName, loader_name, sizeof(prebaked_data->LoaderName));
+
+    // Size table
+    for (unsigned int size_n = 0; size_n < sizes_count && !r.Error; size_n++)
+    {
+        ImFontAtlasPrebakedSize prebaked_size;
+        prebaked_size.Size = r.ReadF32();
+        prebaked_size.GlyphsCount = r.ReadU32();
+        prebaked_size.GlyphsOffset = (unsigned int)(r.Data - data);
+        for (unsigned int glyph_n = 0; glyph_n < prebaked_size.GlyphsCount && !r.Error; glyph_n++)
+        {
+            r.Read(4 + 4 + 2 + 2);
+            const unsigned int w = r.ReadU16(), h = r.ReadU16();
+            r.Read(w * h);
+        }
+        if (!r.Error)
+            prebaked_data->Sizes.push_back(prebaked_size);
+    }
+    if (prebaked_data->Sizes.Size == 0)
+        prebaked_data->DecompressedData.clear();
+    IMGUI_DEBUG_LOG_FONT("[font] Indexed prebaked data: %d sizes, %d bytes\n", prebaked_data->Sizes.Size, prebaked_data->GetDataSize());
+    return prebaked_data;
+}
+
+// Import glyphs prerasterized by 'binary_to_compressed_c -prebake' (see ImFontConfig::PrebakedData) instead of rasterizing them on demand.
+// Only used when they were made from the same font data for the same loader, at the exact size and without oversampling.
+// Positioning is the same as ImGui_ImplStbTrueType_FontBakedLoadGlyph() with no oversampling or density.
+static void ImFontAtlasBuildSetupFontBakedPrebaked(ImFontAtlas* atlas, ImFontBaked* baked)
+{
+    ImFont* font = baked->ContainerFont;
+    ImFontConfig* src = font->Sources[0]; // Only the first source, as it has priority over others for all glyphs
+    const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+    if (src->PrebakedData == NULL || baked->IsSdf || (atlas->Flags & ImFontAtlasFlags_MetricsOnly) || loader->Name == NULL || src->FontNo != 0 || src->SizePixels < 0.0f || font->RemapPairs.Data.Size != 0)
+        return;
+    int oversample_h, oversample_v;
+    ImFontAtlasBuildGetOversampleFactors(src, baked, &oversample_h, &oversample_v);
+    if (oversample_h != 1 || oversample_v != 1 || src->RasterizerDensity * baked->RasterizerDensity != 1.0f)
+        return;
+
+    // Check size table first: most sizes are not prebaked
+    ImFontAtlasPrebakedData* prebaked_data = ImFontAtlasBuildGetPrebakedData(atlas, src->PrebakedData, src->PrebakedDataSize);
+    const ImFontAtlasPrebakedSize* prebaked_size = NULL;
+    for (const ImFontAtlasPrebakedSize& size_entry : prebaked_data->Sizes)
+        if (size_entry.Size == baked->Size)
+        {
+            prebaked_size = &size_entry;
+            break;
+        }
+    if (prebaked_size == NULL || prebaked_data->FontDataSize != (unsigned int)src->FontDataSize || strncmp(prebaked_data->LoaderName, loader->Name, 16) != 0)
+        return;
+    if (ImFontAtlasBuildCalcFontDataKey(src->FontData, src->FontDataSize) != prebaked_data->FontDataKey)
+        return;
+
+    ImFontAtlasPrebakedReader r(prebaked_data->GetData() + prebaked_size->GlyphsOffset, (size_t)prebaked_data->GetDataSize() - prebaked_size->GlyphsOffset);
+
+    const float ref_size = src->SizePixels;
+    const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
+    float font_off_x = (src->GlyphOffset.x * offsets_scale);
+    float font_off_y = (src->GlyphOffset.y * offsets_scale);
+    if (src->PixelSnapH)
+        font_off_x = IM_ROUND(font_off_x);
+    if (src->PixelSnapV)
+        font_off_y = IM_ROUND(font_off_y);
+    font_off_y += IM_ROUND(baked->Ascent);
+
+    int imported_count = 0;
+    for (unsigned int glyph_n = 0; glyph_n < prebaked_size->GlyphsCount; glyph_n++)
+    {
+        const unsigned int codepoint_u32 = r.ReadU32();
+        const float advance_x = r.ReadF32();
+        const int x0 = (ImS16)r.ReadU16();
+        const int y0 = (ImS16)r.ReadU16();
+        const int w = (int)r.ReadU16();
+        const int h = (int)r.ReadU16();
+        const unsigned char* pixels = r.Read((size_t)(w * h));
+        if (r.Error)
+            break;
+        if (codepoint_u32 > IM_UNICODE_CODEPOINT_MAX) // Not representable without IMGUI_USE_WCHAR32
+            continue;
+        const ImWchar codepoint = (ImWchar)codepoint_u32;
+        if (baked->IsGlyphLoaded(codepoint)) // e.g. ' ' loaded by ImFontAtlasBuildSetupFontBakedBlanks()
+            continue;
+        if (src->GlyphExcludeRanges && !ImFontAtlasBuildAcceptCodepointForSource(src, codepoint))
+            continue;
+        if (codepoint == font->EllipsisChar && font->EllipsisAutoBake)
+            continue;
+
+        ImFontGlyph glyph;
+        glyph.Codepoint = codepoint;
+        glyph.AdvanceX = advance_x;
+        if (w > 0 && h > 0)
+        {
+            ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
+            if (pack_id == ImFontAtlasRectId_Invalid)
+            {
+                IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+                break;
+            }
+            ImTextureRect* rect = ImFontAtlasPackGetRect(atlas, pack_id);
+            glyph.X0 = x0 + font_off_x;
+            glyph.Y0 = y0 + font_off_y;
+            glyph.X1 = (x0 + (int)rect->w) + font_off_x;
+            glyph.Y1 = (y0 + (int)rect->h) + font_off_y;
+            glyph.Visible = true;
+            glyph.PackId = pack_id;
+            ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, &glyph, rect, pixels, ImTextureFormat_Alpha8, w);
+        }
+        ImFontAtlasBakedAddFontGlyph(atlas, baked, src, &glyph);
+        imported_count++;
+    }
+    IMGUI_DEBUG_LOG_FONT("[font] Imported %d prebaked glyphs for %.2fpx\n", imported_count, baked->Size);
+}
+
 // Load/identify special glyphs
 // (note that this is called again for fonts with MergeMode)
 void ImFontAtlasBuildSetupFontSpecialGlyphs(ImFontAtlas* atlas, ImFont* font, ImFontConfig* src)
@@ -3760,16 +4214,19 @@ void ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBa
     IM_ASSERT(font->FallbackChar != c && font->EllipsisChar != c); // Unsupported for simplicity
     IM_ASSERT(glyph >= baked->Glyphs.Data && glyph < baked->Glyphs.Data + baked->Glyphs.Size);
     IM_UNUSED(font);
-    baked->IndexLookup[c] = IM_FONTGLYPH_INDEX_UNUSED;
-    baked->IndexAdvanceX[c] = baked->FallbackAdvanceX;
+    ImFontBakedIndexPage* index_page = ImFontBaked_GetIndexPage(baked, c);
+    index_page->Lookup[c % IM_FONTBAKED_INDEX_PAGE_SIZE] = IM_FONTGLYPH_INDEX_UNUSED;
+    index_page->AdvanceX[c % IM_FONTBAKED_INDEX_PAGE_SIZE] = baked->FallbackAdvanceX;
 }
 
-ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id)
+ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id, bool is_sdf)
 {
-    IMGUI_DEBUG_LOG_FONT("[font] Created baked %.2fpx\n", font_size);
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Fonts);
+    IMGUI_DEBUG_LOG_FONT("[font] Created baked %.2fpx%s\n", font_size, is_sdf ? " (SDF)" : "");
     ImFontBaked* baked = atlas->Builder->BakedPool.push_back(ImFontBaked());
     baked->Size = font_size;
     baked->RasterizerDensity = font_rasterizer_density;
+    baked->IsSdf = is_sdf;
     baked->BakedId = baked_id;
     baked->ContainerFont = font;
     baked->LastUsedFrame = atlas->Builder->FrameCount;
@@ -3806,10 +4263,12 @@ ImFontBaked* ImFontAtlasBakedGetClosestMatch(ImFontAtlas* atlas, ImFont* font, f
         for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
         {
             ImFontBaked* baked = &builder->BakedPool[baked_n];
-            if (baked->ContainerFont != font || baked->WantDestroy)
+            if (baked->ContainerFont != font || baked->WantDestroy || baked->IsSdf)
                 continue;
             if (step_n == 0 && baked->RasterizerDensity != font_rasterizer_density) // First try with same density
                 continue;
+            if (baked->Size == font_size) // Same size with another density
+                return baked;
             if (baked->Size > font_size && (closest_larger_match == NULL || baked->Size < closest_larger_match->Size))
                 closest_larger_match = baked;
             if (baked->Size < font_size && (closest_smaller_match == NULL || baked->Size > closest_smaller_match->Size))
@@ -3941,6 +4400,7 @@ static void ImFontAtlasBuildSetTexture(ImFontAtlas* atlas, ImTextureData* tex)
 // Create a new texture, discard previous one
 ImTextureData* ImFontAtlasTextureAdd(ImFontAtlas* atlas, int w, int h)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Fonts);
     ImTextureData* old_tex = atlas->TexData;
     ImTextureData* new_tex;
 
@@ -3988,6 +4448,22 @@ static void ImFontAtlasDebugWriteTexToDisk(ImTextureData* tex, const char* descr
 }
 #endif
 
+// Refresh UV of glyphs stored in the main texture, after their rectangles moved (secondary pages are never repacked)
+static void ImFontAtlasBuildUpdateGlyphsUV(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+        for (ImFontGlyph& glyph : builder->BakedPool[baked_n].Glyphs)
+            if (glyph.PackId != ImFontAtlasRectId_Invalid && glyph.PageIndex == 0)
+            {
+                ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph.PackId);
+                glyph.U0 = (r->x) * atlas->TexUvScale.x;
+                glyph.V0 = (r->y) * atlas->TexUvScale.y;
+                glyph.U1 = (r->x + r->w) * atlas->TexUvScale.x;
+                glyph.V1 = (r->y + r->h) * atlas->TexUvScale.y;
+            }
+}
+
 void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
 {
     ImFontAtlasBuilder* builder = atlas->Builder;
@@ -4013,7 +4489,7 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
 
     for (ImFontAtlasRectEntry& index_entry : builder->RectsIndex)
     {
-        if (index_entry.IsUsed == false)
+        if (index_entry.IsUsed == false || index_entry.PageIndex != 0) // Secondary pages are left untouched
             continue;
         ImTextureRect& old_r = old_rects[index_entry.TargetIndex];
         if (old_r.w == 0 && old_r.h == 0)
@@ -4040,16 +4516,7 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
     builder->RectsDiscardedSurface = 0;
 
     // Patch glyphs UV
-    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
-        for (ImFontGlyph& glyph : builder->BakedPool[baked_n].Glyphs)
-            if (glyph.PackId != ImFontAtlasRectId_Invalid)
-            {
-                ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph.PackId);
-                glyph.U0 = (r->x) * atlas->TexUvScale.x;
-                glyph.V0 = (r->y) * atlas->TexUvScale.y;
-                glyph.U1 = (r->x + r->w) * atlas->TexUvScale.x;
-                glyph.V1 = (r->y + r->h) * atlas->TexUvScale.y;
-            }
+    ImFontAtlasBuildUpdateGlyphsUV(atlas);
 
     // Update other cached UV
     ImFontAtlasBuildUpdateLinesTexData(atlas);
@@ -4110,6 +4577,12 @@ ImVec2i ImFontAtlasTextureGetSizeEstimate(ImFontAtlas* atlas)
 {
     int min_w = ImUpperPowerOfTwo(atlas->TexMinWidth);
     int min_h = ImUpperPowerOfTwo(atlas->TexMinHeight);
+    if (atlas->Flags & ImFontAtlasFlags_MetricsOnly)
+    {
+        // Glyphs are never packed: only need room for mouse cursors and baked lines.
+        min_w = ImMin(min_w, 256);
+        min_h = ImMin(min_h, 128);
+    }
     if (atlas->Builder == NULL || atlas->TexData == NULL || atlas->TexData->Status == ImTextureStatus_WantDestroy)
         return ImVec2i(min_w, min_h);
 
@@ -4191,7 +4664,10 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
 
     // Create initial texture size
     if (atlas->TexData == NULL || atlas->TexData->Pixels == NULL)
-        ImFontAtlasTextureAdd(atlas, ImUpperPowerOfTwo(atlas->TexMinWidth), ImUpperPowerOfTwo(atlas->TexMinHeight));
+    {
+        ImVec2i tex_size = ImFontAtlasTextureGetSizeEstimate(atlas);
+        ImFontAtlasTextureAdd(atlas, tex_size.x, tex_size.y);
+    }
 
     atlas->Builder = IM_NEW(ImFontAtlasBuilder)();
     if (atlas->FontLoader->LoaderInit)
@@ -4224,6 +4700,17 @@ void ImFontAtlasBuildDestroy(ImFontAtlas* atlas)
         atlas->FontLoader->LoaderShutdown(atlas);
         IM_ASSERT(atlas->FontLoaderData == NULL);
     }
+    if (atlas->Builder)
+    {
+        for (ImFontAtlasPage* page : atlas->Builder->Pages)
+        {
+            if (page->Tex != NULL)
+                page->Tex->WantDestroyNextFrame = true;
+            IM_DELETE(page);
+        }
+        for (ImFontAtlasPrebakedData* prebaked_data : atlas->Builder->PrebakedData)
+            IM_DELETE(prebaked_data);
+    }
     IM_DELETE(atlas->Builder);
     atlas->Builder = NULL;
 }
@@ -4241,10 +4728,12 @@ void ImFontAtlasPackInit(ImFontAtlas * atlas)
     builder->RectsPackedSurface = builder->RectsPackedCount = 0;
     builder->MaxRectSize = ImVec2i(0, 0);
     builder->MaxRectBounds = ImVec2i(0, 0);
+    builder->FreeRects.resize(0);
+    builder->DefragWanted = false;
 }
 
 // This is essentially a free-list pattern, it may be nice to wrap it into a dedicated type.
-static ImFontAtlasRectId ImFontAtlasPackAllocRectEntry(ImFontAtlas* atlas, int rect_idx)
+static ImFontAtlasRectId ImFontAtlasPackAllocRectEntry(ImFontAtlas* atlas, int rect_idx, int page_n = 0)
 {
     ImFontAtlasBuilder* builder = (ImFontAtlasBuilder*)atlas->Builder;
     int index_idx;
@@ -4265,6 +4754,8 @@ static ImFontAtlasRectId ImFontAtlasPackAllocRectEntry(ImFontAtlas* atlas, int r
     }
     index_entry->TargetIndex = rect_idx;
     index_entry->IsUsed = 1;
+    index_entry->PageIndex = page_n;
+    index_entry->IsCustom = 0;
     return ImFontAtlasRectId_Make(index_idx, index_entry->Generation);
 }
 
@@ -4277,7 +4768,73 @@ static ImFontAtlasRectId ImFontAtlasPackReuseRectEntry(ImFontAtlas* atlas, ImFon
     return ImFontAtlasRectId_Make(index_idx, index_entry->Generation);
 }
 
-// This is expected to be called in batches and followed by a repack
+// Free rectangles are the footprint of discarded rectangles in the main texture, padding included.
+// They are always below the packer skyline, so stb_rect_pack never hands out the same pixels.
+static void ImFontAtlasPackAddFreeRect(ImFontAtlasBuilder* builder, int x, int y, int w, int h)
+{
+    // Merge with neighbors sharing a full edge, restarting the search as the merged rectangle may now touch others.
+    for (int n = 0; n < builder->FreeRects.Size; n++)
+    {
+        const ImTextureRect& fr = builder->FreeRects[n];
+        if (fr.y == y && fr.h == h && (fr.x + fr.w == x || x + w == fr.x))
+        {
+            x = ImMin(x, (int)fr.x);
+            w += fr.w;
+        }
+        else if (fr.x == x && fr.w == w && (fr.y + fr.h == y || y + h == fr.y))
+        {
+            y = ImMin(y, (int)fr.y);
+            h += fr.h;
+        }
+        else
+        {
+            continue;
+        }
+        builder->FreeRects.erase_unsorted(&fr);
+        n = -1;
+    }
+    ImTextureRect r = { (unsigned short)x, (unsigned short)y, (unsigned short)w, (unsigned short)h };
+    builder->FreeRects.push_back(r);
+    builder->DefragWanted = true;
+}
+
+// Allocate a w*h area (padding included) from the smallest fitting free rectangle, with its bottom edge no lower than 'max_y'.
+// The remaining space is split in two, keeping the largest remainder in one piece.
+static bool ImFontAtlasPackAllocFreeRect(ImFontAtlasBuilder* builder, int w, int h, int max_y, int* out_x, int* out_y)
+{
+    int best_n = -1;
+    int best_waste = INT_MAX;
+    for (int n = 0; n < builder->FreeRects.Size && best_waste > 0; n++)
+    {
+        const ImTextureRect& fr = builder->FreeRects[n];
+        if (fr.w < w || fr.h < h || fr.y + h > max_y)
+            continue;
+        const int waste = fr.w * fr.h - w * h;
+        if (waste < best_waste)
+        {
+            best_n = n;
+            best_waste = waste;
+        }
+    }
+    if (best_n == -1)
+        return false;
+
+    const ImTextureRect fr = builder->FreeRects[best_n];
+    builder->FreeRects.erase_unsorted(&builder->FreeRects[best_n]);
+    const int rem_w = fr.w - w;
+    const int rem_h = fr.h - h;
+    ImTextureRect r1 = { (unsigned short)(fr.x + w), fr.y, (unsigned short)rem_w, (unsigned short)(rem_w > rem_h ? fr.h : h) }; // Right
+    ImTextureRect r2 = { fr.x, (unsigned short)(fr.y + h), (unsigned short)(rem_w > rem_h ? w : fr.w), (unsigned short)rem_h }; // Below
+    if (r1.w > 0 && r1.h > 0)
+        builder->FreeRects.push_back(r1);
+    if (r2.w > 0 && r2.h > 0)
+        builder->FreeRects.push_back(r2);
+    *out_x = fr.x;
+    *out_y = fr.y;
+    return true;
+}
+
+// Pixels are cleared right away (not uploaded), space is later reused by ImFontAtlasPackAddRect() or reclaimed by a repack.
 void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
 {
     IM_ASSERT(id != ImFontAtlasRectId_Invalid);
@@ -4295,47 +4852,421 @@ void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
     index_entry->Generation++;
     if (index_entry->Generation == 0)
         index_entry->Generation++; // Keep non-zero on overflow
+    builder->RectsIndexFreeListStart = index_idx;
+
+    // Secondary pages are never repacked: space is reclaimed when the whole page is released.
+    if (index_entry->PageIndex != 0)
+    {
+        builder->Pages[index_entry->PageIndex - 1]->RectsCount--;
+        index_entry->PageIndex = 0;
+        rect->w = rect->h = 0;
+        return;
+    }
 
     const int pack_padding = atlas->TexGlyphPadding;
-    builder->RectsIndexFreeListStart = index_idx;
     builder->RectsDiscardedCount++;
     builder->RectsDiscardedSurface += (rect->w + pack_padding) * (rect->h + pack_padding);
+    ImFontAtlasTextureBlockFill(atlas->TexData, rect->x, rect->y, rect->w + pack_padding, rect->h + pack_padding, IM_COL32_BLACK_TRANS);
+    ImFontAtlasPackAddFreeRect(builder, rect->x, rect->y, rect->w + pack_padding, rect->h + pack_padding);
     rect->w = rect->h = 0; // Clear rectangle so it won't be packed again
 }
 
-// Important: Calling this may recreate a new texture and therefore change atlas->TexData
-// FIXME-NEWFONTS: Expose other glyph padding settings for custom alteration (e.g. drop shadows). See #7962
-ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry)
+// Secondary pages are only used once the main texture reached its maximum size, and never for custom rectangles.
+// Don't use them when a repack of the main texture would reclaim enough space.
+static bool ImFontAtlasPackCanUsePages(ImFontAtlas* atlas)
 {
-    IM_ASSERT(w > 0 && w <= 0xFFFF);
-    IM_ASSERT(h > 0 && h <= 0xFFFF);
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (atlas->TexMaxPages <= 1 || !atlas->RendererHasTextures || builder->LockDisablePages || builder->LockPreferMainTexture)
+        return false;
+    if (atlas->TexData->Width < atlas->TexMaxWidth || atlas->TexData->Height < atlas->TexMaxHeight)
+        return false;
+    return builder->RectsDiscardedSurface < builder->RectsPackedSurface * 0.20f;
+}
 
-    ImFontAtlasBuilder* builder = (ImFontAtlasBuilder*)atlas->Builder;
-    const int pack_padding = atlas->TexGlyphPadding;
-    builder->MaxRectSize.x = ImMax(builder->MaxRectSize.x, w);
-    builder->MaxRectSize.y = ImMax(builder->MaxRectSize.y, h);
+ImTextureData* ImFontAtlasPageGetTexture(ImFontAtlas* atlas, int page_n)
+{
+    if (page_n == 0)
+        return atlas->TexData;
+    ImFontAtlasPage* page = atlas->Builder->Pages[page_n - 1];
+    IM_ASSERT(page->Tex != NULL);
+    return page->Tex;
+}
 
-    // Pack
-    ImTextureRect r = { 0, 0, (unsigned short)w, (unsigned short)h };
-    for (int attempts_remaining = 3; attempts_remaining >= 0; attempts_remaining--)
+static void ImFontAtlasPageRelease(ImFontAtlas* atlas, int page_n)
+{
+    ImFontAtlasPage* page = atlas->Builder->Pages[page_n - 1];
+    IM_ASSERT(page->RectsCount == 0);
+    IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: release page %d\n", page->Tex->UniqueID, page_n);
+    page->Tex->WantDestroyNextFrame = true;
+    page->Tex = NULL;
+    page->Rects.clear();
+    page->PackNodes.clear();
+}
+
+void ImFontAtlasPageDiscard(ImFontAtlas* atlas, int page_n)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    IM_ASSERT(page_n > 0 && page_n <= builder->Pages.Size && builder->Pages[page_n - 1]->Tex != NULL);
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
     {
-        // Try packing
-        stbrp_rect pack_r = {};
-        pack_r.w = w + pack_padding;
-        pack_r.h = h + pack_padding;
-        stbrp_pack_rects((stbrp_context*)(void*)&builder->PackContext, &pack_r, 1);
-        r.x = (unsigned short)pack_r.x;
-        r.y = (unsigned short)pack_r.y;
-        if (pack_r.was_packed)
-            break;
+        ImFontBaked* baked = &builder->BakedPool[baked_n];
+        if (baked->WantDestroy)
+            continue;
+        for (int glyph_n = 0; glyph_n < baked->Glyphs.Size; glyph_n++)
+            if (baked->Glyphs[glyph_n].PackId != ImFontAtlasRectId_Invalid && baked->Glyphs[glyph_n].PageIndex == (unsigned int)page_n)
+                ImFontAtlasBuildEvictGlyph(atlas, baked, glyph_n);
+    }
+    ImFontAtlasPageRelease(atlas, page_n);
+}
 
-        // If we ran out of attempts, return fallback
+static void ImFontAtlasPageInit(ImFontAtlas* atlas, int page_n, int w, int h, bool use_sdf)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontAtlasPage* page = builder->Pages[page_n - 1];
+    IM_ASSERT(page->Tex == NULL);
+    ImTextureData* tex = IM_NEW(ImTextureData)();
+    tex->UniqueID = atlas->TexNextUniqueID++;
+    tex->Create(atlas->TexDesiredFormat, w, h);
+    tex->UseSdf = use_sdf;
+    atlas->TexList.push_back(tex);
+    page->Tex = tex;
+    page->PackNodes.resize(w / 2);
+    stbrp_init_target((stbrp_context*)(void*)&page->PackContext, w, h, page->PackNodes.Data, page->PackNodes.Size);
+    page->Rects.resize(0);
+    page->RectsCount = 0;
+    page->LastUsedFrame = builder->FrameCount;
+    IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: add page %d %dx%d%s\n", tex->UniqueID, page_n, w, h, use_sdf ? " (SDF)" : "");
+}
+
+// Allocate a new page, reusing a free slot or evicting the least recently used page of the same kind. Return 0 on failure.
+// - Regular pages are limited by TexMaxPages, SDF pages only by the number of slots.
+static int ImFontAtlasPageAlloc(ImFontAtlas* atlas, bool use_sdf, int w, int h)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    int pages_count = 0;
+    for (ImFontAtlasPage* page : builder->Pages)
+        if (page->Tex != NULL && page->Tex->UseSdf == use_sdf)
+            pages_count++;
+    const int pages_max = use_sdf ? (IM_FONTATLAS_MAX_PAGES - 1) : (ImMin(atlas->TexMaxPages, IM_FONTATLAS_MAX_PAGES) - 1);
+
+    int page_n = 0;
+    if (pages_count < pages_max)
+    {
+        for (int n = 0; n < builder->Pages.Size && page_n == 0; n++)
+            if (builder->Pages[n]->Tex == NULL)
+                page_n = n + 1;
+        if (page_n == 0 && builder->Pages.Size + 1 < IM_FONTATLAS_MAX_PAGES)
+        {
+            builder->Pages.push_back(IM_NEW(ImFontAtlasPage)());
+            page_n = builder->Pages.Size;
+        }
+    }
+    if (page_n == 0)
+    {
+        // Evict least recently used page. Pages used during the current frame may be referenced by draw commands.
+        int lru_frame = builder->FrameCount;
+        for (int n = 0; n < builder->Pages.Size; n++)
+            if (builder->Pages[n]->Tex != NULL && builder->Pages[n]->Tex->UseSdf == use_sdf && builder->Pages[n]->LastUsedFrame < lru_frame)
+            {
+                lru_frame = builder->Pages[n]->LastUsedFrame;
+                page_n = n + 1;
+            }
+        if (page_n == 0)
+            return 0;
+        IMGUI_DEBUG_LOG_FONT("[font] Evicting page %d, last used on frame %d\n", page_n, lru_frame);
+        ImFontAtlasPageDiscard(atlas, page_n);
+        builder->PagesEvictedTotal++;
+    }
+
+    ImFontAtlasPageInit(atlas, page_n, w, h, use_sdf);
+    return page_n;
+}
+
+static ImFontAtlasRectId ImFontAtlasPagePackRect(ImFontAtlas* atlas, int page_n, int w, int h)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontAtlasPage* page = builder->Pages[page_n - 1];
+    const int pack_padding = atlas->TexGlyphPadding;
+    stbrp_rect pack_r = {};
+    pack_r.w = w + pack_padding;
+    pack_r.h = h + pack_padding;
+    stbrp_pack_rects((stbrp_context*)(void*)&page->PackContext, &pack_r, 1);
+    if (!pack_r.was_packed)
+        return ImFontAtlasRectId_Invalid;
+    ImTextureRect r = { (unsigned short)pack_r.x, (unsigned short)pack_r.y, (unsigned short)w, (unsigned short)h };
+    page->Rects.push_back(r);
+    page->RectsCount++;
+    page->LastUsedFrame = builder->FrameCount;
+    return ImFontAtlasPackAllocRectEntry(atlas, page->Rects.Size - 1, page_n);
+}
+
+// Try existing pages (most recent first), then allocate a new one
+static ImFontAtlasRectId ImFontAtlasPackAddRectToPages(ImFontAtlas* atlas, int w, int h)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    for (int page_n = builder->Pages.Size; page_n > 0; page_n--)
+        if (builder->Pages[page_n - 1]->Tex != NULL && !builder->Pages[page_n - 1]->Tex->UseSdf)
+        {
+            ImFontAtlasRectId r_id = ImFontAtlasPagePackRect(atlas, page_n, w, h);
+            if (r_id != ImFontAtlasRectId_Invalid)
+                return r_id;
+        }
+    const int page_n = ImFontAtlasPageAlloc(atlas, false, atlas->TexData->Width, atlas->TexData->Height); // Same size as the main texture
+    if (page_n == 0)
+        return ImFontAtlasRectId_Invalid;
+    return ImFontAtlasPagePackRect(atlas, page_n, w, h);
+}
+
+// SDF glyphs need the renderer to threshold alpha, so they can't share a texture with regular glyphs.
+// They are always stored in pages, regardless of TexMaxPages and LockDisablePages (e.g. for fallback glyphs).
+ImFontAtlasRectId ImFontAtlasPackAddSdfRect(ImFontAtlas* atlas, int w, int h)
+{
+    IM_ASSERT(w > 0 && w <= 0xFFFF);
+    IM_ASSERT(h > 0 && h <= 0xFFFF);
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    for (int page_n = builder->Pages.Size; page_n > 0; page_n--)
+        if (builder->Pages[page_n - 1]->Tex != NULL && builder->Pages[page_n - 1]->Tex->UseSdf)
+        {
+            ImFontAtlasRectId r_id = ImFontAtlasPagePackRect(atlas, page_n, w, h);
+            if (r_id != ImFontAtlasRectId_Invalid)
+                return r_id;
+        }
+    const int page_size = ImMax(IM_FONTATLAS_SDF_PAGE_SIZE, ImUpperPowerOfTwo(ImMax(w, h) + atlas->TexGlyphPadding));
+    const int page_n = ImFontAtlasPageAlloc(atlas, true, page_size, page_size);
+    if (page_n == 0)
+        return ImFontAtlasRectId_Invalid;
+    return ImFontAtlasPagePackRect(atlas, page_n, w, h);
+}
+
+// Called by ImFontAtlasUpdateNewFrame()
+void ImFontAtlasPagesUpdateNewFrame(ImFontAtlas* atlas)
+{
+    // Release pages which have no glyphs left (e.g. after their bakes got discarded or their glyphs evicted)
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    for (int page_n = 1; page_n <= builder->Pages.Size; page_n++)
+        if (builder->Pages[page_n - 1]->Tex != NULL && builder->Pages[page_n - 1]->RectsCount == 0)
+            ImFontAtlasPageRelease(atlas, page_n);
+}
+
+// Minimum number of frames a glyph needs to be unused for before being evicted (ImFontAtlas::TexMemoryTarget)
+#define IM_FONTATLAS_EVICT_MIN_UNUSED_FRAMES    60
+#define IM_FONTATLAS_EVICT_MAX_PER_FRAME        256
+
+// Glyph is left in place, invisible, and unregistered from the index so it gets reloaded on next use.
+// Its Glyphs[] slot is compacted on next frame, as callers may be holding glyph indices/pointers.
+void ImFontAtlasBuildEvictGlyph(ImFontAtlas* atlas, ImFontBaked* baked, int glyph_idx)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontGlyph* glyph = &baked->Glyphs[glyph_idx];
+    IM_ASSERT(glyph->PackId != ImFontAtlasRectId_Invalid);
+    if (ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph->PackId))
+        baked->MetricsTotalSurface -= r->w * r->h;
+    ImFontAtlasPackDiscardRect(atlas, glyph->PackId);
+    glyph->PackId = ImFontAtlasRectId_Invalid;
+    glyph->Visible = glyph->Colored = false;
+    glyph->PageIndex = 0;
+    glyph->U0 = glyph->V0 = glyph->U1 = glyph->V1 = 0.0f;
+    ImFontBakedIndexPage* index_page = ImFontBaked_GetIndexPage(baked, glyph->Codepoint);
+    if (index_page != NULL && index_page->Lookup[glyph->Codepoint % IM_FONTBAKED_INDEX_PAGE_SIZE] == glyph_idx)
+        index_page->Lookup[glyph->Codepoint % IM_FONTBAKED_INDEX_PAGE_SIZE] = IM_FONTGLYPH_INDEX_UNUSED; // Keep AdvanceX[], metrics are unchanged.
+    builder->GlyphsEvictedCount++;
+    builder->GlyphsEvictedTotal++;
+}
+
+int ImFontAtlasTextureGetMemoryUsage(ImFontAtlas* atlas)
+{
+    int size_in_bytes = atlas->TexData ? atlas->TexData->GetSizeInBytes() : 0;
+    if (atlas->Builder != NULL)
+        for (ImFontAtlasPage* page : atlas->Builder->Pages)
+            if (page->Tex != NULL)
+                size_in_bytes += page->Tex->GetSizeInBytes();
+    return size_in_bytes;
+}
+
+struct ImFontAtlasEvictCandidate
+{
+    int     BakedIdx;
+    int     GlyphIdx;
+    int     LastUsedFrame;
+};
+
+static int IMGUI_CDECL ImFontAtlasEvictCandidateComparerByLastUsedFrame(const void* lhs, const void* rhs)
+{
+    const ImFontAtlasEvictCandidate* a = (const ImFontAtlasEvictCandidate*)lhs;
+    const ImFontAtlasEvictCandidate* b = (const ImFontAtlasEvictCandidate*)rhs;
+    return (a->LastUsedFrame != b->LastUsedFrame) ? (a->LastUsedFrame - b->LastUsedFrame) : (a->GlyphIdx - b->GlyphIdx);
+}
+
+// Called by ImFontAtlasUpdateNewFrame() when ImFontAtlas::TexMemoryTarget is set.
+// - Evict least recently used glyphs until the live surface fits in the target (custom rectangles and fallback glyphs are never evicted).
+// - Then shrink main texture if it became larger than needed.
+void ImFontAtlasBuildEvictUnusedGlyphs(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder->FrameCount < builder->GlyphsEvictNextFrame)
+        return;
+    builder->GlyphsEvictNextFrame = builder->FrameCount + 30;
+
+    const int mem_usage = ImFontAtlasTextureGetMemoryUsage(atlas);
+    if (mem_usage <= atlas->TexMemoryTarget)
+        return;
+
+    // Gather candidates
+    const int bytes_per_pixel = atlas->TexData->BytesPerPixel;
+    const int pack_padding = atlas->TexGlyphPadding;
+    ImVector<ImFontAtlasEvictCandidate> candidates;
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+    {
+        ImFontBaked* baked = &builder->BakedPool[baked_n];
+        if (baked->WantDestroy)
+            continue;
+        for (int glyph_n = 0; glyph_n < baked->Glyphs.Size; glyph_n++)
+        {
+            const ImFontGlyph* glyph = &baked->Glyphs[glyph_n];
+            if (glyph->PackId == ImFontAtlasRectId_Invalid || glyph_n == baked->FallbackGlyphIndex)
+                continue;
+            if (glyph->LastUsedFrame > builder->FrameCount - IM_FONTATLAS_EVICT_MIN_UNUSED_FRAMES)
+                continue;
+            if (builder->RectsIndex[ImFontAtlasRectId_GetIndex(glyph->PackId)].IsCustom)
+                continue;
+            ImFontAtlasEvictCandidate candidate = { baked_n, glyph_n, glyph->LastUsedFrame };
+            candidates.push_back(candidate);
+        }
+    }
+    if (candidates.Size == 0)
+        return;
+    ImQsort(candidates.Data, (size_t)candidates.Size, sizeof(ImFontAtlasEvictCandidate), ImFontAtlasEvictCandidateComparerByLastUsedFrame);
+
+    // Evict oldest first. Surface of secondary pages is only reclaimed once a page is empty, so count them as fully used.
+    int live_bytes = mem_usage - atlas->TexData->GetSizeInBytes() + (builder->RectsPackedSurface - builder->RectsDiscardedSurface) * bytes_per_pixel;
+    int evict_count = 0;
+    for (const ImFontAtlasEvictCandidate& candidate : candidates)
+    {
+        if (live_bytes <= atlas->TexMemoryTarget || evict_count >= IM_FONTATLAS_EVICT_MAX_PER_FRAME)
+            break;
+        ImFontBaked* baked = &builder->BakedPool[candidate.BakedIdx];
+        const ImFontGlyph* glyph = &baked->Glyphs[candidate.GlyphIdx];
+        if (glyph->PageIndex == 0)
+        {
+            const ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph->PackId);
+            live_bytes -= (r->w + pack_padding) * (r->h + pack_padding) * bytes_per_pixel;
+        }
+        ImFontAtlasBuildEvictGlyph(atlas, baked, candidate.GlyphIdx);
+        evict_count++;
+    }
+    if (evict_count == 0)
+        return;
+    IMGUI_DEBUG_LOG_FONT("[font] Evicted %d unused glyphs (texture memory %d KB, target %d KB)\n", evict_count, mem_usage / 1024, atlas->TexMemoryTarget / 1024);
+    if (evict_count == IM_FONTATLAS_EVICT_MAX_PER_FRAME)
+        builder->GlyphsEvictNextFrame = builder->FrameCount + 1; // Continue on next frame
+
+    // Opportunistic compaction of main texture. Discarded space is otherwise reclaimed by the next repack in ImFontAtlasTextureMakeSpace().
+    ImTextureData* tex = atlas->TexData;
+    ImVec2i new_tex_size = ImFontAtlasTextureGetSizeEstimate(atlas);
+    if (new_tex_size.x * new_tex_size.y < tex->Width * tex->Height)
+        ImFontAtlasTextureRepack(atlas, new_tex_size.x, new_tex_size.y);
+}
+
+// Compact Glyphs[] slots left behind by ImFontAtlasBuildEvictGlyph(). Those are no longer registered in the index.
+void ImFontAtlasBuildCompactEvictedGlyphs(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder->GlyphsEvictedCount == 0)
+        return;
+    builder->GlyphsEvictedCount = 0;
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+    {
+        ImFontBaked* baked = &builder->BakedPool[baked_n];
+        if (baked->WantDestroy)
+            continue;
+        bool fallback_evicted = false;
+        int dst_n = 0;
+        for (int src_n = 0; src_n < baked->Glyphs.Size; src_n++)
+        {
+            const ImFontGlyph& glyph = baked->Glyphs[src_n];
+            ImFontBakedIndexPage* index_page = ImFontBaked_GetIndexPage(baked, glyph.Codepoint);
+            const bool is_registered = index_page != NULL && index_page->Lookup[glyph.Codepoint % IM_FONTBAKED_INDEX_PAGE_SIZE] == src_n;
+            if (src_n == baked->FallbackGlyphIndex)
+            {
+                fallback_evicted = !is_registered;
+                baked->FallbackGlyphIndex = dst_n;
+            }
+            if (!is_registered)
+                continue;
+            if (dst_n != src_n)
+            {
+                baked->Glyphs[dst_n] = glyph;
+                index_page->Lookup[glyph.Codepoint % IM_FONTBAKED_INDEX_PAGE_SIZE] = (ImU16)dst_n;
+            }
+            dst_n++;
+        }
+        baked->Glyphs.resize(dst_n);
+
+        // Reload fallback glyph
+        if (fallback_evicted)
+        {
+            baked->FallbackGlyphIndex = -1;
+            baked->FallbackAdvanceX = 0.0f;
+            ImFontAtlasBuildSetupFontBakedFallback(baked);
+        }
+    }
+}
+
+// Important: Calling this may recreate a new texture and therefore change atlas->TexData
+// FIXME-NEWFONTS: Expose other glyph padding settings for custom alteration (e.g. drop shadows). See #7962
+ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry)
+{
+    IM_ASSERT(w > 0 && w <= 0xFFFF);
+    IM_ASSERT(h > 0 && h <= 0xFFFF);
+
+    ImFontAtlasBuilder* builder = (ImFontAtlasBuilder*)atlas->Builder;
+    const int pack_padding = atlas->TexGlyphPadding;
+    builder->MaxRectSize.x = ImMax(builder->MaxRectSize.x, w);
+    builder->MaxRectSize.y = ImMax(builder->MaxRectSize.y, h);
+
+    // Reuse space left by discarded rectangles first, then pack above the skyline
+    ImTextureRect r = { 0, 0, (unsigned short)w, (unsigned short)h };
+    int free_x = 0, free_y = 0;
+    const bool use_free_rect = builder->FreeRects.Size > 0 && ImFontAtlasPackAllocFreeRect(builder, w + pack_padding, h + pack_padding, INT_MAX, &free_x, &free_y);
+    if (use_free_rect)
+    {
+        r.x = (unsigned short)free_x;
+        r.y = (unsigned short)free_y;
+    }
+    for (int attempts_remaining = 3; attempts_remaining >= 0 && !use_free_rect; attempts_remaining--)
+    {
+        // Try packing
+        stbrp_rect pack_r = {};
+        pack_r.w = w + pack_padding;
+        pack_r.h = h + pack_padding;
+        stbrp_pack_rects((stbrp_context*)(void*)&builder->PackContext, &pack_r, 1);
+        r.x = (unsigned short)pack_r.x;
+        r.y = (unsigned short)pack_r.y;
+        if (pack_r.was_packed)
+            break;
+
+        // If we ran out of attempts, return fallback
         if (attempts_remaining == 0 || builder->LockDisableResize)
         {
+            // Main texture is full: use a secondary page as a last resort
+            if (builder->LockPreferMainTexture && overwrite_entry == NULL && atlas->TexMaxPages > 1 && atlas->RendererHasTextures)
+            {
+                ImFontAtlasRectId page_r_id = ImFontAtlasPackAddRectToPages(atlas, w, h);
+                if (page_r_id != ImFontAtlasRectId_Invalid)
+                    return page_r_id;
+            }
             IMGUI_DEBUG_LOG_FONT("[font] Failed packing %dx%d rectangle. Returning fallback.\n", w, h);
             return ImFontAtlasRectId_Invalid;
         }
 
+        // Main texture cannot grow anymore: use a secondary page rather than repacking
+        if (overwrite_entry == NULL && ImFontAtlasPackCanUsePages(atlas))
+        {
+            ImFontAtlasRectId page_r_id = ImFontAtlasPackAddRectToPages(atlas, w, h);
+            if (page_r_id != ImFontAtlasRectId_Invalid)
+                return page_r_id;
+        }
+
         // Resize or repack atlas! (this should be a rare event)
         ImFontAtlasTextureMakeSpace(atlas);
     }
@@ -4343,7 +5274,14 @@ ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFon
     builder->MaxRectBounds.x = ImMax(builder->MaxRectBounds.x, r.x + r.w + pack_padding);
     builder->MaxRectBounds.y = ImMax(builder->MaxRectBounds.y, r.y + r.h + pack_padding);
     builder->RectsPackedCount++;
-    builder->RectsPackedSurface += (w + pack_padding) * (h + pack_padding);
+    if (use_free_rect)
+        builder->RectsDiscardedSurface = ImMax(builder->RectsDiscardedSurface - (w + pack_padding) * (h + pack_padding), 0); // Surface was already accounted for
+    else
+        builder->RectsPackedSurface += (w + pack_padding) * (h + pack_padding);
+
+    // Space of discarded rectangles was only cleared on CPU side: upload padding along with the contents.
+    if (builder->RectsDiscardedCount > 0 && overwrite_entry == NULL)
+        ImFontAtlasTextureBlockQueueUpload(atlas, atlas->TexData, r.x, r.y, r.w + pack_padding, r.h + pack_padding);
 
     builder->Rects.push_back(r);
     if (overwrite_entry != NULL)
@@ -4352,6 +5290,140 @@ ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFon
         return ImFontAtlasPackAllocRectEntry(atlas, builder->Rects.Size - 1);
 }
 
+// Lower the packer skyline to the bottom of remaining rectangles, after ImFontAtlasPackDefrag() moved the bottom-most ones.
+// Free rectangles which would end up above the skyline are trimmed, so both allocators never share pixels.
+static void ImFontAtlasPackRebuildSkyline(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    stbrp_context* ctx = (stbrp_context*)(void*)&builder->PackContext;
+    const int pack_padding = atlas->TexGlyphPadding;
+    const int align = ctx->align;
+    const int columns_count = (ctx->width + align - 1) / align;
+
+    // Bottom of used space for each column of 'align' pixels (stb_rect_pack quantizes x positions and widths)
+    ImVector<int> columns_y;
+    columns_y.resize(columns_count, 0);
+    builder->MaxRectBounds = ImVec2i(0, 0);
+    for (const ImTextureRect& r : builder->Rects)
+    {
+        if (r.w == 0 && r.h == 0)
+            continue;
+        const int x1 = r.x + r.w + pack_padding;
+        const int y1 = r.y + r.h + pack_padding;
+        for (int column_n = r.x / align; column_n < (x1 + align - 1) / align; column_n++)
+            columns_y[column_n] = ImMax(columns_y[column_n], y1);
+        builder->MaxRectBounds.x = ImMax(builder->MaxRectBounds.x, x1);
+        builder->MaxRectBounds.y = ImMax(builder->MaxRectBounds.y, y1);
+    }
+
+    // Rebuild skyline, one node per run of columns at same height.
+    // Like stbrp_init_target() we use 'extra[0]' as first node: 'columns_count <= num_nodes' so at least one node stays free.
+    IM_ASSERT(columns_count <= ctx->num_nodes);
+    stbrp_node* nodes = builder->PackNodes.Data;
+    stbrp_node* last_node = &ctx->extra[0];
+    last_node->x = 0;
+    last_node->y = columns_y[0];
+    int nodes_used = 0;
+    for (int column_n = 1; column_n < columns_count; column_n++)
+    {
+        if (columns_y[column_n] == columns_y[column_n - 1])
+            continue;
+        stbrp_node* node = &nodes[nodes_used++];
+        node->x = column_n * align;
+        node->y = columns_y[column_n];
+        last_node->next = node;
+        last_node = node;
+    }
+    last_node->next = &ctx->extra[1];
+    ctx->active_head = &ctx->extra[0];
+    ctx->free_head = &nodes[nodes_used];
+    for (int node_n = nodes_used; node_n < ctx->num_nodes; node_n++)
+        nodes[node_n].next = (node_n + 1 < ctx->num_nodes) ? &nodes[node_n + 1] : NULL;
+
+    // Trim free rectangles to the new skyline. Trimmed space is either above the skyline (packable again) or lost until next repack.
+    for (int n = 0; n < builder->FreeRects.Size; n++)
+    {
+        ImTextureRect& fr = builder->FreeRects[n];
+        int y1 = fr.y + fr.h;
+        for (int column_n = fr.x / align; column_n < (fr.x + fr.w + align - 1) / align; column_n++)
+            y1 = ImMin(y1, columns_y[column_n]);
+        if (y1 == fr.y + fr.h)
+            continue;
+        const int trimmed_surface = fr.w * (fr.y + fr.h - ImMax(y1, (int)fr.y));
+        builder->RectsPackedSurface -= trimmed_surface;
+        builder->RectsDiscardedSurface = ImMax(builder->RectsDiscardedSurface - trimmed_surface, 0);
+        if (y1 > fr.y)
+            fr.h = (unsigned short)(y1 - fr.y);
+        else
+            builder->FreeRects.erase_unsorted(&builder->FreeRects[n--]);
+    }
+}
+
+struct ImFontAtlasDefragCandidate
+{
+    int     IndexIdx;
+    int     Bottom;
+};
+
+static int IMGUI_CDECL ImFontAtlasDefragCandidateComparerByBottom(const void* lhs, const void* rhs)
+{
+    const ImFontAtlasDefragCandidate* a = (const ImFontAtlasDefragCandidate*)lhs;
+    const ImFontAtlasDefragCandidate* b = (const ImFontAtlasDefragCandidate*)rhs;
+    return (a->Bottom != b->Bottom) ? (b->Bottom - a->Bottom) : (a->IndexIdx - b->IndexIdx);
+}
+
+// Incremental alternative to ImFontAtlasTextureRepack(), called by ImFontAtlasUpdateNewFrame() while free rectangles exist.
+// - Move up to 'max_moves' of the bottom-most rectangles into free rectangles located higher, then lower the packer skyline.
+//   Over a few frames this consolidates free space above the skyline, where larger rectangles can be packed without a repack.
+// - Only moved regions are uploaded. Glyph UV are patched through the RectsIndex[] indirection: ImFontAtlasRectId stay valid.
+// - Custom rectangles are never moved, as user code may have cached their UV.
+void ImFontAtlasPackDefrag(ImFontAtlas* atlas, int max_moves)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    builder->DefragWanted = false;
+    if (builder->FreeRects.Size == 0)
+        return;
+
+    const int pack_padding = atlas->TexGlyphPadding;
+    ImVector<ImFontAtlasDefragCandidate> candidates;
+    for (int index_idx = 0; index_idx < builder->RectsIndex.Size; index_idx++)
+    {
+        const ImFontAtlasRectEntry& index_entry = builder->RectsIndex[index_idx];
+        if (!index_entry.IsUsed || index_entry.IsCustom || index_entry.PageIndex != 0)
+            continue;
+        const ImTextureRect& r = builder->Rects[index_entry.TargetIndex];
+        ImFontAtlasDefragCandidate candidate = { index_idx, r.y + r.h + pack_padding };
+        candidates.push_back(candidate);
+    }
+    ImQsort(candidates.Data, (size_t)candidates.Size, sizeof(ImFontAtlasDefragCandidate), ImFontAtlasDefragCandidateComparerByBottom);
+
+    // Only consider a few candidates: the point is to free the bottom of the texture.
+    ImTextureData* tex = atlas->TexData;
+    int moves_count = 0;
+    for (int candidate_n = 0; candidate_n < candidates.Size && candidate_n < max_moves * 4 && moves_count < max_moves; candidate_n++)
+    {
+        const ImFontAtlasDefragCandidate& candidate = candidates[candidate_n];
+        ImTextureRect& r = builder->Rects[builder->RectsIndex[candidate.IndexIdx].TargetIndex];
+        int dst_x, dst_y;
+        if (!ImFontAtlasPackAllocFreeRect(builder, r.w + pack_padding, r.h + pack_padding, candidate.Bottom - 1, &dst_x, &dst_y))
+            continue;
+        ImFontAtlasTextureBlockCopy(tex, r.x, r.y, tex, dst_x, dst_y, r.w, r.h);
+        ImFontAtlasTextureBlockQueueUpload(atlas, tex, dst_x, dst_y, r.w + pack_padding, r.h + pack_padding);
+        ImFontAtlasTextureBlockFill(tex, r.x, r.y, r.w + pack_padding, r.h + pack_padding, IM_COL32_BLACK_TRANS);
+        ImFontAtlasPackAddFreeRect(builder, r.x, r.y, r.w + pack_padding, r.h + pack_padding);
+        r.x = (unsigned short)dst_x;
+        r.y = (unsigned short)dst_y;
+        moves_count++;
+    }
+    if (moves_count == 0)
+        return; // Wait for more rectangles to be discarded
+    IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: defrag moved %d rects, %d free rects left.\n", tex->UniqueID, moves_count, builder->FreeRects.Size);
+    builder->DefragMovesTotal += moves_count;
+
+    ImFontAtlasPackRebuildSkyline(atlas);
+    ImFontAtlasBuildUpdateGlyphsUV(atlas);
+}
+
 // Generally for non-user facing functions: assert on invalid ID.
 ImTextureRect* ImFontAtlasPackGetRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
 {
@@ -4361,6 +5433,8 @@ ImTextureRect* ImFontAtlasPackGetRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
     ImFontAtlasRectEntry* index_entry = &builder->RectsIndex[index_idx];
     IM_ASSERT(index_entry->Generation == ImFontAtlasRectId_GetGeneration(id));
     IM_ASSERT(index_entry->IsUsed);
+    if (index_entry->PageIndex != 0)
+        return &builder->Pages[index_entry->PageIndex - 1]->Rects[index_entry->TargetIndex];
     return &builder->Rects[index_entry->TargetIndex];
 }
 
@@ -4380,12 +5454,23 @@ ImTextureRect* ImFontAtlasPackGetRectSafe(ImFontAtlas* atlas, ImFontAtlasRectId
     ImFontAtlasRectEntry* index_entry = &builder->RectsIndex[index_idx];
     if (index_entry->Generation != ImFontAtlasRectId_GetGeneration(id) || !index_entry->IsUsed)
         return NULL;
+    if (index_entry->PageIndex != 0)
+        return &builder->Pages[index_entry->PageIndex - 1]->Rects[index_entry->TargetIndex];
     return &builder->Rects[index_entry->TargetIndex];
 }
 
+// Return page index of a valid rectangle. 0 = main texture.
+int ImFontAtlasPackGetRectPage(ImFontAtlas* atlas, ImFontAtlasRectId id)
+{
+    IM_ASSERT(id != ImFontAtlasRectId_Invalid);
+    ImFontAtlasRectEntry* index_entry = &atlas->Builder->RectsIndex[ImFontAtlasRectId_GetIndex(id)];
+    IM_ASSERT(index_entry->IsUsed);
+    return index_entry->PageIndex;
+}
+
 // Important! This assume by ImFontConfig::GlyphExcludeRanges[] is a SMALL ARRAY (e.g. <10 entries)
 // Use "Input Glyphs Overlap Detection Tool" to display a list of glyphs provided by multiple sources in order to set this array up.
-static bool ImFontAtlasBuildAcceptCodepointForSource(ImFontConfig* src, ImWchar codepoint)
+bool ImFontAtlasBuildAcceptCodepointForSource(ImFontConfig* src, ImWchar codepoint)
 {
     if (const ImWchar* exclude_list = src->GlyphExcludeRanges)
         for (; exclude_list[0] != 0; exclude_list += 2)
@@ -4394,13 +5479,19 @@ static bool ImFontAtlasBuildAcceptCodepointForSource(ImFontConfig* src, ImWchar
     return true;
 }
 
-static void ImFontBaked_BuildGrowIndex(ImFontBaked* baked, int new_size)
+// Return index page for given code-point, allocate if needed
+static ImFontBakedIndexPage* ImFontBaked_BuildGetIndexPage(ImFontBaked* baked, unsigned int codepoint)
 {
-    IM_ASSERT(baked->IndexAdvanceX.Size == baked->IndexLookup.Size);
-    if (new_size <= baked->IndexLookup.Size)
-        return;
-    baked->IndexAdvanceX.resize(new_size, -1.0f);
-    baked->IndexLookup.resize(new_size, IM_FONTGLYPH_INDEX_UNUSED);
+    const int page_n = (int)(codepoint / IM_FONTBAKED_INDEX_PAGE_SIZE);
+    if (page_n >= baked->IndexPages.Size)
+        baked->IndexPages.resize(page_n + 1, (ImFontBakedIndexPage*)&ImFontBakedIndexPageEmpty);
+    ImFontBakedIndexPage* index_page = baked->IndexPages.Data[page_n];
+    if (index_page == &ImFontBakedIndexPageEmpty)
+    {
+        index_page = baked->IndexPages.Data[page_n] = (ImFontBakedIndexPage*)IM_ALLOC(sizeof(ImFontBakedIndexPage));
+        memcpy(index_page, &ImFontBakedIndexPageEmpty, sizeof(ImFontBakedIndexPage));
+    }
+    return index_page;
 }
 
 static void ImFontAtlas_FontHookRemapCodepoint(ImFontAtlas* atlas, ImFont* font, ImWchar* c)
@@ -4410,8 +5501,21 @@ static void ImFontAtlas_FontHookRemapCodepoint(ImFontAtlas* atlas, ImFont* font,
         *c = (ImWchar)font->RemapPairs.GetInt((ImGuiID)*c, (int)*c);
 }
 
+// Rasterize a glyph, accounting for it in the per-frame bake budget (see ImFontAtlasBuildIsBakeBudgetExhausted())
+static bool ImFontAtlasBuildLoaderLoadGlyph(ImFontAtlas* atlas, const ImFontLoader* loader, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    const ImU64 t0 = ImTimeGetMicroseconds();
+    const bool ret = loader->FontBakedLoadGlyph(atlas, src, baked, loader_data_for_baked_src, codepoint, out_glyph, NULL);
+    builder->FrameBakeMicroseconds += (int)(ImTimeGetMicroseconds() - t0);
+    builder->FrameBakeGlyphs++;
+    return ret;
+}
+
 static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x)
 {
+    IM_PROFILE_SCOPE("BuildLoadGlyph");
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Fonts);
     ImFont* font = baked->ContainerFont;
     ImFontAtlas* atlas = font->ContainerAtlas;
     if (atlas->Locked || (font->Flags & ImFontFlags_NoLoadGlyphs))
@@ -4435,104 +5539,889 @@ static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codep
         if (ImFontGlyph* glyph = ImFontAtlasBuildSetupFontBakedEllipsis(atlas, baked))
             return glyph;
 
-    // Call backend
-    char* loader_user_data_p = (char*)baked->FontLoaderDatas;
-    int src_n = 0;
-    for (ImFontConfig* src : font->Sources)
+    // Deferred mode: only load metrics now and register an invisible placeholder, rasterize on a later frame.
+    // (FindGlyphNoFallback() calls are rare and expect a final result, so they are always loaded immediately)
+    const bool defer_load = (atlas->Flags & (ImFontAtlasFlags_DeferGlyphLoading | ImFontAtlasFlags_MetricsOnly)) == ImFontAtlasFlags_DeferGlyphLoading && atlas->RendererHasTextures && !baked->LoadNoFallback;
+
+    // Call backend
+    char* loader_user_data_p = (char*)baked->FontLoaderDatas;
+    int src_n = 0;
+    for (ImFontConfig* src : font->Sources)
+    {
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        if (!src->GlyphExcludeRanges || ImFontAtlasBuildAcceptCodepointForSource(src, codepoint))
+        {
+            if (only_load_advance_x == NULL && defer_load)
+            {
+                float advance_x = 0.0f;
+                if (loader->FontBakedLoadGlyph(atlas, src, baked, loader_user_data_p, codepoint, NULL, &advance_x))
+                {
+                    ImFontGlyph glyph_buf;
+                    glyph_buf.Codepoint = src_codepoint;
+                    glyph_buf.SourceIdx = src_n;
+                    glyph_buf.AdvanceX = advance_x;
+                    ImFontAtlasDeferredGlyph req = { baked->BakedId, (unsigned int)src_codepoint };
+                    atlas->Builder->DeferredGlyphs.push_back(req);
+                    return ImFontAtlasBakedAddFontGlyph(atlas, baked, src, &glyph_buf);
+                }
+            }
+            else if (only_load_advance_x == NULL)
+            {
+                ImFontGlyph glyph_buf;
+                if (ImFontAtlasBuildLoaderLoadGlyph(atlas, loader, src, baked, loader_user_data_p, codepoint, &glyph_buf))
+                {
+                    // FIXME: Add hooks for e.g. #7962
+                    glyph_buf.Codepoint = src_codepoint;
+                    glyph_buf.SourceIdx = src_n;
+                    return ImFontAtlasBakedAddFontGlyph(atlas, baked, src, &glyph_buf);
+                }
+            }
+            else
+            {
+                // Special mode but only loading glyphs metrics. Will rasterize and pack later.
+                if (loader->FontBakedLoadGlyph(atlas, src, baked, loader_user_data_p, codepoint, NULL, only_load_advance_x))
+                {
+                    ImFontAtlasBakedAddFontGlyphAdvancedX(atlas, baked, src, codepoint, *only_load_advance_x);
+                    return NULL;
+                }
+            }
+        }
+        loader_user_data_p += loader->FontBakedSrcLoaderDataSize;
+        src_n++;
+    }
+
+    // Lazily load fallback glyph
+    if (baked->LoadNoFallback)
+        return NULL;
+    if (baked->FallbackGlyphIndex == -1)
+        ImFontAtlasBuildSetupFontBakedFallback(baked);
+
+    // Mark index as not found, so we don't attempt the search twice
+    ImFontBakedIndexPage* index_page = ImFontBaked_BuildGetIndexPage(baked, codepoint);
+    index_page->AdvanceX[codepoint % IM_FONTBAKED_INDEX_PAGE_SIZE] = baked->FallbackAdvanceX;
+    index_page->Lookup[codepoint % IM_FONTBAKED_INDEX_PAGE_SIZE] = IM_FONTGLYPH_INDEX_NOT_FOUND;
+    return NULL;
+}
+
+// Return index of a placeholder glyph registered by ImFontBaked_BuildLoadGlyph() in deferred mode, or -1 if already loaded or replaced.
+static int ImFontBaked_FindDeferredGlyph(ImFontBaked* baked, ImWchar codepoint)
+{
+    ImFontBakedIndexPage* index_page = ImFontBaked_GetIndexPage(baked, codepoint);
+    if (index_page == NULL)
+        return -1;
+    const int glyph_idx = index_page->Lookup[codepoint % IM_FONTBAKED_INDEX_PAGE_SIZE];
+    if (glyph_idx == IM_FONTGLYPH_INDEX_UNUSED || glyph_idx == IM_FONTGLYPH_INDEX_NOT_FOUND)
+        return -1;
+    const ImFontGlyph* placeholder = &baked->Glyphs[glyph_idx];
+    if (placeholder->Visible || placeholder->PackId != ImFontAtlasRectId_Invalid)
+        return -1;
+    return glyph_idx;
+}
+
+static const ImFontLoader* ImFontBaked_GetSourceLoader(ImFontBaked* baked, int src_n, void** out_loader_data_for_baked_src)
+{
+    ImFont* font = baked->ContainerFont;
+    ImFontAtlas* atlas = font->ContainerAtlas;
+    char* loader_user_data_p = (char*)baked->FontLoaderDatas;
+    for (int prev_src_n = 0; prev_src_n < src_n; prev_src_n++)
+    {
+        ImFontConfig* prev_src = font->Sources[prev_src_n];
+        loader_user_data_p += (prev_src->FontLoader ? prev_src->FontLoader : atlas->FontLoader)->FontBakedSrcLoaderDataSize;
+    }
+    *out_loader_data_for_baked_src = loader_user_data_p;
+    ImFontConfig* src = font->Sources[src_n];
+    return src->FontLoader ? src->FontLoader : atlas->FontLoader;
+}
+
+// Store a loaded glyph in the Glyphs[] slot of its placeholder, so the index and FallbackGlyphIndex stay valid.
+static void ImFontBaked_BuildReplaceDeferredGlyph(ImFontBaked* baked, int glyph_idx, ImFontGlyph* glyph_buf)
+{
+    ImFontAtlas* atlas = baked->ContainerFont->ContainerAtlas;
+    const ImWchar codepoint = (ImWchar)baked->Glyphs[glyph_idx].Codepoint;
+    glyph_buf->Codepoint = codepoint;
+    glyph_buf->SourceIdx = baked->Glyphs[glyph_idx].SourceIdx;
+    ImFontAtlasBakedAddFontGlyph(atlas, baked, baked->ContainerFont->Sources[glyph_buf->SourceIdx], glyph_buf);
+    baked->Glyphs[glyph_idx] = baked->Glyphs.back();
+    baked->Glyphs.pop_back();
+    ImFontBaked_GetIndexPage(baked, codepoint)->Lookup[codepoint % IM_FONTBAKED_INDEX_PAGE_SIZE] = (ImU16)glyph_idx;
+}
+
+// Rasterize placeholder glyphs of a same bake. Return number of glyphs loaded.
+// When all of them come from a loader implementing FontBakedLoadGlyphs() (e.g. FreeType with worker threads), they are loaded in a single call.
+static int ImFontBaked_BuildLoadDeferredGlyphs(ImFontBaked* baked, const int* glyph_indices, int glyphs_count)
+{
+    ImFont* font = baked->ContainerFont;
+    ImFontAtlas* atlas = font->ContainerAtlas;
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    baked->LastUsedFrame = builder->FrameCount; // Don't let ImFontAtlasTextureMakeSpace() discard it while we are packing
+    void* loader_user_data_p = NULL;
+    const ImFontLoader* batch_loader = ImFontBaked_GetSourceLoader(baked, baked->Glyphs[glyph_indices[0]].SourceIdx, &loader_user_data_p);
+    for (int n = 1; n < glyphs_count && batch_loader != NULL; n++)
+        if (ImFontBaked_GetSourceLoader(baked, baked->Glyphs[glyph_indices[n]].SourceIdx, &loader_user_data_p) != batch_loader)
+            batch_loader = NULL;
+
+    int loaded_count = 0;
+    if (batch_loader != NULL && batch_loader->FontBakedLoadGlyphs != NULL && glyphs_count > 1)
+    {
+        ImVector<ImFontGlyph> glyphs;
+        ImVector<bool> loaded;
+        glyphs.resize(glyphs_count);
+        loaded.resize(glyphs_count, false);
+        for (int n = 0; n < glyphs_count; n++)
+        {
+            ImWchar loader_codepoint = (ImWchar)baked->Glyphs[glyph_indices[n]].Codepoint;
+            ImFontAtlas_FontHookRemapCodepoint(atlas, font, &loader_codepoint);
+            glyphs[n] = ImFontGlyph();
+            glyphs[n].Codepoint = loader_codepoint;
+            glyphs[n].SourceIdx = baked->Glyphs[glyph_indices[n]].SourceIdx;
+        }
+        const ImU64 t0 = ImTimeGetMicroseconds();
+        const bool ret = batch_loader->FontBakedLoadGlyphs(atlas, baked, glyphs.Data, loaded.Data, glyphs_count);
+        builder->FrameBakeMicroseconds += (int)(ImTimeGetMicroseconds() - t0);
+        if (ret)
+        {
+            builder->FrameBakeGlyphs += glyphs_count;
+            for (int n = 0; n < glyphs_count; n++)
+                if (loaded[n])
+                {
+                    ImFontBaked_BuildReplaceDeferredGlyph(baked, glyph_indices[n], &glyphs[n]);
+                    loaded_count++;
+                }
+            return loaded_count;
+        }
+    }
+
+    // Load one by one
+    for (int n = 0; n < glyphs_count; n++)
+    {
+        const ImFontGlyph* placeholder = &baked->Glyphs[glyph_indices[n]];
+        const int src_n = placeholder->SourceIdx;
+        const ImFontLoader* loader = ImFontBaked_GetSourceLoader(baked, src_n, &loader_user_data_p);
+        ImWchar loader_codepoint = (ImWchar)placeholder->Codepoint;
+        ImFontAtlas_FontHookRemapCodepoint(atlas, font, &loader_codepoint);
+        ImFontGlyph glyph_buf;
+        if (!ImFontAtlasBuildLoaderLoadGlyph(atlas, loader, font->Sources[src_n], baked, loader_user_data_p, loader_codepoint, &glyph_buf))
+            continue;
+        ImFontBaked_BuildReplaceDeferredGlyph(baked, glyph_indices[n], &glyph_buf);
+        loaded_count++;
+    }
+    return loaded_count;
+}
+
+// Called by ImFontAtlasUpdateNewFrame() when using ImFontAtlasFlags_DeferGlyphLoading.
+// - Requests are processed in submission order, so output is deterministic for a given sequence of frames.
+// - Consecutive requests for a same bake are loaded together (see ImFontBaked_BuildLoadDeferredGlyphs()).
+// - Requests for discarded bakes are skipped.
+// - Use max_count < 0 to load everything (e.g. if you need final glyphs right away).
+void ImFontAtlasBuildLoadDeferredGlyphs(ImFontAtlas* atlas, int max_count)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder == NULL || atlas->Locked)
+        return;
+    ImVector<int> glyph_indices;
+    ImBitVector glyph_queued;
+    while (builder->DeferredGlyphsHead < builder->DeferredGlyphs.Size && max_count != 0)
+    {
+        const ImGuiID baked_id = builder->DeferredGlyphs[builder->DeferredGlyphsHead].BakedId;
+        ImFontBaked* baked = (ImFontBaked*)builder->BakedMap.GetVoidPtr(baked_id);
+        if (baked != NULL && baked->WantDestroy)
+            baked = NULL;
+        glyph_indices.resize(0);
+        if (baked != NULL)
+            glyph_queued.Create(baked->Glyphs.Size); // (a discarded then recreated bake may have been queued twice)
+        while (builder->DeferredGlyphsHead < builder->DeferredGlyphs.Size && builder->DeferredGlyphs[builder->DeferredGlyphsHead].BakedId == baked_id && glyph_indices.Size != max_count)
+        {
+            ImFontAtlasDeferredGlyph req = builder->DeferredGlyphs[builder->DeferredGlyphsHead++];
+            const int glyph_idx = baked ? ImFontBaked_FindDeferredGlyph(baked, (ImWchar)req.Codepoint) : -1;
+            if (glyph_idx != -1 && !glyph_queued.TestBit(glyph_idx))
+            {
+                glyph_queued.SetBit(glyph_idx);
+                glyph_indices.push_back(glyph_idx);
+            }
+        }
+        if (glyph_indices.Size == 0)
+            continue;
+        builder->DeferredGlyphsLoadedTotal += ImFontBaked_BuildLoadDeferredGlyphs(baked, glyph_indices.Data, glyph_indices.Size);
+        if (max_count > 0)
+            max_count -= glyph_indices.Size;
+    }
+    if (builder->DeferredGlyphsHead == builder->DeferredGlyphs.Size)
+    {
+        builder->DeferredGlyphs.resize(0);
+        builder->DeferredGlyphsHead = 0;
+    }
+}
+
+static float ImFontBaked_BuildLoadGlyphAdvanceX(ImFontBaked* baked, ImWchar codepoint)
+{
+    if (baked->Size >= IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE || baked->LoadNoRenderOnLayout)
+    {
+        // First load AdvanceX value used by CalcTextSize() API then load the rest when loaded by drawing API.
+        float only_advance_x = 0.0f;
+        ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(baked, (ImWchar)codepoint, &only_advance_x);
+        return glyph ? glyph->AdvanceX : only_advance_x;
+    }
+    else
+    {
+        ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(baked, (ImWchar)codepoint, NULL);
+        return glyph ? glyph->AdvanceX : baked->FallbackAdvanceX;
+    }
+}
+
+// The point of this indirection is to not be inlined in debug mode in order to not bloat inner loop.b
+IM_MSVC_RUNTIME_CHECKS_OFF
+static float BuildLoadGlyphGetAdvanceOrFallback(ImFontBaked* baked, unsigned int codepoint)
+{
+    return ImFontBaked_BuildLoadGlyphAdvanceX(baked, (ImWchar)codepoint);
+}
+IM_MSVC_RUNTIME_CHECKS_RESTORE
+
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+void ImFontAtlasDebugLogTextureRequests(ImFontAtlas* atlas)
+{
+    // [DEBUG] Log texture update requests
+    ImGuiContext& g = *GImGui;
+    IM_UNUSED(g);
+    for (ImTextureData* tex : atlas->TexList)
+    {
+        if ((g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures) == 0)
+            IM_ASSERT(tex->Updates.Size == 0);
+        if (tex->Status == ImTextureStatus_WantCreate)
+            IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: create %dx%d\n", tex->UniqueID, tex->Width, tex->Height);
+        else if (tex->Status == ImTextureStatus_WantDestroy)
+            IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: destroy %dx%d, texid=0x%" IM_PRIX64 ", backend_data=%p\n", tex->UniqueID, tex->Width, tex->Height, IM_TEXTUREID_TO_U64(tex->TexID), tex->BackendUserData);
+        else if (tex->Status == ImTextureStatus_WantUpdates)
+        {
+            IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: update %d regions, texid=0x%" IM_PRIX64 ", backend_data=0x%" IM_PRIX64 "\n", tex->UniqueID, tex->Updates.Size, IM_TEXTUREID_TO_U64(tex->TexID), (ImU64)(intptr_t)tex->BackendUserData);
+            for (const ImTextureRect& r : tex->Updates)
+            {
+                IM_UNUSED(r);
+                IM_ASSERT(r.x >= 0 && r.y >= 0);
+                IM_ASSERT(r.x + r.w <= tex->Width && r.y + r.h <= tex->Height); // In theory should subtract PackPadding but it's currently part of atlas and mid-frame change would wreck assert.
+                //IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: update (% 4d..%-4d)->(% 4d..%-4d), texid=0x%" IM_PRIX64 ", backend_data=0x%" IM_PRIX64 "\n", tex->UniqueID, r.x, r.y, r.x + r.w, r.y + r.h, IM_TEXTUREID_TO_U64(tex->TexID), (ImU64)(intptr_t)tex->BackendUserData);
+            }
+        }
+    }
+}
+#endif
+
+//-------------------------------------------------------------------------
+// [SECTION] ImFontAtlas: persistent cache
+//-------------------------------------------------------------------------
+// - ImFontAtlasCacheCalcKey() [Internal]
+// - ImFontAtlas::SaveCacheToMemory()
+// - ImFontAtlas::SaveCacheToDisk()
+// - ImFontAtlas::LoadCacheFromMemory()
+// - ImFontAtlas::LoadCacheFromDisk()
+//-------------------------------------------------------------------------
+// Store texture pixels (including secondary pages), packer state and all baked fonts (glyphs + lookup tables), so next run can skip rasterization entirely.
+// - The cache is keyed on size and fingerprint of all font data (see ImFontAtlasBuildCalcFontDataKey()) + all settings affecting output + version + loader.
+//   When anything differs, loading returns false and leaves the atlas untouched: carry on and save a new cache later.
+// - The format is not portable across architectures/compilers, as some structures are stored raw.
+// - Load after adding fonts and before adding custom rectangles, as loading resets packer state.
+//-------------------------------------------------------------------------
+
+#define IM_FONTATLAS_CACHE_VERSION  6
+
+static ImGuiID ImFontAtlasCacheCalcKey(ImFontAtlas* atlas)
+{
+    ImGuiID key = ImHashData(IMGUI_VERSION, sizeof(IMGUI_VERSION), IM_FONTATLAS_CACHE_VERSION);
+    const int data_sizes[] = { (int)sizeof(ImFontGlyph), (int)sizeof(ImFontBakedIndexPage), (int)sizeof(ImTextureRect), (int)sizeof(ImWchar), (int)sizeof(stbrp_coord) };
+    key = ImHashData(data_sizes, sizeof(data_sizes), key);
+
+    // Atlas settings (we don't include texture sizes as they don't affect glyph output)
+    const int atlas_settings[] = { atlas->Flags & (ImFontAtlasFlags_NoMouseCursors | ImFontAtlasFlags_NoBakedLines), (int)atlas->TexDesiredFormat, atlas->TexGlyphPadding, (int)atlas->FontLoaderFlags, atlas->Fonts.Size };
+    key = ImHashData(atlas_settings, sizeof(atlas_settings), key);
+
+    // Font sources: data + settings
+    for (ImFont* font : atlas->Fonts)
+    {
+        key = ImHashData(&font->Sources.Size, sizeof(int), key);
+        for (ImFontConfig* src : font->Sources)
+        {
+            const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+            if (loader->Name)
+                key = ImHashData(loader->Name, ImStrlen(loader->Name), key);
+            const unsigned int src_data_key[] = { (unsigned int)src->FontDataSize, ImFontAtlasBuildCalcFontDataKey(src->FontData, src->FontDataSize) };
+            key = ImHashData(src_data_key, sizeof(src_data_key), key);
+            const float src_settings_f[] = { src->SizePixels, src->GlyphOffset.x, src->GlyphOffset.y, src->GlyphMinAdvanceX, src->GlyphMaxAdvanceX, src->GlyphExtraAdvanceX, src->RasterizerMultiply, src->RasterizerDensity, src->SdfBakeSize, src->SdfMinSize, src->SdfMaxSize };
+            const int src_settings_i[] = { src->MergeMode, src->PixelSnapH, src->PixelSnapV, src->OversampleH, src->OversampleV, (int)src->EllipsisChar, (int)src->FontNo, (int)src->FontLoaderFlags, src->Flags, src->SdfSpread };
+            key = ImHashData(src_settings_f, sizeof(src_settings_f), key);
+            key = ImHashData(src_settings_i, sizeof(src_settings_i), key);
+            if (const ImWchar* exclude_list = src->GlyphExcludeRanges)
+                for (; exclude_list[0] != 0; exclude_list += 2)
+                    key = ImHashData(exclude_list, sizeof(ImWchar) * 2, key);
+        }
+    }
+    return key;
+}
+
+static void ImFontAtlasCacheWrite(ImVector<unsigned char>* buf, const void* data, size_t data_size)
+{
+    const int off = buf->Size;
+    buf->resize(off + (int)data_size);
+    if (data_size > 0)
+        memcpy(buf->Data + off, data, data_size);
+}
+static void ImFontAtlasCacheWriteInt(ImVector<unsigned char>* buf, int v)       { ImFontAtlasCacheWrite(buf, &v, sizeof(v)); }
+static void ImFontAtlasCacheWriteFloat(ImVector<unsigned char>* buf, float v)   { ImFontAtlasCacheWrite(buf, &v, sizeof(v)); }
+
+static void ImFontAtlasCacheWriteTexture(ImVector<unsigned char>* buf, ImTextureData* tex)
+{
+    ImFontAtlasCacheWriteInt(buf, tex->Width);
+    ImFontAtlasCacheWriteInt(buf, tex->Height);
+    ImFontAtlasCacheWriteInt(buf, (int)tex->Format);
+    ImFontAtlasCacheWriteInt(buf, (tex->UseColors ? 1 : 0) | (tex->UseSdf ? 2 : 0));
+    ImFontAtlasCacheWrite(buf, tex->Pixels, (size_t)tex->GetSizeInBytes());
+}
+
+// Translate stb_rect_pack node pointers into indices: [0..N-1] into nodes[], N+0/N+1 into context->extra[], -1 for NULL.
+static int ImFontAtlasCachePackNodeToIndex(stbrp_context* ctx, ImVector<stbrp_node_im>& nodes, const stbrp_node* node)
+{
+    if (node == NULL)
+        return -1;
+    if (node >= &ctx->extra[0] && node <= &ctx->extra[1])
+        return nodes.Size + (int)(node - &ctx->extra[0]);
+    IM_ASSERT(node >= nodes.Data && node < nodes.Data + nodes.Size);
+    return (int)(node - nodes.Data);
+}
+
+static stbrp_node* ImFontAtlasCachePackIndexToNode(stbrp_context* ctx, ImVector<stbrp_node_im>& nodes, int idx)
+{
+    if (idx < 0)
+        return NULL;
+    if (idx >= nodes.Size)
+        return &ctx->extra[idx - nodes.Size];
+    return &nodes.Data[idx];
+}
+
+static void ImFontAtlasCacheWritePacker(ImVector<unsigned char>* buf, stbrp_context_opaque* ctx_opaque, ImVector<stbrp_node_im>& nodes)
+{
+    stbrp_context* ctx = (stbrp_context*)(void*)ctx_opaque;
+    const int ctx_data[] = { ctx->width, ctx->height, ctx->align, ctx->init_mode, ctx->heuristic, ctx->num_nodes, ImFontAtlasCachePackNodeToIndex(ctx, nodes, ctx->active_head), ImFontAtlasCachePackNodeToIndex(ctx, nodes, ctx->free_head) };
+    ImFontAtlasCacheWrite(buf, ctx_data, sizeof(ctx_data));
+    ImFontAtlasCacheWriteInt(buf, nodes.Size);
+    for (int node_n = 0; node_n < nodes.Size + 2; node_n++)
+    {
+        const stbrp_node* node = ImFontAtlasCachePackIndexToNode(ctx, nodes, node_n);
+        const int node_data[] = { node->x, node->y, ImFontAtlasCachePackNodeToIndex(ctx, nodes, node->next) };
+        ImFontAtlasCacheWrite(buf, node_data, sizeof(node_data));
+    }
+}
+
+// Output is appended to 'out_data'.
+void ImFontAtlas::SaveCacheToMemory(ImVector<unsigned char>* out_data)
+{
+    if (Builder == NULL || TexData == NULL || TexData->Pixels == NULL)
+        return;
+    ImFontAtlasBuilder* builder = Builder;
+    ImVector<unsigned char>* buf = out_data;
+
+    // Placeholder glyphs (ImFontAtlasFlags_DeferGlyphLoading) have no pixels: finish loading them first.
+    if (builder->DeferredGlyphs.Size > builder->DeferredGlyphsHead && !Locked)
+        ImFontAtlasBuildLoadDeferredGlyphs(this, -1);
+
+    // Header
+    ImFontAtlasCacheWrite(buf, "IMFA", 4);
+    ImFontAtlasCacheWriteInt(buf, IM_FONTATLAS_CACHE_VERSION);
+    ImFontAtlasCacheWriteInt(buf, (int)ImFontAtlasCacheCalcKey(this));
+
+    // Texture
+    ImFontAtlasCacheWriteTexture(buf, TexData);
+
+    // Rectangles
+    ImFontAtlasCacheWriteInt(buf, builder->RectsIndexFreeListStart);
+    ImFontAtlasCacheWriteInt(buf, builder->RectsPackedCount);
+    ImFontAtlasCacheWriteInt(buf, builder->RectsPackedSurface);
+    ImFontAtlasCacheWriteInt(buf, builder->RectsDiscardedCount);
+    ImFontAtlasCacheWriteInt(buf, builder->RectsDiscardedSurface);
+    ImFontAtlasCacheWrite(buf, &builder->MaxRectSize, sizeof(ImVec2i));
+    ImFontAtlasCacheWrite(buf, &builder->MaxRectBounds, sizeof(ImVec2i));
+    ImFontAtlasCacheWriteInt(buf, builder->PackIdMouseCursors);
+    ImFontAtlasCacheWriteInt(buf, builder->PackIdLinesTexData);
+    ImFontAtlasCacheWriteInt(buf, builder->Rects.Size);
+    ImFontAtlasCacheWrite(buf, builder->Rects.Data, (size_t)builder->Rects.size_in_bytes());
+    ImFontAtlasCacheWriteInt(buf, builder->RectsIndex.Size);
+    for (const ImFontAtlasRectEntry& entry : builder->RectsIndex)
+    {
+        ImFontAtlasCacheWriteInt(buf, entry.TargetIndex);
+        ImFontAtlasCacheWriteInt(buf, (int)(entry.Generation | (entry.PageIndex << 16) | (entry.IsCustom << 24) | (entry.IsUsed ? 0x80000000u : 0u)));
+    }
+    ImFontAtlasCacheWriteInt(buf, builder->FreeRects.Size);
+    ImFontAtlasCacheWrite(buf, builder->FreeRects.Data, (size_t)builder->FreeRects.size_in_bytes());
+
+    // Packer state
+    ImFontAtlasCacheWritePacker(buf, &builder->PackContext, builder->PackNodes);
+
+    // Secondary pages (ImFontAtlas::TexMaxPages)
+    ImFontAtlasCacheWriteInt(buf, builder->Pages.Size);
+    for (ImFontAtlasPage* page : builder->Pages)
+    {
+        ImFontAtlasCacheWriteInt(buf, page->Tex ? 1 : 0);
+        if (page->Tex == NULL)
+            continue;
+        ImFontAtlasCacheWriteTexture(buf, page->Tex);
+        ImFontAtlasCacheWriteInt(buf, page->RectsCount);
+        ImFontAtlasCacheWriteInt(buf, page->Rects.Size);
+        ImFontAtlasCacheWrite(buf, page->Rects.Data, (size_t)page->Rects.size_in_bytes());
+        ImFontAtlasCacheWritePacker(buf, &page->PackContext, page->PackNodes);
+    }
+
+    // Fonts
+    ImFontAtlasCacheWriteInt(buf, Fonts.Size);
+    for (ImFont* font : Fonts)
+        ImFontAtlasCacheWrite(buf, font->Used8kPagesMap, sizeof(font->Used8kPagesMap));
+
+    // Baked fonts
+    int baked_count = 0;
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+        if (!builder->BakedPool[baked_n].WantDestroy)
+            baked_count++;
+    ImFontAtlasCacheWriteInt(buf, baked_count);
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+    {
+        ImFontBaked* baked = &builder->BakedPool[baked_n];
+        if (baked->WantDestroy)
+            continue;
+        ImFontAtlasCacheWriteInt(buf, Fonts.index_from_ptr(Fonts.find(baked->ContainerFont)));
+        ImFontAtlasCacheWriteFloat(buf, baked->Size);
+        ImFontAtlasCacheWriteFloat(buf, baked->RasterizerDensity);
+        ImFontAtlasCacheWriteFloat(buf, baked->Ascent);
+        ImFontAtlasCacheWriteFloat(buf, baked->Descent);
+        ImFontAtlasCacheWriteFloat(buf, baked->FallbackAdvanceX);
+        ImFontAtlasCacheWriteInt(buf, baked->FallbackGlyphIndex);
+        ImFontAtlasCacheWriteInt(buf, (int)baked->MetricsTotalSurface);
+        ImFontAtlasCacheWriteInt(buf, (int)baked->IsSdf);
+        ImFontAtlasCacheWriteInt(buf, baked->Glyphs.Size);
+        ImFontAtlasCacheWrite(buf, baked->Glyphs.Data, (size_t)baked->Glyphs.size_in_bytes());
+        int index_pages_count = 0;
+        for (ImFontBakedIndexPage* index_page : baked->IndexPages)
+            index_pages_count += (index_page != &ImFontBakedIndexPageEmpty) ? 1 : 0;
+        ImFontAtlasCacheWriteInt(buf, baked->IndexPages.Size);
+        ImFontAtlasCacheWriteInt(buf, index_pages_count);
+        for (int page_n = 0; page_n < baked->IndexPages.Size; page_n++)
+            if (baked->IndexPages[page_n] != &ImFontBakedIndexPageEmpty)
+                ImFontAtlasCacheWriteInt(buf, page_n);
+        for (ImFontBakedIndexPage* index_page : baked->IndexPages)
+            if (index_page != &ImFontBakedIndexPageEmpty)
+                ImFontAtlasCacheWrite(buf, index_page, sizeof(ImFontBakedIndexPage));
+    }
+}
+
+bool ImFontAtlas::SaveCacheToDisk(const char* filename)
+{
+    ImVector<unsigned char> buf;
+    SaveCacheToMemory(&buf);
+    if (buf.Size == 0)
+        return false;
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    const bool ret = ImFileWrite(buf.Data, 1, (ImU64)buf.Size, f) == (ImU64)buf.Size;
+    ImFileClose(f);
+    return ret;
+}
+
+struct ImFontAtlasCacheReader
+{
+    const unsigned char*    Data;
+    const unsigned char*    DataEnd;
+    bool                    Error;
+
+    ImFontAtlasCacheReader(const void* data, size_t data_size) { Data = (const unsigned char*)data; DataEnd = Data + data_size; Error = false; }
+    const void*             Read(size_t size)   { if (Error || size > (size_t)(DataEnd - Data)) { Error = true; return NULL; } const void* p = Data; Data += size; return p; }
+    const void*             ReadArray(int count, size_t elem_size) { if (count < 0) { Error = true; return NULL; } return Read((size_t)count * elem_size); }
+    int                     ReadInt()           { int v = 0; if (const void* p = Read(sizeof(v))) memcpy(&v, p, sizeof(v)); return v; }
+    float                   ReadFloat()         { float v = 0.0f; if (const void* p = Read(sizeof(v))) memcpy(&v, p, sizeof(v)); return v; }
+};
+
+struct ImFontAtlasCacheTexture
+{
+    int                     Width, Height;
+    bool                    UseColors;
+    bool                    UseSdf;
+    const void*             Pixels;
+};
+
+struct ImFontAtlasCachePacker
+{
+    int                     CtxData[8];
+    int                     NodesCount;
+    const void*             NodesData;
+};
+
+struct ImFontAtlasCachePage
+{
+    bool                    Used;
+    ImFontAtlasCacheTexture Tex;
+    int                     RectsCount, RectsSize;
+    const void*             Rects;
+    ImFontAtlasCachePacker  Packer;
+};
+
+struct ImFontAtlasCacheBaked
+{
+    int                     FontIdx;
+    float                   Size, RasterizerDensity, Ascent, Descent, FallbackAdvanceX;
+    int                     FallbackGlyphIndex, MetricsTotalSurface;
+    bool                    IsSdf;
+    int                     GlyphsCount, IndexPagesSize, IndexPagesCount;
+    const void*             Glyphs;
+    const void*             IndexPagesNo;
+    const void*             IndexPagesData;
+};
+
+static bool ImFontAtlasCacheReadTexture(ImFontAtlasCacheReader* r, ImFontAtlas* atlas, ImFontAtlasCacheTexture* out_tex)
+{
+    out_tex->Width = r->ReadInt();
+    out_tex->Height = r->ReadInt();
+    const ImTextureFormat format = (ImTextureFormat)r->ReadInt();
+    const int tex_flags = r->ReadInt();
+    out_tex->UseColors = (tex_flags & 1) != 0;
+    out_tex->UseSdf = (tex_flags & 2) != 0;
+    const int w = out_tex->Width, h = out_tex->Height;
+    if (r->Error || format != atlas->TexDesiredFormat || w <= 0 || h <= 0 || w > 0xFFFF || h > 0xFFFF || !ImIsPowerOfTwo(w) || !ImIsPowerOfTwo(h))
+        return false;
+    out_tex->Pixels = r->ReadArray(w * h, (size_t)ImTextureDataGetFormatBytesPerPixel(format));
+    return !r->Error;
+}
+
+static bool ImFontAtlasCacheReadPacker(ImFontAtlasCacheReader* r, int tex_w, int tex_h, ImFontAtlasCachePacker* out_packer)
+{
+    for (int& v : out_packer->CtxData)
+        v = r->ReadInt();
+    const int nodes_count = out_packer->NodesCount = r->ReadInt();
+    out_packer->NodesData = r->ReadArray(nodes_count + 2, sizeof(int) * 3);
+    if (r->Error || out_packer->CtxData[0] != tex_w || out_packer->CtxData[1] != tex_h || nodes_count != tex_w / 2)
+        return false;
+    for (int n = 0; n < nodes_count + 2; n++)
+    {
+        int node_data[3];
+        memcpy(node_data, (const char*)out_packer->NodesData + n * sizeof(node_data), sizeof(node_data));
+        if (node_data[2] < -1 || node_data[2] >= nodes_count + 2)
+            return false;
+    }
+    const int* ctx_data = out_packer->CtxData;
+    return ctx_data[6] >= -1 && ctx_data[6] < nodes_count + 2 && ctx_data[7] >= -1 && ctx_data[7] < nodes_count + 2;
+}
+
+static void ImFontAtlasCacheRestorePacker(const ImFontAtlasCachePacker* packer, stbrp_context_opaque* ctx_opaque, ImVector<stbrp_node_im>& nodes)
+{
+    stbrp_context* ctx = (stbrp_context*)(void*)ctx_opaque;
+    IM_ASSERT(nodes.Size == packer->NodesCount);
+    ctx->align = packer->CtxData[2];
+    ctx->init_mode = packer->CtxData[3];
+    ctx->heuristic = packer->CtxData[4];
+    ctx->num_nodes = packer->CtxData[5];
+    ctx->active_head = ImFontAtlasCachePackIndexToNode(ctx, nodes, packer->CtxData[6]);
+    ctx->free_head = ImFontAtlasCachePackIndexToNode(ctx, nodes, packer->CtxData[7]);
+    for (int n = 0; n < packer->NodesCount + 2; n++)
+    {
+        int node_data[3];
+        memcpy(node_data, (const char*)packer->NodesData + n * sizeof(node_data), sizeof(node_data));
+        stbrp_node* node = ImFontAtlasCachePackIndexToNode(ctx, nodes, n);
+        node->x = node_data[0];
+        node->y = node_data[1];
+        node->next = ImFontAtlasCachePackIndexToNode(ctx, nodes, node_data[2]);
+    }
+}
+
+// Rectangles are used to copy pixels when growing/repacking textures: they need to be within texture bounds.
+static bool ImFontAtlasCacheValidateRects(const void* rects_data, int rects_count, int tex_w, int tex_h)
+{
+    for (int n = 0; n < rects_count; n++)
+    {
+        ImTextureRect r;
+        memcpy(&r, (const char*)rects_data + n * sizeof(ImTextureRect), sizeof(ImTextureRect));
+        if (r.x + r.w > tex_w || r.y + r.h > tex_h)
+            return false;
+    }
+    return true;
+}
+
+// Valid identifiers are ImFontAtlasRectId_Invalid or refer to a used entry with same generation.
+// Each entry may only be referred to once, as owners discard their rectangle when destroyed.
+static bool ImFontAtlasCacheValidateRectId(const ImVector<ImFontAtlasRectEntry>& rects_index, ImBitVector* rects_referenced, ImFontAtlasRectId id)
+{
+    if (id == ImFontAtlasRectId_Invalid)
+        return true;
+    if (id < 0 || (id & ~(ImFontAtlasRectId_IndexMask_ | ImFontAtlasRectId_GenerationMask_)) != 0)
+        return false;
+    const int index_idx = ImFontAtlasRectId_GetIndex(id);
+    if (index_idx >= rects_index.Size || !rects_index[index_idx].IsUsed || rects_index[index_idx].Generation != ImFontAtlasRectId_GetGeneration(id) || rects_referenced->TestBit(index_idx))
+        return false;
+    rects_referenced->SetBit(index_idx);
+    return true;
+}
+
+// Return false when data is invalid or stale (fonts or settings changed since the cache was saved). The atlas is left untouched in this case.
+// Data is only read during the call: it may point to e.g. a memory mapped file.
+// Every index which is later dereferenced is validated, so corrupted data makes us return false instead of crashing.
+bool ImFontAtlas::LoadCacheFromMemory(const void* data, size_t data_size)
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas!");
+    if (Builder == NULL)
+        ImFontAtlasBuildInit(this);
+
+    // Parse and validate everything before modifying the atlas
+    ImFontAtlasCacheReader r(data, data_size);
+    const void* magic = r.Read(4);
+    if (magic == NULL || memcmp(magic, "IMFA", 4) != 0 || r.ReadInt() != IM_FONTATLAS_CACHE_VERSION || (ImGuiID)r.ReadInt() != ImFontAtlasCacheCalcKey(this))
+    {
+        IMGUI_DEBUG_LOG_FONT("[font] Cache: invalid or stale data.\n");
+        return false;
+    }
+
+    ImFontAtlasCacheTexture main_tex;
+    if (!ImFontAtlasCacheReadTexture(&r, this, &main_tex) || main_tex.UseSdf)
+        return false;
+    const int tex_w = main_tex.Width;
+    const int tex_h = main_tex.Height;
+
+    int builder_data[5];
+    for (int& v : builder_data)
+        v = r.ReadInt();
+    ImVec2i max_rect_size, max_rect_bounds;
+    if (const void* p = r.Read(sizeof(ImVec2i))) memcpy(&max_rect_size, p, sizeof(ImVec2i));
+    if (const void* p = r.Read(sizeof(ImVec2i))) memcpy(&max_rect_bounds, p, sizeof(ImVec2i));
+    const ImFontAtlasRectId pack_id_mouse_cursors = r.ReadInt();
+    const ImFontAtlasRectId pack_id_lines = r.ReadInt();
+    const int rects_count = r.ReadInt();
+    const void* rects_data = r.ReadArray(rects_count, sizeof(ImTextureRect));
+    const int rects_index_count = r.ReadInt();
+    const void* rects_index_data = r.ReadArray(rects_index_count, sizeof(int) * 2);
+    const int free_rects_count = r.ReadInt();
+    const void* free_rects_data = r.ReadArray(free_rects_count, sizeof(ImTextureRect));
+
+    ImFontAtlasCachePacker main_packer;
+    if (!ImFontAtlasCacheReadPacker(&r, tex_w, tex_h, &main_packer))
+        return false;
+    if (!ImFontAtlasCacheValidateRects(rects_data, rects_count, tex_w, tex_h) || !ImFontAtlasCacheValidateRects(free_rects_data, free_rects_count, tex_w, tex_h))
+        return false;
+
+    ImVector<ImFontAtlasCachePage> pages;
+    const int pages_count = r.ReadInt();
+    if (r.Error || pages_count < 0 || pages_count + 1 > IM_FONTATLAS_MAX_PAGES)
+        return false;
+    pages.resize(pages_count);
+    for (ImFontAtlasCachePage& page : pages)
+    {
+        page.Used = r.ReadInt() != 0;
+        if (!page.Used)
+            continue;
+        if (!ImFontAtlasCacheReadTexture(&r, this, &page.Tex))
+            return false;
+        page.RectsCount = r.ReadInt();
+        page.RectsSize = r.ReadInt();
+        page.Rects = r.ReadArray(page.RectsSize, sizeof(ImTextureRect));
+        if (r.Error || page.RectsCount < 0 || page.RectsCount > page.RectsSize || !ImFontAtlasCacheReadPacker(&r, page.Tex.Width, page.Tex.Height, &page.Packer))
+            return false;
+        if (!ImFontAtlasCacheValidateRects(page.Rects, page.RectsSize, page.Tex.Width, page.Tex.Height))
+            return false;
+    }
+
+    const int fonts_count = r.ReadInt();
+    if (fonts_count != Fonts.Size)
+        return false;
+    const void* fonts_data = r.ReadArray(fonts_count, sizeof(Fonts[0]->Used8kPagesMap));
+
+    ImVector<ImFontAtlasCacheBaked> bakeds;
+    bakeds.resize(ImMax(r.ReadInt(), 0));
+    for (ImFontAtlasCacheBaked& b : bakeds)
+    {
+        b.FontIdx = r.ReadInt();
+        b.Size = r.ReadFloat();
+        b.RasterizerDensity = r.ReadFloat();
+        b.Ascent = r.ReadFloat();
+        b.Descent = r.ReadFloat();
+        b.FallbackAdvanceX = r.ReadFloat();
+        b.FallbackGlyphIndex = r.ReadInt();
+        b.MetricsTotalSurface = r.ReadInt();
+        b.IsSdf = r.ReadInt() != 0;
+        b.GlyphsCount = r.ReadInt();
+        b.Glyphs = r.ReadArray(b.GlyphsCount, sizeof(ImFontGlyph));
+        b.IndexPagesSize = r.ReadInt();
+        b.IndexPagesCount = r.ReadInt();
+        b.IndexPagesNo = r.ReadArray(b.IndexPagesCount, sizeof(int));
+        b.IndexPagesData = r.ReadArray(b.IndexPagesCount, sizeof(ImFontBakedIndexPage));
+        if (r.Error || b.FontIdx < 0 || b.FontIdx >= Fonts.Size || !(b.Size > 0.0f) || !(b.RasterizerDensity > 0.0f) || b.GlyphsCount >= IM_FONTGLYPH_INDEX_NOT_FOUND || b.FallbackGlyphIndex < -1 || b.FallbackGlyphIndex >= b.GlyphsCount)
+            return false;
+        if (b.IndexPagesSize < b.IndexPagesCount || b.IndexPagesSize > (IM_UNICODE_CODEPOINT_MAX + IM_FONTBAKED_INDEX_PAGE_SIZE) / IM_FONTBAKED_INDEX_PAGE_SIZE)
+            return false;
+        for (int n = 0; n < b.IndexPagesCount; n++)
+        {
+            int page_n;
+            memcpy(&page_n, (const char*)b.IndexPagesNo + n * sizeof(int), sizeof(int));
+            if (page_n < 0 || page_n >= b.IndexPagesSize)
+                return false;
+        }
+    }
+    if (r.Error)
+        return false;
+
+    // Validate indices into rectangles (we don't fully validate pixels/positions, data is supposed to come from SaveCacheToMemory())
+    if (rects_index_count > ImFontAtlasRectId_IndexMask_ + 1)
+        return false;
+    ImVector<ImFontAtlasRectEntry> rects_index;
+    rects_index.resize(rects_index_count);
+    for (int n = 0; n < rects_index_count; n++)
+    {
+        int entry_data[2];
+        memcpy(entry_data, (const char*)rects_index_data + n * sizeof(entry_data), sizeof(entry_data));
+        const int page_n = (entry_data[1] >> 16) & 0x1F;
+        const int page_rects_count = (page_n == 0) ? rects_count : (page_n <= pages.Size && pages[page_n - 1].Used) ? pages[page_n - 1].RectsSize : 0;
+        if (((unsigned int)entry_data[1] & 0x80000000u) ? (entry_data[0] < 0 || entry_data[0] >= page_rects_count) : (entry_data[0] < -1 || entry_data[0] >= rects_index_count))
+            return false;
+        ImFontAtlasRectEntry& entry = rects_index[n];
+        entry.TargetIndex = entry_data[0];
+        entry.Generation = entry_data[1] & 0x3FF;
+        entry.PageIndex = page_n;
+        entry.IsUsed = ((unsigned int)entry_data[1] & 0x80000000u) ? 1 : 0;
+        entry.IsCustom = (entry_data[1] >> 24) & 1;
+    }
+    ImBitVector rects_referenced;
+    rects_referenced.Create(ImMax(rects_index_count, 1));
+    if (!ImFontAtlasCacheValidateRectId(rects_index, &rects_referenced, pack_id_mouse_cursors) || !ImFontAtlasCacheValidateRectId(rects_index, &rects_referenced, pack_id_lines))
+        return false;
+    const int rects_index_free_list_start = builder_data[0];
+    if (rects_index_free_list_start < -1 || rects_index_free_list_start >= rects_index_count || (rects_index_free_list_start >= 0 && rects_index[rects_index_free_list_start].IsUsed))
+        return false;
+
+    // Validate glyphs and lookup tables: those are dereferenced by FindGlyph(), RenderText(), GetCustomRect() etc.
+    for (const ImFontAtlasCacheBaked& b : bakeds)
     {
-        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
-        if (!src->GlyphExcludeRanges || ImFontAtlasBuildAcceptCodepointForSource(src, codepoint))
+        const ImFont* font = Fonts[b.FontIdx];
+        for (int glyph_n = 0; glyph_n < b.GlyphsCount; glyph_n++)
         {
-            if (only_load_advance_x == NULL)
-            {
-                ImFontGlyph glyph_buf;
-                if (loader->FontBakedLoadGlyph(atlas, src, baked, loader_user_data_p, codepoint, &glyph_buf, NULL))
-                {
-                    // FIXME: Add hooks for e.g. #7962
-                    glyph_buf.Codepoint = src_codepoint;
-                    glyph_buf.SourceIdx = src_n;
-                    return ImFontAtlasBakedAddFontGlyph(atlas, baked, src, &glyph_buf);
-                }
-            }
-            else
+            ImFontGlyph glyph;
+            memcpy(&glyph, (const char*)b.Glyphs + glyph_n * sizeof(ImFontGlyph), sizeof(ImFontGlyph));
+            if ((int)glyph.SourceIdx >= font->Sources.Size || !ImFontAtlasCacheValidateRectId(rects_index, &rects_referenced, glyph.PackId))
+                return false;
+            if (glyph.PageIndex != 0 && ((int)glyph.PageIndex > pages.Size || !pages[glyph.PageIndex - 1].Used))
+                return false;
+            if (glyph.PackId != ImFontAtlasRectId_Invalid && rects_index[ImFontAtlasRectId_GetIndex(glyph.PackId)].PageIndex != glyph.PageIndex)
+                return false;
+        }
+        for (int n = 0; n < b.IndexPagesCount; n++)
+        {
+            const char* lookup_data = (const char*)b.IndexPagesData + n * sizeof(ImFontBakedIndexPage) + offsetof(ImFontBakedIndexPage, Lookup); // Data may be unaligned
+            for (int c = 0; c < IM_FONTBAKED_INDEX_PAGE_SIZE; c++)
             {
-                // Special mode but only loading glyphs metrics. Will rasterize and pack later.
-                if (loader->FontBakedLoadGlyph(atlas, src, baked, loader_user_data_p, codepoint, NULL, only_load_advance_x))
-                {
-                    ImFontAtlasBakedAddFontGlyphAdvancedX(atlas, baked, src, codepoint, *only_load_advance_x);
-                    return NULL;
-                }
+                ImU16 glyph_idx;
+                memcpy(&glyph_idx, lookup_data + c * sizeof(ImU16), sizeof(ImU16));
+                if (glyph_idx >= b.GlyphsCount && glyph_idx != IM_FONTGLYPH_INDEX_UNUSED && glyph_idx != IM_FONTGLYPH_INDEX_NOT_FOUND)
+                    return false;
             }
         }
-        loader_user_data_p += loader->FontBakedSrcLoaderDataSize;
-        src_n++;
     }
 
-    // Lazily load fallback glyph
-    if (baked->LoadNoFallback)
-        return NULL;
-    if (baked->FallbackGlyphIndex == -1)
-        ImFontAtlasBuildSetupFontBakedFallback(baked);
-
-    // Mark index as not found, so we don't attempt the search twice
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = baked->FallbackAdvanceX;
-    baked->IndexLookup[codepoint] = IM_FONTGLYPH_INDEX_NOT_FOUND;
-    return NULL;
-}
+    // Recreate builder and texture
+    // (this is roughly ImFontAtlasBuildClear() but creating texture with our size)
+    IMGUI_DEBUG_LOG_FONT("[font] Cache: loading %dx%d texture, %d rects, %d baked fonts.\n", tex_w, tex_h, rects_count, bakeds.Size);
+    const int frame_count = Builder->FrameCount;
+    ImFontAtlasBuildDestroy(this);
+    ImTextureData* tex = ImFontAtlasTextureAdd(this, tex_w, tex_h);
+    tex->UseColors = TexPixelsUseColors = main_tex.UseColors;
+    ImFontAtlasBuildInit(this);
+    for (ImFontConfig& src : Sources)
+        ImFontAtlasFontSourceInit(this, &src);
+    for (ImFont* font : Fonts)
+        for (ImFontConfig* src : font->Sources)
+            ImFontAtlasFontSourceAddToFont(this, font, src);
+    IM_ASSERT(TexData == tex);
+    memcpy(tex->Pixels, main_tex.Pixels, (size_t)tex->GetSizeInBytes());
 
-static float ImFontBaked_BuildLoadGlyphAdvanceX(ImFontBaked* baked, ImWchar codepoint)
-{
-    if (baked->Size >= IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE || baked->LoadNoRenderOnLayout)
-    {
-        // First load AdvanceX value used by CalcTextSize() API then load the rest when loaded by drawing API.
-        float only_advance_x = 0.0f;
-        ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(baked, (ImWchar)codepoint, &only_advance_x);
-        return glyph ? glyph->AdvanceX : only_advance_x;
-    }
-    else
-    {
-        ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(baked, (ImWchar)codepoint, NULL);
-        return glyph ? glyph->AdvanceX : baked->FallbackAdvanceX;
+    // Restore rectangles and packer state
+    ImFontAtlasBuilder* builder = Builder;
+    builder->FrameCount = frame_count;
+    builder->RectsIndexFreeListStart = builder_data[0];
+    builder->RectsPackedCount = builder_data[1];
+    builder->RectsPackedSurface = builder_data[2];
+    builder->RectsDiscardedCount = builder_data[3];
+    builder->RectsDiscardedSurface = builder_data[4];
+    builder->MaxRectSize = max_rect_size;
+    builder->MaxRectBounds = max_rect_bounds;
+    builder->PackIdMouseCursors = pack_id_mouse_cursors;
+    builder->PackIdLinesTexData = pack_id_lines;
+    builder->Rects.resize(rects_count);
+    memcpy(builder->Rects.Data, rects_data, (size_t)builder->Rects.size_in_bytes());
+    builder->RectsIndex.swap(rects_index);
+    builder->FreeRects.resize(free_rects_count);
+    if (free_rects_count > 0)
+        memcpy(builder->FreeRects.Data, free_rects_data, (size_t)builder->FreeRects.size_in_bytes());
+    builder->DefragWanted = (free_rects_count > 0);
+    ImFontAtlasCacheRestorePacker(&main_packer, &builder->PackContext, builder->PackNodes);
+
+    // Restore secondary pages
+    for (int page_n = 1; page_n <= pages.Size; page_n++)
+    {
+        builder->Pages.push_back(IM_NEW(ImFontAtlasPage)());
+        const ImFontAtlasCachePage& src_page = pages[page_n - 1];
+        if (!src_page.Used)
+            continue;
+        ImFontAtlasPageInit(this, page_n, src_page.Tex.Width, src_page.Tex.Height, src_page.Tex.UseSdf);
+        ImFontAtlasPage* page = builder->Pages[page_n - 1];
+        page->Tex->UseColors = src_page.Tex.UseColors;
+        memcpy(page->Tex->Pixels, src_page.Tex.Pixels, (size_t)page->Tex->GetSizeInBytes());
+        page->RectsCount = src_page.RectsCount;
+        page->Rects.resize(src_page.RectsSize);
+        memcpy(page->Rects.Data, src_page.Rects, (size_t)page->Rects.size_in_bytes());
+        ImFontAtlasCacheRestorePacker(&src_page.Packer, &page->PackContext, page->PackNodes);
+    }
+
+    // Restore fonts and baked fonts
+    for (int font_n = 0; font_n < Fonts.Size; font_n++)
+        memcpy(Fonts[font_n]->Used8kPagesMap, (const char*)fonts_data + font_n * sizeof(Fonts[0]->Used8kPagesMap), sizeof(Fonts[0]->Used8kPagesMap));
+    for (const ImFontAtlasCacheBaked& b : bakeds)
+    {
+        ImFont* font = Fonts[b.FontIdx];
+        const ImGuiID baked_id = ImFontAtlasBakedGetId(font->FontId, b.Size, b.IsSdf ? 0.0f : b.RasterizerDensity);
+        if (builder->BakedMap.GetVoidPtr(baked_id) != NULL)
+            continue;
+        ImFontBaked* baked = ImFontAtlasBakedAdd(this, font, b.Size, b.RasterizerDensity, baked_id, b.IsSdf);
+        baked->Ascent = b.Ascent;
+        baked->Descent = b.Descent;
+        baked->FallbackAdvanceX = b.FallbackAdvanceX;
+        baked->FallbackGlyphIndex = b.FallbackGlyphIndex;
+        baked->MetricsTotalSurface = (unsigned int)b.MetricsTotalSurface;
+        baked->Glyphs.resize(b.GlyphsCount);
+        memcpy(baked->Glyphs.Data, b.Glyphs, (size_t)baked->Glyphs.size_in_bytes());
+        for (ImFontGlyph& glyph : baked->Glyphs)
+            glyph.LastUsedFrame = builder->FrameCount;
+        baked->IndexPages.resize(b.IndexPagesSize, (ImFontBakedIndexPage*)&ImFontBakedIndexPageEmpty);
+        for (int n = 0; n < b.IndexPagesCount; n++)
+        {
+            int page_n;
+            memcpy(&page_n, (const char*)b.IndexPagesNo + n * sizeof(int), sizeof(int));
+            ImFontBakedIndexPage* index_page = ImFontBaked_BuildGetIndexPage(baked, (unsigned int)page_n * IM_FONTBAKED_INDEX_PAGE_SIZE);
+            memcpy(index_page, (const char*)b.IndexPagesData + n * sizeof(ImFontBakedIndexPage), sizeof(ImFontBakedIndexPage));
+        }
+        builder->BakedMap.SetVoidPtr(baked_id, baked);
     }
-}
 
-// The point of this indirection is to not be inlined in debug mode in order to not bloat inner loop.b
-IM_MSVC_RUNTIME_CHECKS_OFF
-static float BuildLoadGlyphGetAdvanceOrFallback(ImFontBaked* baked, unsigned int codepoint)
-{
-    return ImFontBaked_BuildLoadGlyphAdvanceX(baked, (ImWchar)codepoint);
+    // Refresh cached UV
+    ImFontAtlasBuildUpdateLinesTexData(this);
+    ImFontAtlasBuildUpdateBasicTexData(this);
+    ImFontAtlasUpdateDrawListsSharedData(this);
+    return true;
 }
-IM_MSVC_RUNTIME_CHECKS_RESTORE
 
-#ifndef IMGUI_DISABLE_DEBUG_TOOLS
-void ImFontAtlasDebugLogTextureRequests(ImFontAtlas* atlas)
+bool ImFontAtlas::LoadCacheFromDisk(const char* filename)
 {
-    // [DEBUG] Log texture update requests
-    ImGuiContext& g = *GImGui;
-    IM_UNUSED(g);
-    for (ImTextureData* tex : atlas->TexList)
+    size_t data_size = 0;
+    if (const void* mapped_data = (Flags & ImFontAtlasFlags_FileMapping) ? ImFileMap(filename, &data_size) : NULL)
     {
-        if ((g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures) == 0)
-            IM_ASSERT(tex->Updates.Size == 0);
-        if (tex->Status == ImTextureStatus_WantCreate)
-            IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: create %dx%d\n", tex->UniqueID, tex->Width, tex->Height);
-        else if (tex->Status == ImTextureStatus_WantDestroy)
-            IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: destroy %dx%d, texid=0x%" IM_PRIX64 ", backend_data=%p\n", tex->UniqueID, tex->Width, tex->Height, IM_TEXTUREID_TO_U64(tex->TexID), tex->BackendUserData);
-        else if (tex->Status == ImTextureStatus_WantUpdates)
-        {
-            IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: update %d regions, texid=0x%" IM_PRIX64 ", backend_data=0x%" IM_PRIX64 "\n", tex->UniqueID, tex->Updates.Size, IM_TEXTUREID_TO_U64(tex->TexID), (ImU64)(intptr_t)tex->BackendUserData);
-            for (const ImTextureRect& r : tex->Updates)
-            {
-                IM_UNUSED(r);
-                IM_ASSERT(r.x >= 0 && r.y >= 0);
-                IM_ASSERT(r.x + r.w <= tex->Width && r.y + r.h <= tex->Height); // In theory should subtract PackPadding but it's currently part of atlas and mid-frame change would wreck assert.
-                //IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: update (% 4d..%-4d)->(% 4d..%-4d), texid=0x%" IM_PRIX64 ", backend_data=0x%" IM_PRIX64 "\n", tex->UniqueID, r.x, r.y, r.x + r.w, r.y + r.h, IM_TEXTUREID_TO_U64(tex->TexID), (ImU64)(intptr_t)tex->BackendUserData);
-            }
-        }
+        const bool ret = LoadCacheFromMemory(mapped_data, data_size);
+        ImFileUnmap(mapped_data);
+        return ret;
     }
+    void* data = ImFileLoadToMemory(filename, "rb", &data_size);
+    if (data == NULL)
+        return false;
+    const bool ret = LoadCacheFromMemory(data, data_size);
+    IM_FREE(data);
+    return ret;
 }
-#endif
 
 //-------------------------------------------------------------------------
 // [SECTION] ImFontAtlas: backend for stb_truetype
@@ -4658,9 +6547,86 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
     out_glyph->Codepoint = codepoint;
     out_glyph->AdvanceX = advance * scale_for_layout;
 
+    const float ref_size = baked->ContainerFont->Sources[0]->SizePixels;
+    const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
+    float font_off_x = (src->GlyphOffset.x * offsets_scale);
+    float font_off_y = (src->GlyphOffset.y * offsets_scale);
+    if (src->PixelSnapH) // Snap scaled offset. This is to mitigate backward compatibility issues for GlyphOffset, but a better design would be welcome.
+        font_off_x = IM_ROUND(font_off_x);
+    if (src->PixelSnapV)
+        font_off_y = IM_ROUND(font_off_y);
+
+    // Signed distance field (ImFontConfig::SdfBakeSize)
+    // stbtt_GetGlyphSDF() adds 'spread' pixels around the glyph, and maps the edge to 128 and 'spread' pixels of distance to 0/255.
+    const bool is_visible = (x0 != x1 && y0 != y1);
+
+    // Metrics only mode (ImFontAtlasFlags_MetricsOnly): output the same box as the code below, without rasterizing nor packing.
+    if (is_visible && (atlas->Flags & ImFontAtlasFlags_MetricsOnly))
+    {
+        int w, h;
+        float recip_h, recip_v;
+        if (baked->IsSdf)
+        {
+            // Same box as stbtt_GetGlyphSDF()
+            const int spread = ImMax((int)baked->ContainerFont->Sources[0]->SdfSpread, 1);
+            stbtt_GetGlyphBitmapBoxSubpixel(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_x, 0, 0, &x0, &y0, &x1, &y1);
+            if (x0 == x1 || y0 == y1)
+                return true;
+            x0 -= spread;
+            y0 -= spread;
+            w = x1 - x0 + spread;
+            h = y1 - y0 + spread;
+            recip_h = recip_v = 1.0f / rasterizer_density;
+        }
+        else
+        {
+            // Same box and offset as stbtt_MakeGlyphBitmapSubpixelPrefilter()
+            w = (x1 - x0 + oversample_h - 1);
+            h = (y1 - y0 + oversample_v - 1);
+            font_off_x += (float)-(oversample_h - 1) / (2.0f * (float)oversample_h);
+            font_off_y += (float)-(oversample_v - 1) / (2.0f * (float)oversample_v);
+            recip_h = 1.0f / (oversample_h * rasterizer_density);
+            recip_v = 1.0f / (oversample_v * rasterizer_density);
+        }
+        font_off_y += IM_ROUND(baked->Ascent);
+        out_glyph->X0 = x0 * recip_h + font_off_x;
+        out_glyph->Y0 = y0 * recip_v + font_off_y;
+        out_glyph->X1 = (x0 + w) * recip_h + font_off_x;
+        out_glyph->Y1 = (y0 + h) * recip_v + font_off_y;
+        out_glyph->Visible = true;
+        return true;
+    }
+
+    if (is_visible && baked->IsSdf)
+    {
+        const int spread = ImMax((int)baked->ContainerFont->Sources[0]->SdfSpread, 1);
+        int w, h, sdf_x0, sdf_y0;
+        unsigned char* sdf_pixels = stbtt_GetGlyphSDF(&bd_font_data->FontInfo, scale_for_raster_x, glyph_index, spread, 128, 128.0f / spread, &w, &h, &sdf_x0, &sdf_y0);
+        if (sdf_pixels == NULL)
+            return true;
+        ImFontAtlasRectId pack_id = ImFontAtlasPackAddSdfRect(atlas, w, h);
+        if (pack_id == ImFontAtlasRectId_Invalid)
+        {
+            stbtt_FreeSDF(sdf_pixels, NULL);
+            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+            return false;
+        }
+        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+        font_off_y += IM_ROUND(baked->Ascent);
+        const float recip = 1.0f / rasterizer_density;
+        out_glyph->X0 = sdf_x0 * recip + font_off_x;
+        out_glyph->Y0 = sdf_y0 * recip + font_off_y;
+        out_glyph->X1 = (sdf_x0 + w) * recip + font_off_x;
+        out_glyph->Y1 = (sdf_y0 + h) * recip + font_off_y;
+        out_glyph->Visible = true;
+        out_glyph->PackId = pack_id;
+        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, sdf_pixels, ImTextureFormat_Alpha8, w);
+        stbtt_FreeSDF(sdf_pixels, NULL);
+        return true;
+    }
+
     // Pack and retrieve position inside texture atlas
     // (generally based on stbtt_PackFontRangesRenderIntoRects)
-    const bool is_visible = (x0 != x1 && y0 != y1);
     if (is_visible)
     {
         const int w = (x1 - x0 + oversample_h - 1);
@@ -4687,14 +6653,6 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
         stbtt_MakeGlyphBitmapSubpixelPrefilter(&bd_font_data->FontInfo, bitmap_pixels, w, h, w,
             scale_for_raster_x, scale_for_raster_y, 0, 0, oversample_h, oversample_v, &sub_x, &sub_y, glyph_index);
 
-        const float ref_size = baked->ContainerFont->Sources[0]->SizePixels;
-        const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
-        float font_off_x = (src->GlyphOffset.x * offsets_scale);
-        float font_off_y = (src->GlyphOffset.y * offsets_scale);
-        if (src->PixelSnapH) // Snap scaled offset. This is to mitigate backward compatibility issues for GlyphOffset, but a better design would be welcome.
-            font_off_x = IM_ROUND(font_off_x);
-        if (src->PixelSnapV)
-            font_off_y = IM_ROUND(font_off_y);
         font_off_x += sub_x;
         font_off_y += sub_y + IM_ROUND(baked->Ascent);
         float recip_h = 1.0f / (oversample_h * rasterizer_density);
@@ -5060,8 +7018,10 @@ void ImFontBaked::ClearOutputData()
 {
     FallbackAdvanceX = 0.0f;
     Glyphs.clear();
-    IndexAdvanceX.clear();
-    IndexLookup.clear();
+    for (ImFontBakedIndexPage* index_page : IndexPages)
+        if (index_page != &ImFontBakedIndexPageEmpty)
+            IM_FREE(index_page);
+    IndexPages.clear();
     FallbackGlyphIndex = -1;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
@@ -5110,19 +7070,30 @@ ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked
     int glyph_idx = baked->Glyphs.Size;
     baked->Glyphs.push_back(*in_glyph);
     ImFontGlyph* glyph = &baked->Glyphs[glyph_idx];
-    IM_ASSERT(baked->Glyphs.Size < 0xFFFE); // IndexLookup[] hold 16-bit values and -1/-2 are reserved.
+    glyph->LastUsedFrame = atlas->Builder->FrameCount;
+    IM_ASSERT(baked->Glyphs.Size < 0xFFFE); // ImFontBakedIndexPage::Lookup[] hold 16-bit values and -1/-2 are reserved.
 
     // Set UV from packed rectangle
     if (glyph->PackId != ImFontAtlasRectId_Invalid)
     {
         ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph->PackId);
         IM_ASSERT(glyph->U0 == 0.0f && glyph->V0 == 0.0f && glyph->U1 == 0.0f && glyph->V1 == 0.0f);
-        glyph->U0 = (r->x) * atlas->TexUvScale.x;
-        glyph->V0 = (r->y) * atlas->TexUvScale.y;
-        glyph->U1 = (r->x + r->w) * atlas->TexUvScale.x;
-        glyph->V1 = (r->y + r->h) * atlas->TexUvScale.y;
+        const int page_n = ImFontAtlasPackGetRectPage(atlas, glyph->PackId);
+        ImTextureData* tex = ImFontAtlasPageGetTexture(atlas, page_n);
+        const ImVec2 uv_scale = (page_n == 0) ? atlas->TexUvScale : ImVec2(1.0f / tex->Width, 1.0f / tex->Height);
+        glyph->PageIndex = page_n;
+        glyph->U0 = (r->x) * uv_scale.x;
+        glyph->V0 = (r->y) * uv_scale.y;
+        glyph->U1 = (r->x + r->w) * uv_scale.x;
+        glyph->V1 = (r->y + r->h) * uv_scale.y;
         baked->MetricsTotalSurface += r->w * r->h;
     }
+    else if (glyph->Visible && (atlas->Flags & ImFontAtlasFlags_MetricsOnly))
+    {
+        // Metrics only mode: glyphs have no pixels, but are still rendered as quads.
+        glyph->U0 = glyph->U1 = atlas->TexUvWhitePixel.x;
+        glyph->V0 = glyph->V1 = atlas->TexUvWhitePixel.y;
+    }
 
     if (src != NULL)
     {
@@ -5145,13 +7116,13 @@ ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked
         glyph->AdvanceX = advance_x + src->GlyphExtraAdvanceX;
     }
     if (glyph->Colored)
-        atlas->TexPixelsUseColors = atlas->TexData->UseColors = true;
+        atlas->TexPixelsUseColors = ImFontAtlasPageGetTexture(atlas, glyph->PageIndex)->UseColors = true;
 
     // Update lookup tables
     const int codepoint = glyph->Codepoint;
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = glyph->AdvanceX;
-    baked->IndexLookup[codepoint] = (ImU16)glyph_idx;
+    ImFontBakedIndexPage* index_page = ImFontBaked_BuildGetIndexPage(baked, codepoint);
+    index_page->AdvanceX[codepoint % IM_FONTBAKED_INDEX_PAGE_SIZE] = glyph->AdvanceX;
+    index_page->Lookup[codepoint % IM_FONTBAKED_INDEX_PAGE_SIZE] = (ImU16)glyph_idx;
     const int page_n = codepoint / 8192;
     baked->ContainerFont->Used8kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
 
@@ -5177,14 +7148,13 @@ void ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* bake
         advance_x += src->GlyphExtraAdvanceX;
     }
 
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = advance_x;
+    ImFontBaked_BuildGetIndexPage(baked, codepoint)->AdvanceX[codepoint % IM_FONTBAKED_INDEX_PAGE_SIZE] = advance_x;
 }
 
 // Copy to texture, post-process and queue update for backend
 void ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch)
 {
-    ImTextureData* tex = atlas->TexData;
+    ImTextureData* tex = (glyph->PackId != ImFontAtlasRectId_Invalid) ? ImFontAtlasPageGetTexture(atlas, ImFontAtlasPackGetRectPage(atlas, glyph->PackId)) : atlas->TexData;
     IM_ASSERT(r->x + r->w <= tex->Width && r->y + r->h <= tex->Height);
     ImFontAtlasTextureBlockConvert(src_pixels, src_fmt, src_pitch, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h);
     ImFontAtlasPostProcessData pp_data = { atlas, baked->ContainerFont, src, baked, glyph, tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h };
@@ -5200,9 +7170,10 @@ void ImFont::AddRemapChar(ImWchar from_codepoint, ImWchar to_codepoint)
 // Find glyph, load if necessary, return fallback if missing
 ImFontGlyph* ImFontBaked::FindGlyph(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
+    const unsigned int page_n = c / IM_FONTBAKED_INDEX_PAGE_SIZE;
+    if (page_n < (unsigned int)IndexPages.Size) IM_LIKELY
     {
-        const int i = (int)IndexLookup.Data[c];
+        const int i = (int)IndexPages.Data[page_n]->Lookup[c % IM_FONTBAKED_INDEX_PAGE_SIZE];
         if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
             return &Glyphs.Data[FallbackGlyphIndex];
         if (i != IM_FONTGLYPH_INDEX_UNUSED)
@@ -5215,9 +7186,10 @@ ImFontGlyph* ImFontBaked::FindGlyph(ImWchar c)
 // Attempt to load but when missing, return NULL instead of FallbackGlyph
 ImFontGlyph* ImFontBaked::FindGlyphNoFallback(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
+    const unsigned int page_n = c / IM_FONTBAKED_INDEX_PAGE_SIZE;
+    if (page_n < (unsigned int)IndexPages.Size) IM_LIKELY
     {
-        const int i = (int)IndexLookup.Data[c];
+        const int i = (int)IndexPages.Data[page_n]->Lookup[c % IM_FONTBAKED_INDEX_PAGE_SIZE];
         if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
             return NULL;
         if (i != IM_FONTGLYPH_INDEX_UNUSED)
@@ -5231,9 +7203,10 @@ ImFontGlyph* ImFontBaked::FindGlyphNoFallback(ImWchar c)
 
 bool ImFontBaked::IsGlyphLoaded(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
+    const unsigned int page_n = c / IM_FONTBAKED_INDEX_PAGE_SIZE;
+    if (page_n < (unsigned int)IndexPages.Size) IM_LIKELY
     {
-        const int i = (int)IndexLookup.Data[c];
+        const int i = (int)IndexPages.Data[page_n]->Lookup[c % IM_FONTBAKED_INDEX_PAGE_SIZE];
         if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
             return false;
         if (i != IM_FONTGLYPH_INDEX_UNUSED)
@@ -5242,6 +7215,15 @@ bool ImFontBaked::IsGlyphLoaded(ImWchar c)
     return false;
 }
 
+size_t ImFontBaked::GetMemoryUsage() const
+{
+    size_t size_in_bytes = (size_t)Glyphs.size_in_bytes() + (size_t)IndexPages.size_in_bytes();
+    for (const ImFontBakedIndexPage* index_page : IndexPages)
+        if (index_page != &ImFontBakedIndexPageEmpty)
+            size_in_bytes += sizeof(ImFontBakedIndexPage);
+    return size_in_bytes;
+}
+
 // This is not fast query
 bool ImFont::IsGlyphInFont(ImWchar c)
 {
@@ -5256,14 +7238,20 @@ bool ImFont::IsGlyphInFont(ImWchar c)
     return false;
 }
 
+static inline const float* ImFontBaked_GetIndexPage0AdvanceX(ImFontBaked* baked)
+{
+    return (baked->IndexPages.Size > 0) ? baked->IndexPages.Data[0]->AdvanceX : ImFontBakedIndexPageEmpty.AdvanceX;
+}
+
 // This is manually inlined in CalcTextSizeA() and CalcWordWrapPosition(), with a non-inline call to BuildLoadGlyphGetAdvanceOrFallback().
 IM_MSVC_RUNTIME_CHECKS_OFF
 float ImFontBaked::GetCharAdvance(ImWchar c)
 {
-    if ((int)c < IndexAdvanceX.Size)
+    const unsigned int page_n = c / IM_FONTBAKED_INDEX_PAGE_SIZE;
+    if (page_n < (unsigned int)IndexPages.Size)
     {
         // Missing glyphs fitting inside index will have stored FallbackAdvanceX already.
-        const float x = IndexAdvanceX.Data[c];
+        const float x = IndexPages.Data[page_n]->AdvanceX[c % IM_FONTBAKED_INDEX_PAGE_SIZE];
         if (x >= 0.0f)
             return x;
     }
@@ -5293,6 +7281,8 @@ ImFontBaked* ImFont::GetFontBaked(float size, float density)
         density = CurrentRasterizerDensity;
     if (baked && baked->Size == size && baked->RasterizerDensity == density)
         return baked;
+    if (baked && baked->IsSdf && size >= Sources[0]->SdfMinSize && size <= Sources[0]->SdfMaxSize) // SDF bake serves a range of sizes
+        return baked;
 
     ImFontAtlas* atlas = ContainerAtlas;
     ImFontAtlasBuilder* builder = atlas->Builder;
@@ -5304,12 +7294,40 @@ ImFontBaked* ImFont::GetFontBaked(float size, float density)
     return baked;
 }
 
+// SDF bakes are independent of density, and use a distinct id from regular bakes of the same size.
+float ImFontAtlasBakedGetSdfSize(ImFontAtlas* atlas, ImFont* font, float font_size)
+{
+    if (!atlas->RendererHasTextures || !atlas->RendererHasSdfTextures || font->Sources.Size == 0)
+        return 0.0f;
+    const ImFontConfig* src = font->Sources[0];
+    if (src->SdfBakeSize <= 0.0f || font_size < src->SdfMinSize || font_size > src->SdfMaxSize)
+        return 0.0f;
+    return src->SdfBakeSize;
+}
+
+// Glyphs rasterized during the current frame are accounted by ImFontAtlasBuildLoaderLoadGlyph().
+static bool ImFontAtlasBuildIsBakeBudgetExhausted(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (atlas->BakeBudgetGlyphs > 0 && builder->FrameBakeGlyphs >= atlas->BakeBudgetGlyphs)
+        return true;
+    if (atlas->BakeBudgetMicroseconds > 0 && builder->FrameBakeMicroseconds >= atlas->BakeBudgetMicroseconds)
+        return true;
+    return false;
+}
+
 ImFontBaked* ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density)
 {
     // FIXME-NEWATLAS: Design for picking a nearest size based on some criteria?
     // FIXME-NEWATLAS: Altering font density won't work right away.
     IM_ASSERT(font_size > 0.0f && font_rasterizer_density > 0.0f);
-    ImGuiID baked_id = ImFontAtlasBakedGetId(font->FontId, font_size, font_rasterizer_density);
+    const float sdf_size = ImFontAtlasBakedGetSdfSize(atlas, font, font_size);
+    if (sdf_size > 0.0f)
+    {
+        font_size = sdf_size;
+        font_rasterizer_density = 1.0f;
+    }
+    ImGuiID baked_id = ImFontAtlasBakedGetId(font->FontId, font_size, (sdf_size > 0.0f) ? 0.0f : font_rasterizer_density);
     ImFontAtlasBuilder* builder = atlas->Builder;
     ImFontBaked** p_baked_in_map = (ImFontBaked**)builder->BakedMap.GetVoidPtrRef(baked_id);
     ImFontBaked* baked = *p_baked_in_map;
@@ -5321,7 +7339,7 @@ ImFontBaked* ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float fo
 
     // If atlas is locked, find closest match
     // FIXME-OPT: This is not an optimal query.
-    if ((font->Flags & ImFontFlags_LockBakedSizes) || atlas->Locked)
+    if (sdf_size == 0.0f && ((font->Flags & ImFontFlags_LockBakedSizes) || atlas->Locked))
     {
         baked = ImFontAtlasBakedGetClosestMatch(atlas, font, font_size, font_rasterizer_density);
         if (baked != NULL)
@@ -5333,9 +7351,27 @@ ImFontBaked* ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float fo
         }
     }
 
+    // If per-frame bake budget is exhausted, scale closest match for now.
+    // The exact size will be baked when requested again on a following frame.
+    if (sdf_size == 0.0f && ImFontAtlasBuildIsBakeBudgetExhausted(atlas))
+    {
+        baked = ImFontAtlasBakedGetClosestMatch(atlas, font, font_size, font_rasterizer_density);
+        if (baked != NULL)
+        {
+            if (!builder->FrameBakesDeferred.contains(baked_id))
+            {
+                builder->FrameBakesDeferred.push_back(baked_id);
+                builder->BakesDeferredTotal++;
+            }
+            return baked;
+        }
+    }
+
     // Create new
-    baked = ImFontAtlasBakedAdd(atlas, font, font_size, font_rasterizer_density, baked_id);
+    baked = ImFontAtlasBakedAdd(atlas, font, font_size, font_rasterizer_density, baked_id, sdf_size > 0.0f);
     *p_baked_in_map = baked; // To avoid 'builder->BakedMap.SetVoidPtr(baked_id, baked);' while we can.
+    if (font->Sources[0]->PrebakedData != NULL)
+        ImFontAtlasBuildSetupFontBakedPrebaked(atlas, baked);
     return baked;
 }
 
@@ -5377,6 +7413,7 @@ const char* ImFont::CalcWordWrapPosition(float size, const char* text, const cha
     const char* word_end = text;
     const char* prev_word_end = NULL;
     bool inside_word = true;
+    const float* index_page0_advance_x = ImFontBaked_GetIndexPage0AdvanceX(baked); // Fast path for U+0000..U+00FF
 
     const char* s = text;
     IM_ASSERT(text_end != NULL);
@@ -5406,9 +7443,16 @@ const char* ImFont::CalcWordWrapPosition(float size, const char* text, const cha
         }
 
         // Optimized inline version of 'float char_width = GetCharAdvance((ImWchar)c);'
-        float char_width = (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
+        float char_width;
+        if (c < IM_FONTBAKED_INDEX_PAGE_SIZE)
+            char_width = index_page0_advance_x[c];
+        else
+            char_width = (c / IM_FONTBAKED_INDEX_PAGE_SIZE < (unsigned int)baked->IndexPages.Size) ? baked->IndexPages.Data[c / IM_FONTBAKED_INDEX_PAGE_SIZE]->AdvanceX[c % IM_FONTBAKED_INDEX_PAGE_SIZE] : -1.0f;
         if (char_width < 0.0f)
+        {
             char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
+            index_page0_advance_x = ImFontBaked_GetIndexPage0AdvanceX(baked); // May have been allocated
+        }
 
         if (ImCharIsBlankW(c))
         {
@@ -5472,6 +7516,7 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
 
     const bool word_wrap_enabled = (wrap_width > 0.0f);
     const char* word_wrap_eol = NULL;
+    const float* index_page0_advance_x = ImFontBaked_GetIndexPage0AdvanceX(baked); // Fast path for U+0000..U+00FF
 
     const char* s = text_begin;
     while (s < text_end)
@@ -5516,9 +7561,16 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
         }
 
         // Optimized inline version of 'float char_width = GetCharAdvance((ImWchar)c);'
-        float char_width = (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
+        float char_width;
+        if (c < IM_FONTBAKED_INDEX_PAGE_SIZE)
+            char_width = index_page0_advance_x[c];
+        else
+            char_width = (c / IM_FONTBAKED_INDEX_PAGE_SIZE < (unsigned int)baked->IndexPages.Size) ? baked->IndexPages.Data[c / IM_FONTBAKED_INDEX_PAGE_SIZE]->AdvanceX[c % IM_FONTBAKED_INDEX_PAGE_SIZE] : -1.0f;
         if (char_width < 0.0f)
+        {
             char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
+            index_page0_advance_x = ImFontBaked_GetIndexPage0AdvanceX(baked); // May have been allocated
+        }
         char_width *= scale;
 
         if (line_width + char_width >= max_width)
@@ -5542,13 +7594,145 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
     return text_size;
 }
 
+// Sum advances of 4 strings, one per SIMD lane. Each lane adds advances of its own string in order, like CalcTextSizeA() does.
+// Return a mask of lanes which need CalcTextSizeA(): 'advance_x[]' is negative for glyphs not loaded yet and for bytes which are not single-line ASCII.
+IM_MSVC_RUNTIME_CHECKS_OFF
+static int ImFontCalcTextWidthX4(const float* advance_x, float scale, const unsigned char* const texts[4], const int texts_len[4], float out_widths[4])
+{
+    const int common_len = ImMin(ImMin(texts_len[0], texts_len[1]), ImMin(texts_len[2], texts_len[3]));
+    int fallback_mask = 0;
+#if defined(IMGUI_ENABLE_SSE2)
+    const unsigned char* t0 = texts[0];
+    const unsigned char* t1 = texts[1];
+    const unsigned char* t2 = texts[2];
+    const unsigned char* t3 = texts[3];
+    const __m128 scale4 = _mm_set1_ps(scale);
+    __m128 widths = _mm_setzero_ps();
+    __m128 advances_or = _mm_setzero_ps(); // Accumulate sign bits
+    for (int n = 0; n < common_len; n++)
+    {
+        const __m128 advances = _mm_setr_ps(advance_x[t0[n]], advance_x[t1[n]], advance_x[t2[n]], advance_x[t3[n]]);
+        advances_or = _mm_or_ps(advances_or, advances);
+        widths = _mm_add_ps(widths, _mm_mul_ps(advances, scale4));
+    }
+    _mm_storeu_ps(out_widths, widths);
+    fallback_mask = _mm_movemask_ps(advances_or);
+#else
+    out_widths[0] = out_widths[1] = out_widths[2] = out_widths[3] = 0.0f;
+    for (int n = 0; n < common_len; n++)
+        for (int lane = 0; lane < 4; lane++)
+        {
+            const float char_width = advance_x[texts[lane][n]];
+            if (char_width < 0.0f)
+                fallback_mask |= 1 << lane;
+            out_widths[lane] += char_width * scale;
+        }
+#endif
+    // Remaining characters of longer strings
+    for (int lane = 0; lane < 4; lane++)
+        for (int n = common_len; n < texts_len[lane]; n++)
+        {
+            const float char_width = advance_x[texts[lane][n]];
+            if (char_width < 0.0f)
+                fallback_mask |= 1 << lane;
+            out_widths[lane] += char_width * scale;
+        }
+    return fallback_mask;
+}
+IM_MSVC_RUNTIME_CHECKS_RESTORE
+
+// Calculate sizes of many strings at once. Output is identical to calling CalcTextSizeA(size, FLT_MAX, wrap_width, ...) on each of them.
+// - 'texts_end' may be NULL, or contain NULL entries, for zero-terminated strings.
+// - Strings are processed 4 at a time, reading advances of U+0000..U+007F from a copy of the index.
+// - Strings with other characters (multi-line, multi-byte, glyphs not loaded yet) or wrapping use CalcTextSizeA().
+void ImFont::CalcTextSizeBatch(float size, float wrap_width, const char* const* texts_begin, const char* const* texts_end, int count, ImVec2* out_sizes)
+{
+    ImFontBaked* baked = GetFontBaked(size);
+    const float scale = size / baked->Size;
+
+    // Copy of U+0000..U+007F advances, with negative values for bytes requiring CalcTextSizeA()
+    float advance_x[256];
+    for (int c = 0x80; c < 0x100; c++)
+        advance_x[c] = -1.0f;
+    bool advance_x_dirty = true;
+
+    const unsigned char* lanes_text[4];
+    int lanes_len[4];
+    int lanes_idx[4];
+    float lanes_width[4];
+    int lanes_count = 0;
+    for (int n = 0; n <= count; n++)
+    {
+        if (n < count)
+        {
+            const char* text_begin = texts_begin[n];
+            const char* text_end = (texts_end && texts_end[n]) ? texts_end[n] : text_begin + ImStrlen(text_begin);
+            if (wrap_width > 0.0f)
+            {
+                out_sizes[n] = CalcTextSizeA(size, FLT_MAX, wrap_width, text_begin, text_end);
+                continue;
+            }
+            lanes_text[lanes_count] = (const unsigned char*)text_begin;
+            lanes_len[lanes_count] = (int)(text_end - text_begin);
+            lanes_idx[lanes_count] = n;
+            if (++lanes_count < 4)
+                continue;
+        }
+        else if (lanes_count == 0)
+        {
+            break;
+        }
+
+        // Pad last batch with empty strings
+        for (int lane = lanes_count; lane < 4; lane++)
+        {
+            lanes_text[lane] = NULL;
+            lanes_len[lane] = 0;
+        }
+        if (advance_x_dirty)
+        {
+            memcpy(advance_x, ImFontBaked_GetIndexPage0AdvanceX(baked), 0x80 * sizeof(float));
+            advance_x['\n'] = advance_x['\r'] = -1.0f;
+            advance_x_dirty = false;
+        }
+        const int fallback_mask = ImFontCalcTextWidthX4(advance_x, scale, lanes_text, lanes_len, lanes_width);
+        for (int lane = 0; lane < lanes_count; lane++)
+        {
+            const int idx = lanes_idx[lane];
+            if (fallback_mask & (1 << lane))
+            {
+                // Multi-line, multi-byte, or glyphs to load
+                out_sizes[idx] = CalcTextSizeA(size, FLT_MAX, 0.0f, (const char*)lanes_text[lane], (const char*)lanes_text[lane] + lanes_len[lane]);
+                advance_x_dirty = true;
+            }
+            else
+            {
+                out_sizes[idx] = ImVec2(ImMax(lanes_width[lane], 0.0f), size);
+            }
+        }
+        lanes_count = 0;
+    }
+}
+
+// Glyphs stored in secondary pages (ImFontAtlas::TexMaxPages) are drawn with their own texture.
+// Record use so the page is not evicted during the frame.
+static ImTextureRef ImFontAtlasPageGetTexRefForDrawing(ImFontAtlas* atlas, int page_n)
+{
+    if (page_n == 0)
+        return atlas->TexRef;
+    ImFontAtlasPage* page = atlas->Builder->Pages[page_n - 1];
+    page->LastUsedFrame = atlas->Builder->FrameCount;
+    return page->Tex->GetTexRef();
+}
+
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, ImWchar c, const ImVec4* cpu_fine_clip)
 {
     ImFontBaked* baked = GetFontBaked(size);
-    const ImFontGlyph* glyph = baked->FindGlyph(c);
+    ImFontGlyph* glyph = baked->FindGlyph(c);
     if (!glyph || !glyph->Visible)
         return;
+    glyph->LastUsedFrame = ContainerAtlas->Builder->FrameCount;
     if (glyph->Colored)
         col |= ~IM_COL32_A_MASK;
     float scale = (size >= 0.0f) ? (size / baked->Size) : 1.0f;
@@ -5577,15 +7761,31 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         if (y1 >= y2)
             return;
     }
+    const int page_n = glyph->PageIndex;
+    if (page_n != 0)
+        draw_list->PushTexture(ImFontAtlasPageGetTexRefForDrawing(ContainerAtlas, page_n));
     draw_list->PrimReserve(6, 4);
     draw_list->PrimRectUV(ImVec2(x1, y1), ImVec2(x2, y2), ImVec2(u1, v1), ImVec2(u2, v2), col);
+    if (page_n != 0)
+        draw_list->PopTexture();
+}
+
+// Give back unused vertices (clipped ones, blanks) ~ this is essentially a PrimUnreserve() action.
+static inline void ImFont_RenderTextGiveBackVertices(ImDrawList* draw_list, ImDrawVert* vtx_write, ImDrawIdx* idx_write, unsigned int vtx_index, int idx_expected_size)
+{
+    draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data); // Same as calling shrink()
+    draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
+    draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = vtx_index;
 }
 
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip)
 {
+    IM_PROFILE_SCOPE("RenderText");
     // Align to be pixel perfect
-begin:
     float x = IM_TRUNC(pos.x);
     float y = IM_TRUNC(pos.y);
     if (y > clip_rect.w)
@@ -5640,18 +7840,27 @@ begin:
         return;
 
     // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
-    const int vtx_count_max = (int)(text_end - s) * 4;
-    const int idx_count_max = (int)(text_end - s) * 6;
-    const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
+    int vtx_count_max = (int)(text_end - s) * 4;
+    int idx_count_max = (int)(text_end - s) * 6;
+    int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
     draw_list->PrimReserve(idx_count_max, vtx_count_max);
     ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
     ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
     unsigned int vtx_index = draw_list->_VtxCurrentIdx;
-    const int cmd_count = draw_list->CmdBuffer.Size;
+    int cmd_count = draw_list->CmdBuffer.Size;
+    unsigned int page_n = 0; // Current atlas page (see ImFontAtlas::TexMaxPages)
+    const int frame_count = ContainerAtlas->Builder->FrameCount;
 
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
     const char* word_wrap_eol = NULL;
 
+    // Start of current segment (glyphs from the same atlas page, sharing one reservation), so it can be redone alone.
+    const char* segment_s = s;
+    const char* segment_word_wrap_eol = NULL;
+    float segment_x = x;
+    float segment_y = y;
+
+retry_segment:
     while (s < text_end)
     {
         if (word_wrap_enabled)
@@ -5673,6 +7882,7 @@ begin:
         }
 
         // Decode and advance source
+        const char* c_begin = s;
         unsigned int c = (unsigned int)*s;
         if (c < 0x80)
             s += 1;
@@ -5693,13 +7903,14 @@ begin:
                 continue;
         }
 
-        const ImFontGlyph* glyph = baked->FindGlyph((ImWchar)c);
+        ImFontGlyph* glyph = baked->FindGlyph((ImWchar)c);
         //if (glyph == NULL)
         //    continue;
 
         float char_width = glyph->AdvanceX * scale;
         if (glyph->Visible)
         {
+            glyph->LastUsedFrame = frame_count; // For ImFontAtlas::TexMemoryTarget
             // We don't do a second finer clipping test on the Y axis as we've already skipped anything before clip_rect.y and exit once we pass clip_rect.w
             float x1 = x + glyph->X0 * scale;
             float x2 = x + glyph->X1 * scale;
@@ -5743,6 +7954,28 @@ begin:
                     }
                 }
 
+                // Glyph is stored in another atlas page: submit what we have and switch texture
+                if (glyph->PageIndex != page_n)
+                {
+                    if (cmd_count != draw_list->CmdBuffer.Size)
+                        break; // Texture changed during current segment (see below)
+                    ImFont_RenderTextGiveBackVertices(draw_list, vtx_write, idx_write, vtx_index, idx_expected_size);
+                    segment_s = c_begin;
+                    segment_word_wrap_eol = word_wrap_eol;
+                    segment_x = x;
+                    segment_y = y;
+                    page_n = glyph->PageIndex;
+                    draw_list->_SetTexture(ImFontAtlasPageGetTexRefForDrawing(ContainerAtlas, page_n));
+                    vtx_count_max = (int)(text_end - s + 1) * 4;
+                    idx_count_max = (int)(text_end - s + 1) * 6;
+                    draw_list->PrimReserve(idx_count_max, vtx_count_max);
+                    idx_expected_size = draw_list->IdxBuffer.Size;
+                    vtx_write = draw_list->_VtxWritePtr;
+                    idx_write = draw_list->_IdxWritePtr;
+                    vtx_index = draw_list->_VtxCurrentIdx;
+                    cmd_count = draw_list->CmdBuffer.Size;
+                }
+
                 // Support for untinted glyphs
                 ImU32 glyph_col = glyph->Colored ? col_untinted : col;
 
@@ -5764,6 +7997,7 @@ begin:
     }
 
     // Edge case: calling RenderText() with unloaded glyphs triggering texture change. It doesn't happen via ImGui:: calls because CalcTextSize() is always used.
+    // Cancel and redo the current segment only: segments from other atlas pages are already submitted.
     if (cmd_count != draw_list->CmdBuffer.Size) //-V547
     {
         IM_ASSERT(draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount == 0);
@@ -5772,18 +8006,27 @@ begin:
         draw_list->AddDrawCmd();
         //IMGUI_DEBUG_LOG("RenderText: cancel and retry to missing glyphs.\n"); // [DEBUG]
         //draw_list->AddRectFilled(pos, pos + ImVec2(10, 10), IM_COL32(255, 0, 0, 255)); // [DEBUG]
-        goto begin;
-        //RenderText(draw_list, size, pos, col, clip_rect, text_begin, text_end, wrap_width, cpu_fine_clip); // FIXME-OPT: Would a 'goto begin' be better for code-gen?
-        //return;
+        s = segment_s;
+        word_wrap_eol = segment_word_wrap_eol;
+        x = segment_x;
+        y = segment_y;
+        vtx_count_max = (int)(text_end - s) * 4;
+        idx_count_max = (int)(text_end - s) * 6;
+        draw_list->PrimReserve(idx_count_max, vtx_count_max);
+        idx_expected_size = draw_list->IdxBuffer.Size;
+        vtx_write = draw_list->_VtxWritePtr;
+        idx_write = draw_list->_IdxWritePtr;
+        vtx_index = draw_list->_VtxCurrentIdx;
+        cmd_count = draw_list->CmdBuffer.Size;
+        goto retry_segment;
     }
 
-    // Give back unused vertices (clipped ones, blanks) ~ this is essentially a PrimUnreserve() action.
-    draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data); // Same as calling shrink()
-    draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
-    draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
-    draw_list->_VtxWritePtr = vtx_write;
-    draw_list->_IdxWritePtr = idx_write;
-    draw_list->_VtxCurrentIdx = vtx_index;
+    // Give back unused vertices (clipped ones, blanks)
+    ImFont_RenderTextGiveBackVertices(draw_list, vtx_write, idx_write, vtx_index, idx_expected_size);
+
+    // Restore atlas texture
+    if (page_n != 0)
+        draw_list->_SetTexture(ContainerAtlas->TexRef);
 }
 
 //-----------------------------------------------------------------------------
@@ -5998,6 +8241,7 @@ void ImGui::RenderColorRectWithAlphaCheckerboard(ImDrawList* draw_list, ImVec2 p
 // [SECTION] Decompression code
 //-----------------------------------------------------------------------------
 // Compressed with stb_compress() then converted to a C array and encoded as base85.
+// Fonts may also be compressed with a faster LZ4-style codec (see ImLz4Decompress() below).
 // Use the program in misc/fonts/binary_to_compressed_c.cpp to create the array from a TTF file.
 // The purpose of encoding as base85 instead of "0x00,0x01,..." style is only save on _source code_ size.
 // Decompression from stb.h (public domain) by Sean Barrett https://github.com/nothings/stb/blob/master/stb.h
@@ -6113,6 +8357,83 @@ static unsigned int stb_decompress(unsigned char *output, const unsigned char *i
     }
 }
 
+// LZ4-style codec, selected with 'binary_to_compressed_c.exe -lz4'.
+// Trades a little compression ratio for a decoder which is several times faster than stb_decompress().
+// - Header (12 bytes): 'L' 'Z' '4' 0x01, then decompressed size and payload size as 32-bit big-endian integers.
+// - Payload: a sequence of [token][literal length ext][literals][offset][match length ext], same layout as a LZ4 block:
+//   token high nibble = literal length, low nibble = match length - 4, value 15 = continued with extra bytes until one != 255.
+//   offset = 16-bit little-endian distance. The last sequence only has literals.
+static bool ImLz4IsCompressed(const unsigned char* input, unsigned int input_size)
+{
+    return input_size >= 12 && input[0] == 'L' && input[1] == 'Z' && input[2] == '4' && input[3] == 0x01;
+}
+
+static unsigned int ImLz4DecompressLength(const unsigned char* input)
+{
+    return ((unsigned int)input[4] << 24) + (input[5] << 16) + (input[6] << 8) + input[7];
+}
+
+// Return decompressed size, or 0 on corrupted data. Never reads or writes out of bounds.
+static unsigned int ImLz4Decompress(unsigned char* output, const unsigned char* input, unsigned int input_size)
+{
+    if (!ImLz4IsCompressed(input, input_size))
+        return 0;
+    const unsigned int output_size = ImLz4DecompressLength(input);
+    const unsigned int payload_size = ((unsigned int)input[8] << 24) + (input[9] << 16) + (input[10] << 8) + input[11];
+    if (payload_size > input_size - 12)
+        return 0;
+    const unsigned char* ip = input + 12;
+    const unsigned char* ip_end = ip + payload_size;
+    unsigned char* op = output;
+    unsigned char* op_end = output + output_size;
+    while (ip < ip_end)
+    {
+        const unsigned int token = *ip++;
+
+        // Literals: most runs are short and fit in a single fixed-size copy
+        size_t lit_len = token >> 4;
+        if (lit_len == 15)
+            for (unsigned int b = 255; b == 255 && ip < ip_end; lit_len += b)
+                b = *ip++;
+        if ((size_t)(ip_end - ip) < lit_len || (size_t)(op_end - op) < lit_len)
+            return 0;
+        if (lit_len <= 16 && ip_end - ip >= 16 && op_end - op >= 16)
+            memcpy(op, ip, 16);
+        else
+            memcpy(op, ip, lit_len);
+        op += lit_len;
+        ip += lit_len;
+        if (ip == ip_end)
+            break;
+
+        // Match
+        if (ip_end - ip < 2)
+            return 0;
+        const size_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        size_t match_len = (token & 15) + 4;
+        if (match_len == 15 + 4)
+            for (unsigned int b = 255; b == 255 && ip < ip_end; match_len += b)
+                b = *ip++;
+        if (offset == 0 || offset > (size_t)(op - output) || (size_t)(op_end - op) < match_len)
+            return 0;
+        const unsigned char* match = op - offset;
+        unsigned char* op_copy_end = op + match_len;
+        if (offset >= 8 && (size_t)(op_end - op) >= match_len + 8)
+        {
+            // Copy 8 bytes at a time: source never overlaps the bytes being written, may overshoot by up to 7 bytes.
+            do { memcpy(op, match, 8); op += 8; match += 8; } while (op < op_copy_end);
+            op = op_copy_end;
+        }
+        else
+        {
+            while (op < op_copy_end)
+                *op++ = *match++;
+        }
+    }
+    return (op == op_end) ? output_size : 0;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Default font data (ProggyClean.ttf)
 //-----------------------------------------------------------------------------
@@ -6126,176 +8447,132 @@ static unsigned int stb_decompress(unsigned char *output, const unsigned char *i
 #ifndef IMGUI_DISABLE_DEFAULT_FONT
 
 // File: 'ProggyClean.ttf' (41208 bytes)
-// Exported using binary_to_compressed_c.exe -u8 "ProggyClean.ttf" proggy_clean_ttf
-static const unsigned int proggy_clean_ttf_compressed_size = 9583;
-static const unsigned char proggy_clean_ttf_compressed_data[9583] =
-{
-    87,188,0,0,0,0,0,0,0,0,160,248,0,4,0,0,55,0,1,0,0,0,12,0,128,0,3,0,64,79,83,47,50,136,235,116,144,0,0,1,72,130,21,44,78,99,109,97,112,2,18,35,117,0,0,3,160,130,19,36,82,99,118,116,
-    32,130,23,130,2,33,4,252,130,4,56,2,103,108,121,102,18,175,137,86,0,0,7,4,0,0,146,128,104,101,97,100,215,145,102,211,130,27,32,204,130,3,33,54,104,130,16,39,8,66,1,195,0,0,1,4,130,
-    15,59,36,104,109,116,120,138,0,126,128,0,0,1,152,0,0,2,6,108,111,99,97,140,115,176,216,0,0,5,130,30,41,2,4,109,97,120,112,1,174,0,218,130,31,32,40,130,16,44,32,110,97,109,101,37,89,
-    187,150,0,0,153,132,130,19,44,158,112,111,115,116,166,172,131,239,0,0,155,36,130,51,44,210,112,114,101,112,105,2,1,18,0,0,4,244,130,47,32,8,132,203,46,1,0,0,60,85,233,213,95,15,60,
-    245,0,3,8,0,131,0,34,183,103,119,130,63,43,0,0,189,146,166,215,0,0,254,128,3,128,131,111,130,241,33,2,0,133,0,32,1,130,65,38,192,254,64,0,0,3,128,131,16,130,5,32,1,131,7,138,3,33,2,
-    0,130,17,36,1,1,0,144,0,130,121,130,23,38,2,0,8,0,64,0,10,130,9,32,118,130,9,130,6,32,0,130,59,33,1,144,131,200,35,2,188,2,138,130,16,32,143,133,7,37,1,197,0,50,2,0,131,0,33,4,9,131,
-    5,145,3,43,65,108,116,115,0,64,0,0,32,172,8,0,131,0,35,5,0,1,128,131,77,131,3,33,3,128,191,1,33,1,128,130,184,35,0,0,128,0,130,3,131,11,32,1,130,7,33,0,128,131,1,32,1,136,9,32,0,132,
-    15,135,5,32,1,131,13,135,27,144,35,32,1,149,25,131,21,32,0,130,0,32,128,132,103,130,35,132,39,32,0,136,45,136,97,133,17,130,5,33,0,0,136,19,34,0,128,1,133,13,133,5,32,128,130,15,132,
-    131,32,3,130,5,32,3,132,27,144,71,32,0,133,27,130,29,130,31,136,29,131,63,131,3,65,63,5,132,5,132,205,130,9,33,0,0,131,9,137,119,32,3,132,19,138,243,130,55,32,1,132,35,135,19,131,201,
-    136,11,132,143,137,13,130,41,32,0,131,3,144,35,33,128,0,135,1,131,223,131,3,141,17,134,13,136,63,134,15,136,53,143,15,130,96,33,0,3,131,4,130,3,34,28,0,1,130,5,34,0,0,76,130,17,131,
-    9,36,28,0,4,0,48,130,17,46,8,0,8,0,2,0,0,0,127,0,255,32,172,255,255,130,9,34,0,0,129,132,9,130,102,33,223,213,134,53,132,22,33,1,6,132,6,64,4,215,32,129,165,216,39,177,0,1,141,184,
-    1,255,133,134,45,33,198,0,193,1,8,190,244,1,28,1,158,2,20,2,136,2,252,3,20,3,88,3,156,3,222,4,20,4,50,4,80,4,98,4,162,5,22,5,102,5,188,6,18,6,116,6,214,7,56,7,126,7,236,8,78,8,108,
-    8,150,8,208,9,16,9,74,9,136,10,22,10,128,11,4,11,86,11,200,12,46,12,130,12,234,13,94,13,164,13,234,14,80,14,150,15,40,15,176,16,18,16,116,16,224,17,82,17,182,18,4,18,110,18,196,19,
-    76,19,172,19,246,20,88,20,174,20,234,21,64,21,128,21,166,21,184,22,18,22,126,22,198,23,52,23,142,23,224,24,86,24,186,24,238,25,54,25,150,25,212,26,72,26,156,26,240,27,92,27,200,28,
-    4,28,76,28,150,28,234,29,42,29,146,29,210,30,64,30,142,30,224,31,36,31,118,31,166,31,166,32,16,130,1,52,46,32,138,32,178,32,200,33,20,33,116,33,152,33,238,34,98,34,134,35,12,130,1,
-    33,128,35,131,1,60,152,35,176,35,216,36,0,36,74,36,104,36,144,36,174,37,6,37,96,37,130,37,248,37,248,38,88,38,170,130,1,8,190,216,39,64,39,154,40,10,40,104,40,168,41,14,41,32,41,184,
-    41,248,42,54,42,96,42,96,43,2,43,42,43,94,43,172,43,230,44,32,44,52,44,154,45,40,45,92,45,120,45,170,45,232,46,38,46,166,47,38,47,182,47,244,48,94,48,200,49,62,49,180,50,30,50,158,
-    51,30,51,130,51,238,52,92,52,206,53,58,53,134,53,212,54,38,54,114,54,230,55,118,55,216,56,58,56,166,57,18,57,116,57,174,58,46,58,154,59,6,59,124,59,232,60,58,60,150,61,34,61,134,61,
-    236,62,86,62,198,63,42,63,154,64,18,64,106,64,208,65,54,65,162,66,8,66,64,66,122,66,184,66,240,67,98,67,204,68,42,68,138,68,238,69,88,69,182,69,226,70,84,70,180,71,20,71,122,71,218,
-    72,84,72,198,73,64,0,36,70,21,8,8,77,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,103,0,107,0,111,0,115,
-    0,119,0,123,0,127,0,131,0,135,0,139,0,143,0,0,17,53,51,21,49,150,3,32,5,130,23,32,33,130,3,211,7,151,115,32,128,133,0,37,252,128,128,2,128,128,190,5,133,74,32,4,133,6,206,5,42,0,7,
-    1,128,0,0,2,0,4,0,0,65,139,13,37,0,1,53,51,21,7,146,3,32,3,130,19,32,1,141,133,32,3,141,14,131,13,38,255,0,128,128,0,6,1,130,84,35,2,128,4,128,140,91,132,89,32,51,65,143,6,139,7,33,
-    1,0,130,57,32,254,130,3,32,128,132,4,32,4,131,14,138,89,35,0,0,24,0,130,0,33,3,128,144,171,66,55,33,148,115,65,187,19,32,5,130,151,143,155,163,39,32,1,136,182,32,253,134,178,132,7,
-    132,200,145,17,32,3,65,48,17,165,17,39,0,0,21,0,128,255,128,3,65,175,17,65,3,27,132,253,131,217,139,201,155,233,155,27,131,67,131,31,130,241,33,255,0,131,181,137,232,132,15,132,4,138,
-    247,34,255,0,128,179,238,32,0,130,0,32,20,65,239,48,33,0,19,67,235,10,32,51,65,203,14,65,215,11,32,7,154,27,135,39,32,33,130,35,33,128,128,130,231,32,253,132,231,32,128,132,232,34,
-    128,128,254,133,13,136,8,32,253,65,186,5,130,36,130,42,176,234,133,231,34,128,0,0,66,215,44,33,0,1,68,235,6,68,211,19,32,49,68,239,14,139,207,139,47,66,13,7,32,51,130,47,33,1,0,130,
-    207,35,128,128,1,0,131,222,131,5,130,212,130,6,131,212,32,0,130,10,133,220,130,233,130,226,32,254,133,255,178,233,39,3,1,128,3,0,2,0,4,68,15,7,68,99,12,130,89,130,104,33,128,4,133,
-    93,130,10,38,0,0,11,1,0,255,0,68,63,16,70,39,9,66,215,8,32,7,68,77,6,68,175,14,32,29,68,195,6,132,7,35,2,0,128,255,131,91,132,4,65,178,5,141,111,67,129,23,165,135,140,107,142,135,33,
-    21,5,69,71,6,131,7,33,1,0,140,104,132,142,130,4,137,247,140,30,68,255,12,39,11,0,128,0,128,3,0,3,69,171,15,67,251,7,65,15,8,66,249,11,65,229,7,67,211,7,66,13,7,35,1,128,128,254,133,
-    93,32,254,131,145,132,4,132,18,32,2,151,128,130,23,34,0,0,9,154,131,65,207,8,68,107,15,68,51,7,32,7,70,59,7,135,121,130,82,32,128,151,111,41,0,0,4,0,128,255,0,1,128,1,137,239,33,0,
-    37,70,145,10,65,77,10,65,212,14,37,0,0,0,5,0,128,66,109,5,70,123,10,33,0,19,72,33,18,133,237,70,209,11,33,0,2,130,113,137,119,136,115,33,1,0,133,43,130,5,34,0,0,10,69,135,6,70,219,
-    13,66,155,7,65,9,12,66,157,11,66,9,11,32,7,130,141,132,252,66,151,9,137,9,66,15,30,36,0,20,0,128,0,130,218,71,11,42,68,51,8,65,141,7,73,19,15,69,47,23,143,39,66,81,7,32,1,66,55,6,34,
-    1,128,128,68,25,5,69,32,6,137,6,136,25,32,254,131,42,32,3,66,88,26,148,26,32,0,130,0,32,14,164,231,70,225,12,66,233,7,67,133,19,71,203,15,130,161,32,255,130,155,32,254,139,127,134,
-    12,164,174,33,0,15,164,159,33,59,0,65,125,20,66,25,7,32,5,68,191,6,66,29,7,144,165,65,105,9,35,128,128,255,0,137,2,133,182,164,169,33,128,128,197,171,130,155,68,235,7,32,21,70,77,19,
-    66,21,10,68,97,8,66,30,5,66,4,43,34,0,17,0,71,19,41,65,253,20,71,25,23,65,91,15,65,115,7,34,2,128,128,66,9,8,130,169,33,1,0,66,212,13,132,28,72,201,43,35,0,0,0,18,66,27,38,76,231,5,
-    68,157,20,135,157,32,7,68,185,13,65,129,28,66,20,5,32,253,66,210,11,65,128,49,133,61,32,0,65,135,6,74,111,37,72,149,12,66,203,19,65,147,19,68,93,7,68,85,8,76,4,5,33,255,0,133,129,34,
-    254,0,128,68,69,8,181,197,34,0,0,12,65,135,32,65,123,20,69,183,27,133,156,66,50,5,72,87,10,67,137,32,33,0,19,160,139,78,251,13,68,55,20,67,119,19,65,91,36,69,177,15,32,254,143,16,65,
-    98,53,32,128,130,0,32,0,66,43,54,70,141,23,66,23,15,131,39,69,47,11,131,15,70,129,19,74,161,9,36,128,255,0,128,254,130,153,65,148,32,67,41,9,34,0,0,4,79,15,5,73,99,10,71,203,8,32,3,
-    72,123,6,72,43,8,32,2,133,56,131,99,130,9,34,0,0,6,72,175,5,73,159,14,144,63,135,197,132,189,133,66,33,255,0,73,6,7,70,137,12,35,0,0,0,10,130,3,73,243,25,67,113,12,65,73,7,69,161,7,
-    138,7,37,21,2,0,128,128,254,134,3,73,116,27,33,128,128,130,111,39,12,0,128,1,0,3,128,2,72,219,21,35,43,0,47,0,67,47,20,130,111,33,21,1,68,167,13,81,147,8,133,230,32,128,77,73,6,32,
-    128,131,142,134,18,130,6,32,255,75,18,12,131,243,37,128,0,128,3,128,3,74,231,21,135,123,32,29,134,107,135,7,32,21,74,117,7,135,7,134,96,135,246,74,103,23,132,242,33,0,10,67,151,28,
-    67,133,20,66,141,11,131,11,32,3,77,71,6,32,128,130,113,32,1,81,4,6,134,218,66,130,24,131,31,34,0,26,0,130,0,77,255,44,83,15,11,148,155,68,13,7,32,49,78,231,18,79,7,11,73,243,11,32,
-    33,65,187,10,130,63,65,87,8,73,239,19,35,0,128,1,0,131,226,32,252,65,100,6,32,128,139,8,33,1,0,130,21,32,253,72,155,44,73,255,20,32,128,71,67,8,81,243,39,67,15,20,74,191,23,68,121,
-    27,32,1,66,150,6,32,254,79,19,11,131,214,32,128,130,215,37,2,0,128,253,0,128,136,5,65,220,24,147,212,130,210,33,0,24,72,219,42,84,255,13,67,119,16,69,245,19,72,225,19,65,3,15,69,93,
-    19,131,55,132,178,71,115,14,81,228,6,142,245,33,253,0,132,43,172,252,65,16,11,75,219,8,65,219,31,66,223,24,75,223,10,33,29,1,80,243,10,66,175,8,131,110,134,203,133,172,130,16,70,30,
-    7,164,183,130,163,32,20,65,171,48,65,163,36,65,143,23,65,151,19,65,147,13,65,134,17,133,17,130,216,67,114,5,164,217,65,137,12,72,147,48,79,71,19,74,169,22,80,251,8,65,173,7,66,157,
-    15,74,173,15,32,254,65,170,8,71,186,45,72,131,6,77,143,40,187,195,152,179,65,123,38,68,215,57,68,179,15,65,85,7,69,187,14,32,21,66,95,15,67,19,25,32,1,83,223,6,32,2,76,240,7,77,166,
-    43,65,8,5,130,206,32,0,67,39,54,143,167,66,255,19,82,193,11,151,47,85,171,5,67,27,17,132,160,69,172,11,69,184,56,66,95,6,33,12,1,130,237,32,2,68,179,27,68,175,16,80,135,15,72,55,7,
-    71,87,12,73,3,12,132,12,66,75,32,76,215,5,169,139,147,135,148,139,81,12,12,81,185,36,75,251,7,65,23,27,76,215,9,87,165,12,65,209,15,72,157,7,65,245,31,32,128,71,128,6,32,1,82,125,5,
-    34,0,128,254,131,169,32,254,131,187,71,180,9,132,27,32,2,88,129,44,32,0,78,47,40,65,79,23,79,171,14,32,21,71,87,8,72,15,14,65,224,33,130,139,74,27,62,93,23,7,68,31,7,75,27,7,139,15,
-    74,3,7,74,23,27,65,165,11,65,177,15,67,123,5,32,1,130,221,32,252,71,96,5,74,12,12,133,244,130,25,34,1,0,128,130,2,139,8,93,26,8,65,9,32,65,57,14,140,14,32,0,73,79,67,68,119,11,135,
-    11,32,51,90,75,14,139,247,65,43,7,131,19,139,11,69,159,11,65,247,6,36,1,128,128,253,0,90,71,9,33,1,0,132,14,32,128,89,93,14,69,133,6,130,44,131,30,131,6,65,20,56,33,0,16,72,179,40,
-    75,47,12,65,215,19,74,95,19,65,43,11,131,168,67,110,5,75,23,17,69,106,6,75,65,5,71,204,43,32,0,80,75,47,71,203,15,159,181,68,91,11,67,197,7,73,101,13,68,85,6,33,128,128,130,214,130,
-    25,32,254,74,236,48,130,194,37,0,18,0,128,255,128,77,215,40,65,139,64,32,51,80,159,10,65,147,39,130,219,84,212,43,130,46,75,19,97,74,33,11,65,201,23,65,173,31,33,1,0,79,133,6,66,150,
-    5,67,75,48,85,187,6,70,207,37,32,71,87,221,13,73,163,14,80,167,15,132,15,83,193,19,82,209,8,78,99,9,72,190,11,77,110,49,89,63,5,80,91,35,99,63,32,70,235,23,81,99,10,69,148,10,65,110,
-    36,32,0,65,99,47,95,219,11,68,171,51,66,87,7,72,57,7,74,45,17,143,17,65,114,50,33,14,0,65,111,40,159,195,98,135,15,35,7,53,51,21,100,78,9,95,146,16,32,254,82,114,6,32,128,67,208,37,
-    130,166,99,79,58,32,17,96,99,14,72,31,19,72,87,31,82,155,7,67,47,14,32,21,131,75,134,231,72,51,17,72,78,8,133,8,80,133,6,33,253,128,88,37,9,66,124,36,72,65,12,134,12,71,55,43,66,139,
-    27,85,135,10,91,33,12,65,35,11,66,131,11,71,32,8,90,127,6,130,244,71,76,11,168,207,33,0,12,66,123,32,32,0,65,183,15,68,135,11,66,111,7,67,235,11,66,111,15,32,254,97,66,12,160,154,67,
-    227,52,80,33,15,87,249,15,93,45,31,75,111,12,93,45,11,77,99,9,160,184,81,31,12,32,15,98,135,30,104,175,7,77,249,36,69,73,15,78,5,12,32,254,66,151,19,34,128,128,4,87,32,12,149,35,133,
-    21,96,151,31,32,19,72,35,5,98,173,15,143,15,32,21,143,99,158,129,33,0,0,65,35,52,65,11,15,147,15,98,75,11,33,1,0,143,151,132,15,32,254,99,200,37,132,43,130,4,39,0,10,0,128,1,128,3,
-    0,104,151,14,97,187,20,69,131,15,67,195,11,87,227,7,33,128,128,132,128,33,254,0,68,131,9,65,46,26,42,0,0,0,7,0,0,255,128,3,128,0,88,223,15,33,0,21,89,61,22,66,209,12,65,2,12,37,0,2,
-    1,0,3,128,101,83,8,36,0,1,53,51,29,130,3,34,21,1,0,66,53,8,32,0,68,215,6,100,55,25,107,111,9,66,193,11,72,167,8,73,143,31,139,31,33,1,0,131,158,32,254,132,5,33,253,128,65,16,9,133,
-    17,89,130,25,141,212,33,0,0,93,39,8,90,131,25,93,39,14,66,217,6,106,179,8,159,181,71,125,15,139,47,138,141,87,11,14,76,23,14,65,231,26,140,209,66,122,8,81,179,5,101,195,26,32,47,74,
-    75,13,69,159,11,83,235,11,67,21,16,136,167,131,106,130,165,130,15,32,128,101,90,24,134,142,32,0,65,103,51,108,23,11,101,231,15,75,173,23,74,237,23,66,15,6,66,46,17,66,58,17,65,105,
-    49,66,247,55,71,179,12,70,139,15,86,229,7,84,167,15,32,1,95,72,12,89,49,6,33,128,128,65,136,38,66,30,9,32,0,100,239,7,66,247,29,70,105,20,65,141,19,69,81,15,130,144,32,128,83,41,5,
-    32,255,131,177,68,185,5,133,126,65,97,37,32,0,130,0,33,21,0,130,55,66,195,28,67,155,13,34,79,0,83,66,213,13,73,241,19,66,59,19,65,125,11,135,201,66,249,16,32,128,66,44,11,66,56,17,
-    68,143,8,68,124,38,67,183,12,96,211,9,65,143,29,112,171,5,32,0,68,131,63,34,33,53,51,71,121,11,32,254,98,251,16,32,253,74,231,10,65,175,37,133,206,37,0,0,8,1,0,0,107,123,11,113,115,
-    9,33,0,1,130,117,131,3,73,103,7,66,51,18,66,44,5,133,75,70,88,5,32,254,65,39,12,68,80,9,34,12,0,128,107,179,28,68,223,6,155,111,86,147,15,32,2,131,82,141,110,33,254,0,130,15,32,4,103,
-    184,15,141,35,87,176,5,83,11,5,71,235,23,114,107,11,65,189,16,70,33,15,86,153,31,135,126,86,145,30,65,183,41,32,0,130,0,32,10,65,183,24,34,35,0,39,67,85,9,65,179,15,143,15,33,1,0,65,
-    28,17,157,136,130,123,32,20,130,3,32,0,97,135,24,115,167,19,80,71,12,32,51,110,163,14,78,35,19,131,19,155,23,77,229,8,78,9,17,151,17,67,231,46,94,135,8,73,31,31,93,215,56,82,171,25,
-    72,77,8,162,179,169,167,99,131,11,69,85,19,66,215,15,76,129,13,68,115,22,72,79,35,67,113,5,34,0,0,19,70,31,46,65,89,52,73,223,15,85,199,33,95,33,8,132,203,73,29,32,67,48,16,177,215,
-    101,13,15,65,141,43,69,141,15,75,89,5,70,0,11,70,235,21,178,215,36,10,0,128,0,0,71,207,24,33,0,19,100,67,6,80,215,11,66,67,7,80,43,12,71,106,7,80,192,5,65,63,5,66,217,26,33,0,13,156,
-    119,68,95,5,72,233,12,134,129,85,81,11,76,165,20,65,43,8,73,136,8,75,10,31,38,128,128,0,0,0,13,1,130,4,32,3,106,235,29,114,179,12,66,131,23,32,7,77,133,6,67,89,12,131,139,116,60,9,
-    89,15,37,32,0,74,15,7,103,11,22,65,35,5,33,55,0,93,81,28,67,239,23,78,85,5,107,93,14,66,84,17,65,193,26,74,183,10,66,67,34,143,135,79,91,15,32,7,117,111,8,75,56,9,84,212,9,154,134,
-    32,0,130,0,32,18,130,3,70,171,41,83,7,16,70,131,19,84,191,15,84,175,19,84,167,30,84,158,12,154,193,68,107,15,33,0,0,65,79,42,65,71,7,73,55,7,118,191,16,83,180,9,32,255,76,166,9,154,
-    141,32,0,130,0,69,195,52,65,225,15,151,15,75,215,31,80,56,10,68,240,17,100,32,9,70,147,39,65,93,12,71,71,41,92,85,15,84,135,23,78,35,15,110,27,10,84,125,8,107,115,29,136,160,38,0,0,
-    14,0,128,255,0,82,155,24,67,239,8,119,255,11,69,131,11,77,29,6,112,31,8,134,27,105,203,8,32,2,75,51,11,75,195,12,74,13,29,136,161,37,128,0,0,0,11,1,130,163,82,115,8,125,191,17,69,35,
-    12,74,137,15,143,15,32,1,65,157,12,136,12,161,142,65,43,40,65,199,6,65,19,24,102,185,11,76,123,11,99,6,12,135,12,32,254,130,8,161,155,101,23,9,39,8,0,0,1,128,3,128,2,78,63,17,72,245,
-    12,67,41,11,90,167,9,32,128,97,49,9,32,128,109,51,14,132,97,81,191,8,130,97,125,99,12,121,35,9,127,75,15,71,79,12,81,151,23,87,97,7,70,223,15,80,245,16,105,97,15,32,254,113,17,6,32,
-    128,130,8,105,105,8,76,122,18,65,243,21,74,63,7,38,4,1,0,255,0,2,0,119,247,28,133,65,32,255,141,91,35,0,0,0,16,67,63,36,34,59,0,63,77,59,9,119,147,11,143,241,66,173,15,66,31,11,67,
-    75,8,81,74,16,32,128,131,255,87,181,42,127,43,5,34,255,128,2,120,235,11,37,19,0,23,0,0,37,109,191,14,118,219,7,127,43,14,65,79,14,35,0,0,0,3,73,91,5,130,5,38,3,0,7,0,11,0,0,70,205,
-    11,88,221,12,32,0,73,135,7,87,15,22,73,135,10,79,153,15,97,71,19,65,49,11,32,1,131,104,121,235,11,80,65,11,142,179,144,14,81,123,46,32,1,88,217,5,112,5,8,65,201,15,83,29,15,122,147,
-    11,135,179,142,175,143,185,67,247,39,66,199,7,35,5,0,128,3,69,203,15,123,163,12,67,127,7,130,119,71,153,10,141,102,70,175,8,32,128,121,235,30,136,89,100,191,11,116,195,11,111,235,15,
-    72,39,7,32,2,97,43,5,132,5,94,67,8,131,8,125,253,10,32,3,65,158,16,146,16,130,170,40,0,21,0,128,0,0,3,128,5,88,219,15,24,64,159,32,135,141,65,167,15,68,163,10,97,73,49,32,255,82,58,
-    7,93,80,8,97,81,16,24,67,87,52,34,0,0,5,130,231,33,128,2,80,51,13,65,129,8,113,61,6,132,175,65,219,5,130,136,77,152,17,32,0,95,131,61,70,215,6,33,21,51,90,53,10,78,97,23,105,77,31,
-    65,117,7,139,75,24,68,195,9,24,64,22,9,33,0,128,130,11,33,128,128,66,25,5,121,38,5,134,5,134,45,66,40,36,66,59,18,34,128,0,0,66,59,81,135,245,123,103,19,120,159,19,77,175,12,33,255,
-    0,87,29,10,94,70,21,66,59,54,39,3,1,128,3,0,2,128,4,24,65,7,15,66,47,7,72,98,12,37,0,0,0,3,1,0,24,65,55,21,131,195,32,1,67,178,6,33,4,0,77,141,8,32,6,131,47,74,67,16,24,69,3,20,24,
-    65,251,7,133,234,130,229,94,108,17,35,0,0,6,0,141,175,86,59,5,162,79,85,166,8,70,112,13,32,13,24,64,67,26,24,71,255,7,123,211,12,80,121,11,69,215,15,66,217,11,69,71,10,131,113,132,
-    126,119,90,9,66,117,19,132,19,32,0,130,0,24,64,47,59,33,7,0,73,227,5,68,243,15,85,13,12,76,37,22,74,254,15,130,138,33,0,4,65,111,6,137,79,65,107,16,32,1,77,200,6,34,128,128,3,75,154,
-    12,37,0,16,0,0,2,0,104,115,36,140,157,68,67,19,68,51,15,106,243,15,134,120,70,37,10,68,27,10,140,152,65,121,24,32,128,94,155,7,67,11,8,24,74,11,25,65,3,12,83,89,18,82,21,37,67,200,
-    5,130,144,24,64,172,12,33,4,0,134,162,74,80,14,145,184,32,0,130,0,69,251,20,32,19,81,243,5,82,143,8,33,5,53,89,203,5,133,112,79,109,15,33,0,21,130,71,80,175,41,36,75,0,79,0,83,121,
-    117,9,87,89,27,66,103,11,70,13,15,75,191,11,135,67,87,97,20,109,203,5,69,246,8,108,171,5,78,195,38,65,51,13,107,203,11,77,3,17,24,75,239,17,65,229,28,79,129,39,130,175,32,128,123,253,
-    7,132,142,24,65,51,15,65,239,41,36,128,128,0,0,13,65,171,5,66,163,28,136,183,118,137,11,80,255,15,67,65,7,74,111,8,32,0,130,157,32,253,24,76,35,10,103,212,5,81,175,9,69,141,7,66,150,
-    29,131,158,24,75,199,28,124,185,7,76,205,15,68,124,14,32,3,123,139,16,130,16,33,128,128,108,199,6,33,0,3,65,191,35,107,11,6,73,197,11,24,70,121,15,83,247,15,24,70,173,23,69,205,14,
-    32,253,131,140,32,254,136,4,94,198,9,32,3,78,4,13,66,127,13,143,13,32,0,130,0,33,16,0,24,69,59,39,109,147,12,76,253,19,24,69,207,15,69,229,15,130,195,71,90,10,139,10,130,152,73,43,
-    40,91,139,10,65,131,37,35,75,0,79,0,84,227,12,143,151,68,25,15,80,9,23,95,169,11,34,128,2,128,112,186,5,130,6,83,161,19,76,50,6,130,37,65,145,44,110,83,5,32,16,67,99,6,71,67,15,76,
-    55,17,140,215,67,97,23,76,69,15,77,237,11,104,211,23,77,238,11,65,154,43,33,0,10,83,15,28,83,13,20,67,145,19,67,141,14,97,149,21,68,9,15,86,251,5,66,207,5,66,27,37,82,1,23,127,71,12,
-    94,235,10,110,175,24,98,243,15,132,154,132,4,24,66,69,10,32,4,67,156,43,130,198,35,2,1,0,4,75,27,9,69,85,9,95,240,7,32,128,130,35,32,28,66,43,40,24,82,63,23,83,123,12,72,231,15,127,
-    59,23,116,23,19,117,71,7,24,77,99,15,67,111,15,71,101,8,36,2,128,128,252,128,127,60,11,32,1,132,16,130,18,141,24,67,107,9,32,3,68,194,15,175,15,38,0,11,0,128,1,128,2,80,63,25,32,0,
-    24,65,73,11,69,185,15,83,243,16,32,0,24,81,165,8,130,86,77,35,6,155,163,88,203,5,24,66,195,30,70,19,19,24,80,133,15,32,1,75,211,8,32,254,108,133,8,79,87,20,65,32,9,41,0,0,7,0,128,0,
-    0,2,128,2,68,87,15,66,1,16,92,201,16,24,76,24,17,133,17,34,128,0,30,66,127,64,34,115,0,119,73,205,9,66,43,11,109,143,15,24,79,203,11,90,143,15,131,15,155,31,65,185,15,86,87,11,35,128,
-    128,253,0,69,7,6,130,213,33,1,0,119,178,15,142,17,66,141,74,83,28,6,36,7,0,0,4,128,82,39,18,76,149,12,67,69,21,32,128,79,118,15,32,0,130,0,32,8,131,206,32,2,79,83,9,100,223,14,102,
-    113,23,115,115,7,24,65,231,12,130,162,32,4,68,182,19,130,102,93,143,8,69,107,29,24,77,255,12,143,197,72,51,7,76,195,15,132,139,85,49,15,130,152,131,18,71,81,23,70,14,11,36,0,10,0,128,
-    2,69,59,9,89,151,15,66,241,11,76,165,12,71,43,15,75,49,13,65,12,23,132,37,32,0,179,115,130,231,95,181,16,132,77,32,254,67,224,8,65,126,20,79,171,8,32,2,89,81,5,75,143,6,80,41,8,34,
-    2,0,128,24,81,72,9,32,0,130,0,35,17,0,0,255,77,99,39,95,65,36,67,109,15,24,69,93,11,77,239,5,95,77,23,35,128,1,0,128,24,86,7,8,132,167,32,2,69,198,41,130,202,33,0,26,120,75,44,24,89,
-    51,15,71,243,12,70,239,11,24,84,3,11,66,7,11,71,255,10,32,21,69,155,35,88,151,12,32,128,74,38,10,65,210,8,74,251,5,65,226,5,75,201,13,32,3,65,9,41,146,41,40,0,0,0,9,1,0,1,0,2,91,99,
-    19,32,35,106,119,13,70,219,15,83,239,12,137,154,32,2,67,252,19,36,128,0,0,4,1,130,196,32,2,130,8,91,107,8,32,0,135,81,24,73,211,8,132,161,73,164,13,36,0,8,0,128,2,105,123,26,139,67,
-    76,99,15,34,1,0,128,135,76,83,156,20,92,104,8,67,251,30,24,86,47,27,123,207,12,24,86,7,15,71,227,8,32,4,65,20,20,131,127,32,0,130,123,32,0,71,223,26,32,19,90,195,22,71,223,15,84,200,
-    6,32,128,133,241,24,84,149,9,67,41,25,36,0,0,0,22,0,88,111,49,32,87,66,21,5,77,3,27,123,75,7,71,143,19,135,183,71,183,19,130,171,74,252,5,131,5,89,87,17,32,1,132,18,130,232,68,11,10,
-    33,1,128,70,208,16,66,230,18,147,18,130,254,223,255,75,27,23,65,59,15,135,39,155,255,34,128,128,254,104,92,8,33,0,128,65,32,11,65,1,58,33,26,0,130,0,72,71,18,78,55,17,76,11,19,86,101,
-    12,75,223,11,89,15,11,24,76,87,15,75,235,15,131,15,72,95,7,85,71,11,72,115,11,73,64,6,34,1,128,128,66,215,9,34,128,254,128,134,14,33,128,255,67,102,5,32,0,130,16,70,38,11,66,26,57,
-    88,11,8,24,76,215,34,78,139,7,95,245,7,32,7,24,73,75,23,32,128,131,167,130,170,101,158,9,82,49,22,118,139,6,32,18,67,155,44,116,187,9,108,55,14,80,155,23,66,131,15,93,77,10,131,168,
-    32,128,73,211,12,24,75,187,22,32,4,96,71,20,67,108,19,132,19,120,207,8,32,5,76,79,15,66,111,21,66,95,8,32,3,190,211,111,3,8,211,212,32,20,65,167,44,34,75,0,79,97,59,13,32,33,112,63,
-    10,65,147,19,69,39,19,143,39,24,66,71,9,130,224,65,185,43,94,176,12,65,183,24,71,38,8,24,72,167,7,65,191,38,136,235,24,96,167,12,65,203,62,115,131,13,65,208,42,175,235,67,127,6,32,
-    4,76,171,29,114,187,5,32,71,65,211,5,65,203,68,72,51,8,164,219,32,0,172,214,71,239,58,78,3,27,66,143,15,77,19,15,147,31,35,33,53,51,21,66,183,10,173,245,66,170,30,150,30,34,0,0,23,
-    80,123,54,76,1,16,73,125,15,82,245,11,167,253,24,76,85,12,70,184,5,32,254,131,185,37,254,0,128,1,0,128,133,16,117,158,18,92,27,38,65,3,17,130,251,35,17,0,128,254,24,69,83,39,140,243,
-    121,73,19,109,167,7,81,41,15,24,95,175,12,102,227,15,121,96,11,24,95,189,7,32,3,145,171,154,17,24,77,47,9,33,0,5,70,71,37,68,135,7,32,29,117,171,11,69,87,15,24,79,97,19,24,79,149,23,
-    131,59,32,1,75,235,5,72,115,11,72,143,7,132,188,71,27,46,131,51,32,0,69,95,6,175,215,32,21,131,167,81,15,19,151,191,151,23,131,215,71,43,5,32,254,24,79,164,24,74,109,8,77,166,13,65,
-    176,26,88,162,5,98,159,6,171,219,120,247,6,79,29,8,99,169,10,103,59,19,65,209,35,131,35,91,25,19,112,94,15,83,36,8,173,229,33,20,0,88,75,43,71,31,12,65,191,71,33,1,0,130,203,32,254,
-    131,4,68,66,7,67,130,6,104,61,13,173,215,38,13,1,0,0,0,2,128,67,111,28,74,129,16,104,35,19,79,161,16,87,14,7,138,143,132,10,67,62,36,114,115,5,162,151,67,33,16,108,181,15,143,151,67,
-    5,5,24,100,242,15,170,153,34,0,0,14,65,51,34,32,55,79,75,9,32,51,74,7,10,65,57,38,132,142,32,254,72,0,14,139,163,32,128,80,254,8,67,158,21,65,63,7,32,4,72,227,27,95,155,12,67,119,19,
-    124,91,24,149,154,72,177,34,97,223,8,155,151,24,108,227,15,88,147,16,72,117,19,68,35,11,92,253,15,70,199,15,24,87,209,17,32,2,87,233,7,32,1,24,88,195,10,119,24,8,32,3,81,227,24,65,
-    125,21,35,128,128,0,25,76,59,48,24,90,187,9,97,235,12,66,61,11,91,105,19,24,79,141,11,24,79,117,15,24,79,129,27,90,53,13,130,13,32,253,131,228,24,79,133,40,69,70,8,66,137,31,65,33,
-    19,96,107,8,68,119,29,66,7,5,68,125,16,65,253,19,65,241,27,24,90,179,13,24,79,143,18,33,128,128,130,246,32,254,130,168,68,154,36,77,51,9,97,47,5,167,195,32,21,131,183,78,239,27,155,
-    195,78,231,14,201,196,77,11,6,32,5,73,111,37,97,247,12,77,19,31,155,207,78,215,19,162,212,69,17,14,66,91,19,80,143,57,78,203,39,159,215,32,128,93,134,8,24,80,109,24,66,113,15,169,215,
-    66,115,6,32,4,69,63,33,32,0,101,113,7,86,227,35,143,211,36,49,53,51,21,1,77,185,14,65,159,28,69,251,34,67,56,8,33,9,0,24,107,175,25,90,111,12,110,251,11,119,189,24,119,187,34,87,15,
-    9,32,4,66,231,37,90,39,7,66,239,8,84,219,15,69,105,23,24,85,27,27,87,31,11,33,1,128,76,94,6,32,1,85,241,7,33,128,128,106,48,10,33,128,128,69,136,11,133,13,24,79,116,49,84,236,8,24,
-    91,87,9,32,5,165,255,69,115,12,66,27,15,159,15,24,72,247,12,74,178,5,24,80,64,15,33,0,128,143,17,77,89,51,130,214,24,81,43,7,170,215,74,49,8,159,199,143,31,139,215,69,143,5,32,254,
-    24,81,50,35,181,217,84,123,70,143,195,159,15,65,187,16,66,123,7,65,175,15,65,193,29,68,207,39,79,27,5,70,131,6,32,4,68,211,33,33,67,0,83,143,14,159,207,143,31,140,223,33,0,128,24,80,
-    82,14,24,93,16,23,32,253,65,195,5,68,227,40,133,214,107,31,7,32,5,67,115,27,87,9,8,107,31,43,66,125,6,32,0,103,177,23,131,127,72,203,36,32,0,110,103,8,155,163,73,135,6,32,19,24,112,
-    99,10,65,71,11,73,143,19,143,31,126,195,5,24,85,21,9,24,76,47,14,32,254,24,93,77,36,68,207,11,39,25,0,0,255,128,3,128,4,66,51,37,95,247,13,82,255,24,76,39,19,147,221,66,85,27,24,118,
-    7,8,24,74,249,12,76,74,8,91,234,8,67,80,17,131,222,33,253,0,121,30,44,73,0,16,69,15,6,32,0,65,23,38,69,231,12,65,179,6,98,131,16,86,31,27,24,108,157,14,80,160,8,24,65,46,17,33,4,0,
-    96,2,18,144,191,65,226,8,68,19,5,171,199,80,9,15,180,199,67,89,5,32,255,24,79,173,28,174,201,24,79,179,50,32,1,24,122,5,10,82,61,10,180,209,83,19,8,32,128,24,80,129,27,111,248,43,131,
-    71,24,115,103,8,67,127,41,78,213,24,100,247,19,66,115,39,75,107,5,32,254,165,219,78,170,40,24,112,163,49,32,1,97,203,6,65,173,64,32,0,83,54,7,133,217,88,37,12,32,254,131,28,33,128,
-    3,67,71,44,84,183,6,32,5,69,223,33,96,7,7,123,137,16,192,211,24,112,14,9,32,255,67,88,29,68,14,10,84,197,38,33,0,22,116,47,50,32,87,106,99,9,116,49,15,89,225,15,97,231,23,70,41,19,
-    82,85,8,93,167,6,32,253,132,236,108,190,7,89,251,5,116,49,58,33,128,128,131,234,32,15,24,74,67,38,70,227,24,24,83,45,23,89,219,12,70,187,12,89,216,19,32,2,69,185,24,141,24,70,143,66,
-    24,82,119,56,78,24,10,32,253,133,149,132,6,24,106,233,7,69,198,48,178,203,81,243,12,68,211,15,106,255,23,66,91,15,69,193,7,100,39,10,24,83,72,16,176,204,33,19,0,88,207,45,68,21,12,
-    68,17,10,65,157,53,68,17,6,32,254,92,67,10,65,161,25,69,182,43,24,118,91,47,69,183,18,181,209,111,253,12,89,159,8,66,112,12,69,184,45,35,0,0,0,9,24,80,227,26,73,185,16,118,195,15,131,
-    15,33,1,0,65,59,15,66,39,27,160,111,66,205,12,148,111,143,110,33,128,128,156,112,24,81,199,8,75,199,23,66,117,20,155,121,32,254,68,126,12,72,213,29,134,239,149,123,89,27,16,148,117,
-    65,245,8,24,71,159,14,141,134,134,28,73,51,55,109,77,15,105,131,11,68,67,11,76,169,27,107,209,12,102,174,8,32,128,72,100,18,116,163,56,79,203,11,75,183,44,85,119,19,71,119,23,151,227,
-    32,1,93,27,8,65,122,5,77,102,8,110,120,20,66,23,8,66,175,17,66,63,12,133,12,79,35,8,74,235,33,67,149,16,69,243,15,78,57,15,69,235,16,67,177,7,151,192,130,23,67,84,29,141,192,174,187,
-    77,67,15,69,11,12,159,187,77,59,10,199,189,24,70,235,50,96,83,19,66,53,23,105,65,19,77,47,12,163,199,66,67,37,78,207,50,67,23,23,174,205,67,228,6,71,107,13,67,22,14,66,85,11,83,187,
-    38,124,47,49,95,7,19,66,83,23,67,23,19,24,96,78,17,80,101,16,71,98,40,33,0,7,88,131,22,24,89,245,12,84,45,12,102,213,5,123,12,9,32,2,126,21,14,43,255,0,128,128,0,0,20,0,128,255,128,
-    3,126,19,39,32,75,106,51,7,113,129,15,24,110,135,19,126,47,15,115,117,11,69,47,11,32,2,109,76,9,102,109,9,32,128,75,2,10,130,21,32,254,69,47,6,32,3,94,217,47,32,0,65,247,10,69,15,46,
-    65,235,31,65,243,15,101,139,10,66,174,14,65,247,16,72,102,28,69,17,14,84,243,9,165,191,88,47,48,66,53,12,32,128,71,108,6,203,193,32,17,75,187,42,73,65,16,65,133,52,114,123,9,167,199,
-    69,21,37,86,127,44,75,171,11,180,197,78,213,12,148,200,81,97,46,24,95,243,9,32,4,66,75,33,113,103,9,87,243,36,143,225,24,84,27,31,90,145,8,148,216,67,49,5,24,84,34,14,75,155,27,67,
-    52,13,140,13,36,0,20,0,128,255,24,135,99,46,88,59,43,155,249,80,165,7,136,144,71,161,23,32,253,132,33,32,254,88,87,44,136,84,35,128,0,0,21,81,103,5,94,47,44,76,51,12,143,197,151,15,
-    65,215,31,24,64,77,13,65,220,20,65,214,14,71,4,40,65,213,13,32,0,130,0,35,21,1,2,0,135,0,34,36,0,72,134,10,36,1,0,26,0,130,134,11,36,2,0,14,0,108,134,11,32,3,138,23,32,4,138,11,34,
-    5,0,20,134,33,34,0,0,6,132,23,32,1,134,15,32,18,130,25,133,11,37,1,0,13,0,49,0,133,11,36,2,0,7,0,38,134,11,36,3,0,17,0,45,134,11,32,4,138,35,36,5,0,10,0,62,134,23,32,6,132,23,36,3,
-    0,1,4,9,130,87,131,167,133,11,133,167,133,11,133,167,133,11,37,3,0,34,0,122,0,133,11,133,167,133,11,133,167,133,11,133,167,34,50,0,48,130,1,34,52,0,47,134,5,8,49,49,0,53,98,121,32,
-    84,114,105,115,116,97,110,32,71,114,105,109,109,101,114,82,101,103,117,108,97,114,84,84,88,32,80,114,111,103,103,121,67,108,101,97,110,84,84,50,48,48,52,47,130,2,53,49,53,0,98,0,121,
-    0,32,0,84,0,114,0,105,0,115,0,116,0,97,0,110,130,15,32,71,132,15,36,109,0,109,0,101,130,9,32,82,130,5,36,103,0,117,0,108,130,29,32,114,130,43,34,84,0,88,130,35,32,80,130,25,34,111,
-    0,103,130,1,34,121,0,67,130,27,32,101,132,59,32,84,130,31,33,0,0,65,155,9,34,20,0,0,65,11,6,130,8,135,2,33,1,1,130,9,8,120,1,1,2,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,
-    1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,
-    22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,130,187,8,66,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,0,49,0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,
-    57,0,58,0,59,0,60,0,61,0,62,0,63,0,64,0,65,0,66,130,243,9,75,68,0,69,0,70,0,71,0,72,0,73,0,74,0,75,0,76,0,77,0,78,0,79,0,80,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,0,
-    92,0,93,0,94,0,95,0,96,0,97,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,
-    63,1,64,1,65,0,172,0,163,0,132,0,133,0,189,0,150,0,232,0,134,0,142,0,139,0,157,0,169,0,164,0,239,0,138,0,218,0,131,0,147,0,242,0,243,0,141,0,151,0,136,0,195,0,222,0,241,0,158,0,170,
-    0,245,0,244,0,246,0,162,0,173,0,201,0,199,0,174,0,98,0,99,0,144,0,100,0,203,0,101,0,200,0,202,0,207,0,204,0,205,0,206,0,233,0,102,0,211,0,208,0,209,0,175,0,103,0,240,0,145,0,214,0,
-    212,0,213,0,104,0,235,0,237,0,137,0,106,0,105,0,107,0,109,0,108,0,110,0,160,0,111,0,113,0,112,0,114,0,115,0,117,0,116,0,118,0,119,0,234,0,120,0,122,0,121,0,123,0,125,0,124,0,184,0,
-    161,0,127,0,126,0,128,0,129,0,236,0,238,0,186,14,117,110,105,99,111,100,101,35,48,120,48,48,48,49,141,14,32,50,141,14,32,51,141,14,32,52,141,14,32,53,141,14,32,54,141,14,32,55,141,
-    14,32,56,141,14,32,57,141,14,32,97,141,14,32,98,141,14,32,99,141,14,32,100,141,14,32,101,141,14,32,102,140,14,33,49,48,141,14,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,
-    141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,32,49,141,239,45,49,102,6,100,101,108,101,116,101,4,69,117,114,
-    111,140,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,32,56,141,236,
-    32,56,141,236,32,56,141,236,32,56,65,220,13,32,57,65,220,13,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,
-    239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,32,57,141,239,35,57,102,0,0,5,250,72,249,98,247,
+// Exported using binary_to_compressed_c.exe -u8 -lz4 "ProggyClean.ttf" proggy_clean_ttf
+static const unsigned int proggy_clean_ttf_compressed_size = 7647;
+static const unsigned char proggy_clean_ttf_compressed_data[7647] =
+{
+    76,90,52,1,0,0,160,248,0,0,29,211,241,34,0,1,0,0,0,12,0,128,0,3,0,64,79,83,47,50,136,235,116,144,0,0,1,72,0,0,0,78,99,109,97,112,2,18,35,117,0,0,3,160,0,0,1,82,99,118,116,32,0,1,0,
+    240,66,4,252,0,0,0,2,103,108,121,102,18,175,137,86,0,0,7,4,0,0,146,128,104,101,97,100,215,145,102,211,0,0,0,204,0,0,0,54,104,104,101,97,8,66,1,195,0,0,1,4,0,0,0,36,104,109,116,120,
+    138,0,126,128,0,0,1,152,0,0,2,6,108,111,99,97,140,115,176,216,0,0,5,79,0,241,50,4,109,97,120,112,1,174,0,218,0,0,1,40,0,0,0,32,110,97,109,101,37,89,187,150,0,0,153,132,0,0,1,158,112,
+    111,115,116,166,172,131,239,0,0,155,36,0,0,5,210,112,114,101,112,105,2,1,18,0,0,4,244,0,0,0,8,204,0,225,1,0,0,60,85,233,213,95,15,60,245,0,3,8,174,0,64,183,103,119,132,8,0,160,189,
+    146,166,215,0,0,254,128,3,128,112,0,66,0,3,0,2,206,0,0,52,0,129,4,192,254,64,0,0,3,128,25,0,17,128,74,0,8,1,0,16,2,18,0,99,1,1,0,144,0,36,16,0,162,8,0,64,0,10,0,0,0,118,0,101,0,80,
+    0,3,128,1,144,201,0,130,2,188,2,138,0,0,0,143,8,0,66,1,197,0,50,103,0,63,4,9,0,1,0,2,162,65,108,116,115,0,64,0,0,32,172,73,0,66,5,0,1,128,138,0,47,3,128,2,0,47,33,1,128,203,0,0,216,
+    0,1,12,0,16,1,12,0,1,2,0,6,10,0,10,2,0,34,1,128,46,0,24,0,8,0,29,128,54,0,10,26,0,2,98,0,4,104,0,3,4,0,63,0,0,1,64,0,4,3,148,0,12,86,0,26,0,132,0,48,3,128,0,194,0,31,0,172,0,0,3,28,
+    0,26,3,212,0,21,0,68,0,1,32,0,1,148,1,4,26,0,0,86,1,7,120,0,20,3,176,0,4,112,0,1,102,0,28,1,212,0,15,16,0,4,0,116,0,44,1,0,198,0,15,18,1,0,15,64,0,13,31,128,2,0,12,2,168,2,2,1,0,19,
+    28,150,2,49,76,0,3,10,0,81,28,0,4,0,48,248,2,17,8,202,2,113,127,0,255,32,172,255,255,36,0,17,129,10,0,88,1,0,1,223,213,204,2,63,1,6,0,1,0,201,31,129,39,0,19,131,177,0,1,141,184,1,255,
+    133,15,0,31,198,2,0,48,241,204,244,1,28,1,158,2,20,2,136,2,252,3,20,3,88,3,156,3,222,4,20,4,50,4,80,4,98,4,162,5,22,5,102,5,188,6,18,6,116,6,214,7,56,7,126,7,236,8,78,8,108,8,150,8,
+    208,9,16,9,74,9,136,10,22,10,128,11,4,11,86,11,200,12,46,12,130,12,234,13,94,13,164,13,234,14,80,14,150,15,40,15,176,16,18,16,116,16,224,17,82,17,182,18,4,18,110,18,196,19,76,19,172,
+    19,246,20,88,20,174,20,234,21,64,21,128,21,166,21,184,22,18,22,126,22,198,23,52,23,142,23,224,24,86,24,186,24,238,25,54,25,150,25,212,26,72,26,156,26,240,27,92,27,200,28,4,28,76,28,
+    150,28,234,29,42,29,146,29,210,30,64,30,142,30,224,31,36,31,118,31,166,31,166,32,16,32,16,32,46,32,138,32,178,32,200,33,20,33,116,33,152,33,238,34,98,34,134,35,12,35,12,35,128,2,0,
+    240,206,152,35,176,35,216,36,0,36,74,36,104,36,144,36,174,37,6,37,96,37,130,37,248,37,248,38,88,38,170,38,170,38,216,39,64,39,154,40,10,40,104,40,168,41,14,41,32,41,184,41,248,42,54,
+    42,96,42,96,43,2,43,42,43,94,43,172,43,230,44,32,44,52,44,154,45,40,45,92,45,120,45,170,45,232,46,38,46,166,47,38,47,182,47,244,48,94,48,200,49,62,49,180,50,30,50,158,51,30,51,130,
+    51,238,52,92,52,206,53,58,53,134,53,212,54,38,54,114,54,230,55,118,55,216,56,58,56,166,57,18,57,116,57,174,58,46,58,154,59,6,59,124,59,232,60,58,60,150,61,34,61,134,61,236,62,86,62,
+    198,63,42,63,154,64,18,64,106,64,208,65,54,65,162,66,8,66,64,66,122,66,184,66,240,67,98,67,204,68,42,68,138,68,238,69,88,69,182,69,226,70,84,70,180,71,20,71,122,71,218,72,84,72,198,
+    73,64,212,5,3,22,6,255,63,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,79,0,83,0,87,0,91,0,95,0,99,0,103,0,107,0,111,0,115,0,119,0,123,
+    0,127,0,131,0,135,0,139,0,143,0,0,17,53,51,21,49,4,0,4,95,5,53,51,21,33,8,0,68,15,116,0,5,18,128,1,0,79,252,128,128,2,6,0,46,2,1,0,47,4,128,1,0,65,32,0,7,140,5,60,2,0,4,140,1,111,0,
+    1,53,51,21,7,4,0,0,90,3,53,51,21,1,69,0,30,3,88,0,112,255,0,128,128,0,6,1,245,7,57,128,4,128,92,0,1,90,0,19,51,64,1,8,8,0,116,1,0,128,128,128,254,128,5,0,43,4,0,171,0,34,0,24,248,7,
+    31,4,56,2,31,15,116,0,2,15,44,2,5,15,40,0,33,21,1,183,0,19,253,175,0,31,253,18,0,8,31,3,175,1,38,143,0,21,0,128,255,128,3,0,4,1,26,1,254,0,31,5,234,0,24,15,6,1,13,18,5,242,0,42,255,
+    0,215,0,1,16,0,42,255,0,248,0,47,255,0,239,0,34,0,235,1,31,20,240,1,30,39,0,19,156,3,27,51,198,0,8,12,0,31,7,28,0,8,23,51,228,3,135,128,128,1,128,128,253,0,128,200,1,20,254,152,2,25,
+    254,23,0,16,253,215,8,15,235,0,31,2,232,0,31,128,232,0,29,31,1,220,4,8,27,49,20,0,31,51,188,4,12,4,124,3,80,254,128,128,1,0,214,0,0,6,0,17,128,13,0,17,253,13,0,4,221,0,17,253,14,1,
+    3,247,0,15,234,0,32,48,3,1,128,5,12,5,16,4,9,100,4,3,84,4,6,246,3,110,0,0,11,1,0,255,64,4,6,24,1,5,216,2,23,7,8,0,7,4,0,39,29,1,8,0,39,2,0,160,2,6,1,0,12,102,4,15,184,0,1,15,136,0,
+    17,9,108,0,12,52,5,8,164,0,45,1,0,41,5,0,5,0,15,136,0,18,1,74,11,0,161,10,15,16,1,12,31,51,212,3,8,22,51,192,3,23,254,200,2,3,214,1,17,254,117,6,15,132,0,8,31,9,132,0,8,5,208,1,31,
+    5,50,5,4,25,7,42,5,3,7,0,31,2,108,0,6,16,4,179,1,1,82,13,4,108,0,43,0,37,86,1,3,78,1,11,213,1,1,215,13,18,128,110,2,7,168,0,1,30,4,15,170,7,3,8,210,6,33,0,2,217,14,4,120,0,5,116,0,
+    7,186,1,51,0,0,10,136,5,15,20,2,3,9,10,1,15,8,0,9,26,2,56,5,6,5,0,15,16,2,12,3,52,4,31,0,52,4,33,15,56,4,5,15,8,5,9,15,56,4,1,19,1,56,2,5,26,4,41,253,128,17,5,27,128,52,4,15,28,5,34,
+    31,14,232,0,18,9,226,6,8,228,5,12,134,3,12,254,1,3,198,6,24,254,119,0,47,254,128,225,4,23,47,0,15,136,1,20,15,126,1,2,4,150,0,8,4,0,31,7,166,0,1,6,106,1,1,176,0,5,3,0,31,128,139,5,
+    25,15,172,0,51,23,49,228,4,15,22,2,12,5,75,1,15,5,2,31,47,0,17,20,7,24,15,254,1,2,15,174,11,21,7,138,3,5,10,2,2,4,7,9,213,2,2,110,1,31,3,189,2,26,31,18,164,3,26,15,158,4,2,8,214,6,
+    7,24,0,15,130,1,10,9,134,3,15,129,1,37,4,197,0,31,17,196,0,24,9,150,8,15,204,2,1,15,74,13,17,18,1,55,2,4,221,2,11,96,4,15,198,0,32,2,112,21,15,196,0,11,15,124,1,2,15,184,5,9,12,191,
+    7,15,32,2,21,47,0,19,184,5,28,15,182,5,14,15,92,1,26,12,178,5,47,254,0,99,1,50,3,240,2,15,44,2,34,31,49,98,15,24,8,48,5,15,130,6,5,6,162,10,0,147,1,31,254,44,2,29,18,4,16,15,7,224,
+    8,5,204,7,26,3,170,10,5,186,8,20,254,60,0,18,6,176,8,11,28,9,13,64,0,15,10,10,0,43,255,0,77,0,5,84,1,0,244,22,15,244,9,7,9,114,3,27,49,162,5,7,8,0,0,254,10,1,23,1,4,27,1,31,2,200,1,
+    9,16,12,255,4,79,3,128,2,128,48,3,27,1,146,1,15,16,17,11,20,253,127,0,29,0,4,11,10,92,9,1,110,22,15,244,0,4,31,19,228,0,4,11,4,1,23,21,167,13,0,4,0,15,243,0,10,1,116,0,15,188,2,7,15,
+    190,7,14,5,26,17,14,170,7,15,162,7,10,1,40,17,31,26,216,16,38,0,16,19,15,74,3,10,31,49,212,9,0,15,16,0,5,26,33,72,0,47,29,1,134,8,7,4,24,14,6,159,18,8,9,0,2,51,14,47,128,128,235,16,
+    42,9,68,7,15,28,1,21,15,16,3,2,15,82,4,9,15,122,4,5,37,1,128,15,8,6,20,15,4,239,16,17,2,25,15,5,6,0,31,3,212,10,29,31,24,240,15,30,5,200,18,31,19,192,0,16,31,49,118,7,32,9,168,3,15,
+    212,11,3,11,246,0,47,253,0,224,1,43,5,220,11,31,128,220,11,17,15,204,0,1,12,234,15,15,74,8,1,6,176,2,21,128,233,13,15,222,6,23,15,156,17,35,31,19,128,22,48,15,148,1,7,14,135,1,2,6,
+    0,5,172,1,15,103,13,31,15,148,8,30,15,170,10,24,13,152,17,15,26,6,3,6,174,10,24,254,13,6,15,132,8,31,15,228,12,22,15,196,0,41,15,180,0,6,31,3,216,4,77,15,4,3,5,31,33,20,4,20,14,20,
+    3,4,224,19,47,2,0,38,12,40,15,40,3,38,31,33,170,13,28,15,56,3,9,15,163,4,5,15,48,3,3,47,2,0,145,16,34,16,12,28,18,31,2,232,0,9,13,172,1,31,7,140,16,12,29,1,151,20,15,76,12,20,1,216,
+    12,15,140,0,23,31,7,140,0,21,9,13,17,15,139,0,19,15,176,15,27,15,250,1,9,31,51,216,12,20,25,128,248,4,4,159,7,4,63,26,3,181,7,4,50,5,15,184,15,27,15,48,14,20,31,7,4,0,8,15,0,11,4,9,
+    1,0,31,3,88,3,17,15,28,10,44,23,17,16,24,27,49,32,24,31,49,24,10,24,31,33,12,0,4,9,40,25,1,5,10,31,1,22,10,8,41,1,0,9,0,5,229,28,15,37,10,44,15,80,9,48,15,60,25,1,31,51,12,0,4,12,84,
+    25,12,64,11,8,12,0,21,128,65,26,4,114,5,40,1,0,8,0,5,94,25,6,102,25,4,7,0,15,90,9,39,31,16,16,1,22,15,72,26,10,15,164,8,17,21,1,111,3,15,155,8,6,20,128,80,26,31,3,80,6,25,15,76,16,
+    26,31,19,242,10,36,28,5,212,7,14,76,16,24,253,225,7,15,71,4,27,0,228,7,47,255,128,188,12,35,15,140,1,33,23,51,160,16,15,148,1,21,15,101,9,31,15,20,11,79,31,49,254,5,18,15,174,1,11,
+    15,0,6,39,3,230,0,15,160,9,40,11,184,0,12,168,16,47,29,1,240,0,8,26,1,100,14,8,191,8,15,172,1,31,2,64,25,15,64,6,17,15,64,35,14,15,232,6,5,15,181,11,1,15,93,13,22,15,100,1,28,31,19,
+    168,35,52,15,68,13,7,14,39,3,15,115,1,30,15,112,1,24,15,180,0,13,12,130,33,1,112,1,5,52,7,13,147,31,47,254,128,166,24,26,31,0,80,35,42,31,17,20,8,8,31,33,88,8,20,4,180,4,15,232,3,1,
+    3,232,0,14,52,8,11,88,8,6,155,33,5,13,1,15,56,7,82,15,188,12,13,31,5,190,10,20,9,141,5,6,113,18,8,185,5,15,55,7,23,31,12,208,1,14,15,120,2,10,31,51,234,14,1,11,112,2,25,254,172,12,
+    31,3,228,3,66,31,49,140,25,8,15,46,29,17,9,112,11,8,46,29,6,100,13,15,212,3,27,31,15,0,34,12,15,56,29,6,31,7,4,0,16,10,94,21,15,130,0,3,15,29,34,15,5,172,0,15,152,32,12,31,19,26,35,
+    0,15,8,0,0,31,21,130,0,28,31,0,36,1,35,15,32,1,17,15,158,14,10,3,126,6,15,36,1,31,31,1,188,33,20,31,51,82,30,8,41,1,128,239,38,8,142,8,15,141,0,8,32,0,0,84,34,18,255,18,47,11,116,41,
+    31,21,82,42,15,12,78,0,17,2,170,25,4,204,0,5,138,36,0,42,1,3,133,0,19,0,216,4,15,56,36,7,15,16,12,0,8,168,8,15,112,22,25,2,162,1,5,42,23,11,147,27,31,2,184,8,23,4,148,20,31,128,148,
+    20,25,31,7,192,19,8,15,114,21,30,31,128,100,10,7,5,106,10,15,117,2,23,4,218,0,31,12,140,1,14,15,236,19,18,15,214,29,7,23,128,229,22,31,2,104,1,64,31,1,82,35,8,15,104,1,29,24,2,62,10,
+    15,100,1,2,5,59,2,15,106,1,31,15,248,2,37,15,76,25,14,15,132,1,19,31,253,137,1,24,7,181,0,31,14,144,1,18,15,106,6,2,31,5,184,11,16,21,1,112,1,2,13,7,31,254,101,6,29,0,88,1,16,21,175,
+    8,15,88,1,18,11,132,44,15,44,2,41,15,16,6,7,15,57,2,11,5,241,0,31,2,19,10,33,5,136,16,31,128,136,16,21,15,132,4,41,31,33,124,4,22,31,1,18,3,27,49,0,0,8,184,22,15,200,0,1,1,154,1,31,
+    1,146,7,8,28,1,162,31,47,4,0,170,8,4,2,60,21,15,8,8,12,15,112,0,14,12,230,1,44,2,0,224,41,2,209,1,15,135,0,6,8,145,0,31,16,192,1,22,13,190,1,15,154,22,29,4,117,0,15,146,22,12,15,169,
+    8,24,0,152,32,15,184,1,6,9,152,32,15,70,9,13,15,58,9,1,15,137,0,11,6,128,47,15,232,3,24,9,72,16,12,220,13,31,33,12,0,32,5,230,13,14,10,14,15,9,0,5,31,2,41,6,30,31,14,40,6,18,15,216,
+    29,38,15,204,3,16,31,2,168,0,57,31,1,102,5,36,15,78,37,4,31,253,199,6,26,3,84,8,15,32,6,26,15,90,1,34,15,200,21,31,12,206,21,15,17,6,29,15,216,0,31,15,244,6,53,31,7,236,6,24,15,216,
+    0,32,31,10,88,2,10,1,158,1,31,51,64,26,0,15,22,31,2,0,137,0,38,1,0,28,31,15,141,0,8,47,0,13,208,2,16,15,68,1,1,8,74,21,15,166,12,2,22,1,153,52,4,7,0,31,2,185,2,16,63,13,1,0,116,24,
+    14,9,0,11,15,110,9,8,9,62,37,26,1,138,8,15,133,16,23,15,156,4,26,15,12,21,35,31,1,85,2,13,15,245,3,19,15,68,2,16,15,224,20,18,15,213,20,6,31,2,116,4,11,31,18,172,6,26,15,192,20,34,
+    15,212,6,1,15,168,20,12,9,159,20,31,2,149,6,25,15,80,1,24,27,51,4,12,13,192,54,26,254,165,44,2,29,5,31,2,196,5,64,31,33,216,11,52,15,150,2,16,15,215,11,38,15,240,7,39,15,136,20,5,15,
+    170,17,5,12,120,20,31,2,240,3,20,31,255,0,14,24,31,5,56,11,3,12,134,54,10,8,44,5,64,1,15,14,10,23,9,64,1,32,11,1,228,11,31,0,152,55,11,31,7,4,0,20,31,1,103,0,3,15,16,55,17,15,44,1,
+    20,31,19,20,1,12,15,68,1,4,9,114,19,9,52,1,15,43,1,24,0,174,68,47,1,128,76,45,2,9,96,2,31,33,132,43,0,18,128,38,32,4,81,43,47,2,0,97,0,1,2,192,17,0,78,20,15,80,48,44,12,204,6,15,220,
+    17,9,15,78,38,6,23,254,88,16,5,75,38,31,0,159,3,28,33,0,4,76,22,31,0,248,55,10,5,99,3,11,61,0,31,16,20,2,18,13,252,32,15,64,17,21,8,40,0,5,76,3,13,75,17,15,39,2,27,1,186,0,104,6,1,
+    0,255,128,2,236,56,1,60,48,31,37,44,63,19,14,69,1,18,3,228,4,21,0,108,59,8,206,6,12,248,8,15,36,15,16,15,220,57,18,15,110,18,3,15,109,4,36,15,124,17,28,15,160,0,13,15,184,0,17,11,176,
+    0,12,186,0,15,114,17,27,1,132,58,28,3,192,0,9,164,59,7,74,24,7,154,7,47,4,0,176,6,2,31,128,4,57,21,27,33,4,57,23,5,240,62,15,184,36,1,26,2,225,46,6,85,3,7,152,36,15,83,30,21,0,28,20,
+    0,172,0,31,5,28,20,30,31,51,120,4,15,15,74,33,31,5,125,7,15,82,33,7,15,88,67,34,1,220,1,0,69,0,9,68,8,5,130,1,23,5,156,12,22,1,134,0,31,2,48,1,0,15,132,31,40,27,19,148,10,15,98,14,
+    9,15,120,35,21,31,51,196,68,2,8,3,49,7,178,38,8,20,0,15,77,36,35,10,13,1,15,60,2,62,15,62,30,37,4,60,2,6,180,4,15,71,30,3,15,60,2,36,2,8,65,29,128,8,65,4,48,2,11,7,65,33,0,3,72,69,
+    15,56,65,0,23,5,134,28,7,50,0,1,120,69,13,56,5,15,120,69,16,15,122,62,2,1,216,54,15,200,69,36,15,80,0,3,31,13,200,64,12,5,112,6,12,110,21,15,192,5,1,15,148,68,1,4,205,64,25,0,91,55,
+    15,172,5,13,15,48,64,38,19,7,228,9,13,208,29,31,17,208,29,15,31,1,0,9,1,3,112,1,11,132,56,14,100,1,11,237,35,2,244,26,0,190,56,15,196,34,18,15,172,21,1,31,49,52,4,8,12,60,6,14,38,6,
+    9,8,0,15,51,6,19,15,160,23,24,8,4,1,15,22,18,38,8,18,6,6,7,0,5,164,2,47,255,0,44,2,19,14,252,5,27,19,122,0,19,5,34,1,2,113,0,13,251,5,31,21,92,23,30,30,83,242,5,15,190,16,1,15,112,
+    20,9,15,234,5,1,8,197,1,7,110,12,9,247,5,21,1,59,7,31,2,215,5,32,15,200,9,31,15,230,1,5,15,130,15,21,13,192,5,12,188,5,15,240,1,23,2,176,4,2,164,7,15,32,11,14,19,51,180,0,15,98,37,
+    21,4,41,57,15,101,37,8,2,170,0,31,255,171,25,13,15,200,75,11,31,3,124,15,19,31,3,106,0,3,3,200,44,31,0,100,14,20,15,186,5,2,31,51,44,6,4,15,174,70,9,11,206,5,6,104,74,8,184,70,0,95,
+    74,31,0,144,2,28,31,16,92,46,22,15,36,14,22,15,186,67,6,30,128,36,14,15,184,67,29,9,140,27,31,128,140,27,27,15,20,58,49,8,236,20,15,112,41,0,10,40,58,1,235,4,31,3,173,33,31,31,16,8,
+    11,22,15,196,40,18,15,238,13,9,15,111,3,5,8,239,13,15,172,48,26,31,10,16,19,10,15,14,19,2,31,3,10,19,21,12,62,9,46,255,0,128,0,31,18,196,35,26,15,2,18,5,9,16,19,27,51,76,20,31,5,244,
+    34,16,6,98,22,7,169,21,31,4,254,17,28,70,2,1,0,4,108,10,6,86,5,6,76,0,0,138,85,15,20,53,41,0,64,82,15,254,57,6,15,60,63,9,15,12,52,5,31,49,32,40,0,15,230,58,4,22,0,48,24,4,198,44,25,
+    1,8,0,5,25,0,6,108,3,15,29,53,42,1,49,1,16,11,164,1,15,40,56,8,47,0,1,242,39,4,15,246,1,7,22,128,103,49,15,164,0,13,4,208,65,15,196,66,10,15,28,6,9,10,100,81,45,0,128,209,24,15,218,
+    65,9,18,7,36,57,14,156,11,31,19,108,29,8,7,66,0,15,149,3,0,47,0,30,128,2,46,0,192,84,15,132,2,14,31,51,144,54,0,12,72,7,15,32,0,9,15,140,2,20,5,102,22,5,239,15,14,18,0,15,142,2,56,
+    21,128,4,43,31,4,4,86,1,15,52,13,17,31,4,132,5,0,16,8,207,0,15,120,36,2,15,44,81,14,15,252,80,1,15,183,4,2,7,144,76,31,3,160,25,16,15,10,79,14,15,48,8,4,9,137,6,4,141,76,15,71,5,4,
+    8,15,6,0,104,3,31,2,124,37,7,8,112,2,9,166,12,15,254,42,2,8,47,11,15,196,5,7,31,0,116,0,33,15,106,4,1,7,241,0,31,0,114,0,12,0,36,6,1,82,25,8,36,6,21,5,40,38,5,246,44,0,120,12,47,0,
+    255,100,13,21,15,192,28,18,31,49,158,3,0,25,51,240,13,15,118,34,6,7,20,33,47,253,0,149,16,17,11,244,0,31,26,76,56,26,15,36,70,10,15,62,17,1,31,51,16,0,8,15,156,5,17,9,152,16,15,50,
+    85,3,31,254,5,0,5,31,3,76,4,45,16,9,220,93,31,2,176,72,3,13,238,8,15,12,0,1,11,78,25,47,2,0,105,0,3,64,4,1,128,254,102,0,7,152,17,27,5,150,14,31,1,165,9,0,1,156,4,15,124,41,8,31,5,
+    226,42,11,39,255,0,235,3,31,4,155,0,4,15,136,3,13,31,1,248,11,20,30,1,244,70,15,18,5,9,5,120,4,15,224,7,9,31,19,60,2,20,28,128,166,32,15,226,31,14,79,0,0,0,22,52,22,32,30,87,44,25,
+    31,33,60,25,8,12,242,3,27,5,48,19,8,88,1,24,2,250,3,14,88,25,8,70,72,5,120,17,15,220,91,38,31,0,0,1,79,15,186,38,21,7,210,47,15,0,1,6,8,151,39,25,0,33,0,15,2,1,40,3,32,65,31,5,24,5,
+    40,15,218,5,1,31,5,8,5,0,31,5,236,11,4,15,24,2,21,25,0,115,79,3,109,4,47,254,0,27,2,66,9,156,3,15,216,76,12,31,3,204,76,0,15,234,31,2,6,62,21,8,39,70,15,156,18,6,4,252,55,31,5,68,61,
+    23,24,29,28,46,15,188,75,81,31,4,86,15,3,15,112,2,7,15,212,0,31,1,152,0,31,3,212,0,44,5,4,47,15,213,0,65,31,20,68,4,30,13,80,6,15,180,1,49,21,254,9,59,15,229,0,24,15,190,1,27,31,0,
+    236,0,37,9,228,8,15,236,0,48,6,195,14,15,236,0,72,4,124,59,15,24,18,24,15,204,1,50,31,0,200,1,26,31,0,215,0,26,15,240,6,40,31,49,176,61,12,15,184,2,44,31,0,190,2,36,15,240,6,27,31,
+    23,124,16,36,15,140,46,2,15,222,58,1,31,49,254,0,24,10,30,6,42,253,128,26,18,3,202,6,14,16,13,15,243,11,38,2,76,26,47,254,128,24,90,25,15,58,80,33,28,5,210,11,15,70,80,5,4,175,10,15,
+    67,69,30,4,192,93,15,136,4,28,9,32,7,15,186,78,29,15,38,27,1,6,161,91,24,128,172,13,8,103,17,31,255,246,36,26,15,216,0,35,15,238,27,6,15,216,0,33,2,44,7,15,218,0,62,4,160,34,47,0,5,
+    124,101,34,31,51,186,1,57,15,26,27,0,15,228,0,4,15,192,1,36,47,4,128,32,7,31,15,152,2,57,15,219,0,11,31,0,216,0,31,18,13,184,79,31,5,116,34,13,13,98,3,31,5,148,64,13,13,215,27,4,171,
+    15,15,127,1,17,15,152,0,22,13,34,3,31,5,54,57,18,12,243,100,15,154,0,24,63,0,0,14,156,0,16,31,55,226,2,7,15,58,1,16,47,255,0,62,1,12,15,64,1,21,15,156,31,23,15,158,0,22,15,155,0,7,
+    15,147,31,17,31,21,176,29,30,31,83,222,87,31,15,62,86,34,5,225,23,15,59,86,0,31,0,146,7,30,31,25,144,9,34,2,128,15,15,90,11,6,15,130,79,57,10,54,26,15,134,79,30,15,123,11,32,9,68,3,
+    31,16,32,1,22,15,0,15,18,15,140,79,13,15,67,72,3,12,105,72,15,0,7,24,31,0,196,0,30,15,240,14,14,15,196,0,9,11,232,14,15,197,0,55,15,184,15,32,15,224,14,21,15,32,81,19,31,254,213,0,
+    25,15,217,0,23,15,216,0,32,15,204,14,21,15,216,0,13,12,196,14,15,216,0,58,31,16,188,14,22,15,184,14,18,15,244,22,12,15,160,1,23,31,0,116,2,24,15,44,107,10,31,19,182,34,4,15,190,55,
+    6,15,188,55,16,6,16,22,31,4,32,15,36,15,232,72,1,15,106,5,1,15,154,5,9,8,8,21,5,26,14,5,242,21,9,105,5,10,137,5,7,38,27,31,3,31,14,36,15,116,20,41,15,84,80,41,18,1,156,1,15,83,80,20,
+    31,4,204,17,38,15,120,20,29,15,216,0,45,5,76,13,15,218,0,69,15,124,20,52,15,188,1,46,15,48,85,11,15,232,0,5,31,128,60,22,33,15,144,19,33,15,224,0,42,31,0,220,0,28,31,0,157,2,28,31,
+    13,132,25,16,15,146,2,18,12,32,43,3,126,2,31,0,33,43,10,15,205,12,19,15,244,41,24,31,19,194,71,24,15,96,40,2,7,179,14,15,122,66,1,15,92,40,26,18,25,44,78,47,4,128,96,11,37,31,49,226,
+    20,44,15,26,42,13,15,6,112,4,15,176,98,8,18,128,252,5,63,4,0,128,1,0,39,15,244,40,32,12,218,15,15,224,78,35,5,147,35,15,228,78,5,47,4,0,22,4,25,15,188,41,33,31,5,200,0,48,7,30,16,15,
+    202,0,53,15,76,78,36,15,58,16,0,15,154,1,37,6,78,16,15,212,0,13,15,214,0,23,15,16,19,40,15,218,0,56,8,14,67,15,220,0,15,15,180,1,25,15,164,112,28,31,1,212,0,53,15,207,0,15,31,3,168,
+    1,33,15,120,22,33,31,51,84,3,52,22,1,16,24,15,89,3,12,31,128,62,8,30,47,0,22,48,52,32,31,87,50,52,7,15,100,101,21,15,68,42,11,39,254,128,27,52,15,50,52,53,2,248,6,31,15,128,68,20,15,
+    46,83,30,13,140,121,15,58,83,2,31,255,59,56,20,15,144,6,56,15,120,82,38,31,255,124,82,11,15,199,5,30,15,148,6,37,31,3,204,0,45,5,165,0,15,205,0,56,15,148,6,53,15,210,0,42,31,254,213,
+    0,18,15,164,1,34,15,184,5,39,15,232,84,40,15,207,0,11,31,3,204,0,29,31,9,228,80,8,13,42,3,15,222,80,5,14,163,82,15,133,0,5,15,112,0,14,9,206,2,15,18,83,18,15,113,0,12,5,200,81,15,160,
+    41,10,12,118,2,15,122,0,9,31,254,125,0,1,15,240,0,11,31,128,240,0,7,31,51,96,1,16,15,115,0,2,31,254,52,9,57,31,49,10,19,0,15,102,88,29,10,114,77,6,241,57,15,99,88,5,15,164,52,32,8,
+    204,15,15,36,5,26,31,51,10,30,8,15,220,15,21,6,28,29,31,254,99,14,1,15,35,86,7,15,233,58,17,15,140,61,27,15,192,6,10,15,160,1,17,31,255,112,82,14,15,238,5,23,15,72,62,29,31,5,188,0,
+    40,7,60,13,15,190,0,53,15,36,61,32,15,164,6,13,15,104,123,16,15,188,94,3,15,31,3,7,15,202,0,17,15,24,3,56,15,206,0,28,8,24,3,15,208,0,19,15,156,1,21,15,48,60,28,31,51,24,3,44,15,195,
+    0,16,15,99,7,22,1,0,55,15,72,11,1,31,0,74,36,5,26,1,28,132,2,193,11,8,106,0,1,179,120,0,228,5,15,20,62,24,9,112,13,15,104,66,1,15,128,130,9,31,49,198,11,4,23,2,192,124,31,0,126,130,
+    0,6,131,89,31,0,218,30,31,8,40,62,15,16,5,28,15,164,21,36,3,52,77,15,7,95,18,15,184,2,27,15,20,5,28,15,68,23,36,2,20,5,15,194,0,57,15,20,5,42,15,198,0,39,15,86,7,13,15,74,18,31,15,
+    68,4,39,15,76,2,37,15,195,0,18,31,3,192,0,24,3,244,95,15,136,22,26,15,86,2,46,15,216,36,7,31,254,35,84,25,15,53,14,27,9,200,10,31,255,100,135,28,31,19,130,100,52,15,76,24,13,15,88,
+    24,42,8,217,1,4,216,1,15,116,75,34,15,216,1,57,15,182,2,22,11,240,0,31,255,25,100,32,69,0,21,1,2,159,148,53,36,0,72,152,152,53,26,0,130,130,152,51,14,0,108,12,0,23,3,24,0,23,4,12,0,
+    18,5,150,67,1,1,0,17,6,24,0,4,252,149,51,18,0,20,12,0,83,1,0,13,0,49,12,0,83,2,0,7,0,38,12,0,83,3,0,17,0,45,12,0,23,4,36,0,83,5,0,10,0,62,12,0,17,6,24,0,49,3,0,1,204,152,0,168,0,2,
+    12,0,2,168,0,2,12,0,2,168,0,2,12,0,83,3,0,34,0,122,12,0,23,4,36,0,2,168,0,2,12,0,2,168,0,147,50,0,48,0,48,0,52,0,47,6,0,241,64,49,0,53,98,121,32,84,114,105,115,116,97,110,32,71,114,
+    105,109,109,101,114,82,101,103,117,108,97,114,84,84,88,32,80,114,111,103,103,121,67,108,101,97,110,84,84,50,48,48,52,47,48,52,47,49,53,0,98,0,121,0,32,0,84,0,114,0,105,0,115,0,116,
+    0,97,0,110,0,32,0,71,16,0,241,32,109,0,109,0,101,0,114,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,84,0,84,0,88,0,32,0,80,0,114,0,111,0,103,0,103,0,121,0,67,0,108,0,101,60,0,0,30,0,38,
+    0,0,156,1,18,20,46,154,10,1,0,17,1,159,139,241,47,1,2,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,
+    1,30,1,31,1,32,215,3,241,68,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,0,36,
+    0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,82,1,250,255,100,49,0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,57,0,58,0,59,0,60,0,61,0,62,0,63,0,64,0,65,0,66,0,67,0,68,0,69,0,70,0,71,
+    0,72,0,73,0,74,0,75,0,76,0,77,0,78,0,79,0,80,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,0,92,0,93,0,94,0,95,0,96,0,97,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,
+    1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,0,172,0,163,0,132,0,133,0,189,0,150,0,232,0,134,0,142,0,139,0,157,
+    0,169,0,164,0,239,0,138,0,218,0,131,0,147,0,242,0,243,0,141,0,151,0,136,0,195,0,222,0,241,0,158,0,170,0,245,0,244,0,246,0,162,0,173,0,201,0,199,0,174,0,98,0,99,0,144,0,100,0,203,0,
+    101,0,200,0,202,0,207,0,204,0,205,0,206,0,233,0,102,0,211,0,208,0,209,0,175,0,103,0,240,0,145,0,214,0,212,0,213,0,104,0,235,0,237,0,137,0,106,0,105,0,107,0,109,0,108,0,110,0,160,0,
+    111,0,113,0,112,0,114,0,115,0,117,0,116,0,118,0,119,0,234,0,120,0,122,0,121,0,123,0,125,0,124,0,184,0,161,0,127,0,126,0,128,0,129,0,236,0,238,0,186,14,117,110,105,99,111,100,101,35,
+    48,120,48,48,48,49,15,0,26,50,15,0,26,51,15,0,26,52,15,0,26,53,15,0,26,54,15,0,26,55,15,0,26,56,15,0,26,57,15,0,26,97,15,0,26,98,15,0,26,99,15,0,26,100,15,0,26,101,15,0,25,102,15,0,
+    42,49,48,15,0,10,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,26,49,240,0,233,
+    49,102,6,100,101,108,101,116,101,4,69,117,114,111,27,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,
+    237,0,26,56,237,0,26,56,237,0,26,56,237,0,26,56,221,1,26,57,221,1,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,240,0,26,57,
+    240,0,26,57,240,0,26,57,240,0,26,57,240,0,25,57,240,0,80,48,57,102,0,0,
 };
 
 static const char* GetDefaultCompressedFontDataTTF(int* out_size)
@@ -6303,6 +8580,65 @@ static const char* GetDefaultCompressedFontDataTTF(int* out_size)
     *out_size = proggy_clean_ttf_compressed_size;
     return (const char*)proggy_clean_ttf_compressed_data;
 }
+
+#ifdef IMGUI_ENABLE_PREBAKED_DEFAULT_FONT
+// File: 'ProggyClean.ttf', prebaked glyphs at sizes 13 (11764 bytes)
+// Exported using binary_to_compressed_c.exe -u8 -lz4 -prebake 13 "ProggyClean.ttf" proggy_clean_ttf_prebaked
+static const unsigned int proggy_clean_ttf_prebaked_compressed_size = 2811;
+static const unsigned char proggy_clean_ttf_prebaked_compressed_data[2811] =
+{
+    76,90,52,1,0,0,45,244,0,0,10,239,240,17,73,77,80,66,1,0,0,0,248,160,0,0,201,194,1,248,115,116,98,95,116,114,117,101,116,121,112,101,0,0,0,0,28,0,145,0,0,80,65,223,0,0,0,32,12,0,51,
+    224,64,0,1,0,19,33,16,0,145,3,0,248,255,1,0,8,0,255,1,0,51,0,255,34,24,0,178,2,0,247,255,3,0,3,0,255,0,255,3,0,21,35,65,0,80,248,255,7,0,8,13,0,53,255,0,255,7,0,3,64,0,15,20,0,14,35,
+    0,36,72,0,113,1,0,248,255,5,0,9,24,0,3,43,0,21,0,44,0,1,55,0,20,0,17,0,20,255,15,0,44,0,37,133,0,4,39,0,5,60,0,22,255,152,0,23,0,15,0,23,255,39,0,71,0,255,0,38,133,0,17,6,72,0,3,97,
+    0,5,3,0,1,18,0,3,189,0,23,255,75,0,1,155,0,37,255,39,62,1,48,247,255,1,38,1,57,255,255,40,57,1,23,11,191,0,12,89,0,3,7,0,27,41,49,0,8,28,0,9,3,0,4,5,0,21,42,181,0,119,250,255,5,0,5,
+    0,0,214,0,23,255,5,1,47,0,43,41,0,1,21,0,146,1,6,15,0,21,44,41,0,83,254,255,2,0,4,78,0,53,255,0,45,24,0,82,252,255,5,0,1,55,0,21,46,176,0,149,254,255,1,0,2,0,255,255,47,39,0,83,247,
+    255,5,0,10,115,1,21,0,196,0,15,9,0,14,41,0,48,13,2,19,8,94,1,20,0,144,1,3,143,0,21,255,15,0,3,15,2,44,0,49,56,0,6,179,1,7,94,0,9,5,0,1,196,0,31,50,112,0,6,8,156,0,25,255,168,0,0,1,
+    0,31,51,56,0,13,39,255,255,254,0,6,168,0,28,52,104,2,12,36,0,23,0,244,2,5,48,3,3,36,0,75,0,255,0,53,120,0,11,34,0,4,13,0,13,120,0,30,54,32,1,27,255,212,0,9,103,1,4,56,0,31,55,112,0,
+    1,15,201,1,16,31,56,200,1,11,31,0,112,0,5,31,57,0,2,13,4,23,1,7,114,0,0,13,0,21,58,128,3,83,250,255,1,0,6,173,3,23,59,248,2,18,2,30,4,21,255,8,4,69,255,255,0,60,62,4,49,250,255,6,24,
+    3,7,231,3,4,51,4,5,8,0,21,61,78,0,50,251,255,6,228,3,22,255,30,0,0,1,0,23,62,112,0,0,80,0,14,68,0,8,92,0,31,63,124,2,22,4,191,4,2,10,0,29,64,121,5,5,15,5,4,103,5,20,0,255,3,5,7,0,22,
+    0,232,3,4,240,1,29,65,140,2,24,255,55,2,7,3,0,4,153,0,8,33,0,59,0,255,66,64,0,6,75,4,9,192,2,15,58,0,0,2,24,0,31,67,128,0,0,7,108,5,7,246,2,7,3,1,7,117,5,31,68,128,0,12,11,116,0,28,
+    0,65,2,31,69,76,3,16,12,55,4,0,1,0,31,70,56,0,32,0,5,0,31,71,240,0,23,6,81,0,7,240,0,28,72,240,0,15,88,1,3,31,255,252,0,5,21,73,176,5,50,248,255,3,184,0,12,140,6,1,27,1,23,74,104,0,
+    20,4,152,2,15,13,5,3,1,110,0,31,75,152,0,6,11,208,4,10,89,2,5,166,1,28,76,80,1,15,176,5,3,13,136,1,27,77,8,3,38,255,255,2,5,31,255,1,3,0,24,0,7,0,7,117,1,29,78,72,2,6,173,0,5,80,3,
+    8,252,7,26,255,35,0,31,79,72,3,3,31,255,136,2,9,8,85,8,31,80,80,2,0,12,244,4,15,85,2,1,25,81,120,0,31,9,120,0,29,3,254,0,31,82,198,3,15,7,52,3,14,190,1,30,83,58,9,10,244,3,15,8,0,5,
+    3,83,0,29,84,198,1,7,223,9,31,0,7,0,23,31,85,30,3,15,15,20,1,6,0,112,0,28,86,136,0,9,36,2,11,141,9,10,194,10,9,136,0,31,87,72,0,6,9,129,2,8,157,2,3,177,5,10,100,0,31,88,208,0,8,25,
+    0,55,4,15,246,1,3,31,89,208,0,18,15,194,0,1,10,7,0,31,90,32,2,0,9,101,8,15,5,0,5,3,42,0,28,91,214,10,10,72,2,29,255,107,6,27,92,69,10,27,255,4,6,15,11,0,15,30,93,115,0,15,114,0,10,
+    41,255,94,115,0,26,6,131,7,8,72,12,1,5,0,23,95,58,13,20,7,13,11,55,255,255,96,118,0,16,2,15,11,73,0,0,255,97,121,11,20,6,52,4,9,197,12,6,95,3,25,98,135,0,31,9,245,4,1,13,24,4,5,29,
+    4,31,99,107,0,1,7,37,2,7,209,0,75,255,255,0,100,107,0,12,192,1,10,158,0,11,168,0,31,101,107,0,7,11,32,10,0,13,0,29,102,107,0,9,204,4,10,129,12,12,5,0,25,103,107,0,47,9,0,153,0,11,10,
+    193,0,47,0,104,80,1,37,0,5,0,25,105,207,1,22,9,83,11,5,2,0,23,106,95,0,17,4,225,13,7,168,9,31,0,52,7,11,31,107,155,0,12,7,189,12,7,188,9,3,175,0,27,108,155,0,8,149,0,2,2,0,23,109,217,
+    10,17,7,15,11,38,255,0,238,7,15,7,0,9,27,110,220,1,15,37,1,11,31,111,117,2,10,12,221,11,27,112,205,1,15,209,2,11,11,19,1,31,113,10,2,37,0,5,0,28,114,214,0,5,115,5,15,121,2,1,31,115,
+    214,0,0,11,52,8,6,225,4,39,0,116,87,9,19,4,105,5,6,198,0,14,61,14,29,117,140,0,15,93,1,4,1,66,0,31,118,46,0,6,24,0,31,17,3,149,0,28,119,248,1,15,125,6,8,10,118,6,31,120,104,0,1,29,
+    0,144,12,3,17,0,28,121,202,1,15,196,0,10,11,151,3,31,122,99,2,0,15,111,15,3,0,1,0,25,123,42,3,23,11,208,0,13,208,15,31,0,139,6,8,25,124,161,17,21,11,44,11,75,255,255,255,125,98,0,15,
+    73,0,11,15,123,0,6,21,126,124,1,84,251,255,7,0,2,182,3,3,191,3,27,127,111,19,27,129,16,0,23,130,77,17,8,122,17,31,131,255,0,12,15,63,5,11,5,157,0,23,132,95,0,9,198,19,21,133,96,0,18,
+    255,218,17,0,2,0,30,134,179,5,15,48,18,3,15,5,0,1,31,135,61,0,16,15,71,0,6,25,136,61,0,28,3,120,2,30,137,63,17,10,24,19,12,15,8,9,177,11,53,0,0,138,64,0,48,246,255,6,161,18,47,255,
+    0,185,13,2,15,185,10,17,23,139,199,2,19,3,85,19,7,88,9,29,140,154,20,25,255,92,11,9,63,20,30,0,237,19,4,49,0,27,141,41,2,31,142,195,0,8,15,156,9,29,27,143,92,0,27,144,16,0,23,145,53,
+    3,18,2,54,2,73,0,0,255,146,127,6,19,3,95,1,23,147,22,0,19,4,44,0,4,162,4,25,148,42,7,39,3,0,129,4,47,0,149,156,20,2,37,255,255,62,16,4,69,5,31,150,132,20,1,21,151,178,0,39,252,255,
+    140,9,25,152,195,14,36,2,0,109,0,25,153,149,1,20,4,103,0,9,136,1,4,7,0,28,154,200,2,7,13,5,47,0,0,21,6,12,27,155,29,2,26,255,202,2,27,156,168,5,29,0,160,7,12,43,2,4,177,3,27,157,163,
+    1,31,158,166,0,11,15,92,5,11,21,159,77,0,51,247,255,7,171,3,9,107,18,15,50,12,27,27,160,156,0,28,161,83,24,3,159,1,21,162,180,0,25,249,173,21,7,22,2,9,162,23,4,2,2,31,163,197,20,6,
+    15,11,5,1,6,41,16,21,164,152,0,107,249,255,7,0,7,0,131,11,14,123,3,25,255,132,8,63,0,255,165,76,13,32,11,187,21,1,7,0,31,166,133,6,1,2,6,0,29,167,200,1,9,191,11,9,116,24,10,18,0,73,
+    255,255,0,168,241,12,1,197,5,30,169,127,4,7,209,0,7,37,20,23,0,7,0,4,19,8,7,30,1,25,170,74,3,27,5,4,5,2,8,0,31,171,195,3,0,25,255,95,25,3,6,0,23,172,195,3,18,4,127,3,9,148,2,27,173,
+    65,2,31,174,197,0,12,26,255,76,15,9,14,0,8,197,0,21,175,72,0,24,246,38,4,25,176,151,4,29,4,233,17,25,177,168,2,31,7,7,7,9,4,241,1,25,178,83,0,38,5,0,4,2,6,249,6,31,179,36,0,5,6,198,
+    19,41,0,180,122,5,1,77,8,41,0,181,53,4,31,8,185,2,5,25,0,237,9,4,18,1,7,170,0,28,182,56,18,5,56,20,7,13,5,15,2,18,1,9,6,0,21,183,116,2,18,251,82,8,4,1,0,21,184,187,0,33,0,0,53,6,1,
+    132,0,23,185,245,0,1,46,7,24,255,163,0,43,255,186,20,1,8,139,1,4,199,0,27,187,103,2,12,146,0,5,113,2,28,188,35,7,10,191,0,15,50,8,6,7,48,1,5,154,2,31,189,76,0,29,9,62,19,25,255,250,
+    1,25,190,135,2,21,10,147,28,10,64,4,9,133,8,23,255,164,0,40,255,0,129,20,5,163,1,31,191,251,26,2,30,0,125,27,11,152,15,29,192,218,0,10,210,5,15,11,24,25,30,193,38,1,11,184,24,15,76,
+    0,23,30,194,152,0,8,22,9,15,76,0,26,31,195,228,0,0,26,255,230,6,15,76,0,22,23,196,163,2,19,6,17,16,15,146,0,31,31,197,222,0,9,8,215,19,15,76,0,16,31,198,130,31,0,14,96,31,7,82,8,15,
+    44,4,2,57,255,255,199,17,4,31,11,137,25,30,14,138,19,23,200,230,0,18,5,165,10,13,43,5,15,50,25,7,0,1,0,28,201,66,0,30,0,216,8,15,66,0,11,29,202,66,0,10,11,32,15,66,0,15,31,203,92,9,
+    3,15,61,0,19,21,204,32,5,52,246,255,3,3,1,6,232,8,11,116,25,28,205,46,0,6,206,21,15,46,0,0,30,206,92,0,31,255,92,0,7,25,207,30,8,31,9,43,0,9,27,208,42,9,11,162,7,8,217,8,14,100,2,0,
+    22,0,31,209,113,3,14,15,88,25,23,31,210,161,4,26,15,100,25,11,31,211,161,4,26,15,76,0,11,31,212,161,4,26,15,76,0,11,31,213,161,4,26,15,76,0,11,31,214,161,4,20,15,70,0,11,29,215,102,
+    7,11,217,14,4,12,0,31,216,247,26,1,9,188,11,6,80,7,13,213,11,79,255,0,0,217,223,1,14,15,189,25,23,31,218,223,1,14,15,76,0,23,31,219,223,1,14,15,76,0,23,31,220,147,1,8,15,70,0,23,31,
+    221,56,8,0,29,255,10,3,15,174,13,29,31,222,119,29,7,11,152,21,10,222,4,25,223,53,14,27,10,127,32,10,15,4,10,57,4,12,7,0,7,205,11,47,0,224,54,18,3,8,241,5,15,57,25,7,30,225,206,24,12,
+    171,15,15,61,0,7,31,226,122,0,2,31,255,122,0,19,31,227,61,0,0,31,255,61,0,21,28,228,186,9,15,56,0,20,31,229,218,6,8,15,244,0,19,31,230,128,16,3,39,0,0,97,39,14,128,16,0,19,0,31,231,
+    135,23,0,15,103,26,7,11,130,10,30,232,81,7,28,0,180,0,15,72,26,6,31,233,168,1,4,15,61,0,18,31,234,229,1,16,15,61,0,6,31,235,168,1,11,15,56,0,6,28,236,168,25,11,128,23,61,0,255,237,
+    101,26,27,255,101,26,27,238,189,7,9,140,28,10,3,0,31,239,232,7,2,15,43,0,2,30,240,110,16,15,219,30,0,14,97,25,1,215,0,31,241,23,9,1,26,255,92,36,15,17,24,6,31,242,3,2,22,15,122,0,0,
+    31,243,232,3,16,15,61,0,6,31,244,3,2,22,15,61,0,0,31,245,232,3,16,15,61,0,6,31,246,64,2,17,15,56,0,0,31,247,27,21,2,10,124,20,1,20,0,29,248,81,19,43,0,0,217,20,5,222,15,7,125,39,47,
+    0,249,141,1,11,15,214,25,11,31,250,144,3,11,15,61,0,11,31,251,141,1,11,15,61,0,11,31,252,80,1,6,15,56,0,11,25,253,117,0,29,12,84,12,15,197,26,25,25,254,132,0,31,10,167,31,22,12,137,
+    23,4,66,0,31,11,198,0,22,6,65,0,80,0,255,255,255,0,
+};
+static const void* GetDefaultPrebakedFontData(int* out_size)
+{
+    *out_size = (int)proggy_clean_ttf_prebaked_compressed_size;
+    return proggy_clean_ttf_prebaked_compressed_data;
+}
+#endif // #ifdef IMGUI_ENABLE_PREBAKED_DEFAULT_FONT
 #endif // #ifndef IMGUI_DISABLE_DEFAULT_FONT
 
 #endif // #ifndef IMGUI_DISABLE
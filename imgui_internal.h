@@ -63,6 +63,9 @@ Index of this file:
 #if (defined __SSE__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))) && !defined(IMGUI_DISABLE_SSE)
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
+#if (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_SSE2
+#endif
 #if (defined __AVX__ || defined __SSE4_2__)
 #define IMGUI_ENABLE_SSE4_2
 #include <nmmintrin.h>
@@ -136,6 +139,7 @@ Index of this file:
 // (other types which are not forwarded declared are: ImBitArray<>, ImSpan<>, ImSpanAllocator<>, ImStableVector<>, ImPool<>, ImChunkStream<>)
 struct ImBitVector;                 // Store 1-bit per value
 struct ImRect;                      // An axis-aligned rectangle (2 points)
+struct ImFrameArena;                // Linear allocator for scratch data which doesn't survive the frame.
 struct ImGuiTextIndex;              // Maintain a line index for a text buffer.
 
 // ImDrawList/ImFontAtlas
@@ -184,6 +188,9 @@ struct ImGuiTreeNodeStackData;      // Temporary storage for TreeNode().
 struct ImGuiTypingSelectState;      // Storage for GetTypingSelectRequest()
 struct ImGuiTypingSelectRequest;    // Storage for GetTypingSelectRequest() (aimed to be public)
 struct ImGuiWindow;                 // Storage for one window
+struct ImGuiWindowCost;             // Per-window cost accounting for the current frame (time, items, text, draw commands, allocations)
+struct ImGuiWindowOrderList;        // Linked list of windows (display order, focus order)
+struct ImGuiWindowOrderNode;        // Node of an ImGuiWindowOrderList
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame, in practice we currently keep it for each window)
 struct ImGuiWindowSettings;         // Storage for a window .ini settings (we keep one of those even if the actual window wasn't instanced during this session)
 
@@ -450,6 +457,11 @@ IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 coun
 #define IMGUI_DISABLE_TTY_FUNCTIONS // Can't use stdout, fflush if we are not using default file functions
 #endif
 IMGUI_API void*             ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_file_size = NULL, int padding_bytes = 0);
+IMGUI_API const void*       ImFileMap(const char* filename, size_t* out_file_size);  // Map file read-only, shared and reference counted by file identity. Return NULL if unsupported or failed (use ImFileLoadToMemory() instead).
+IMGUI_API bool              ImFileUnmap(const void* data);                          // Release a reference obtained with ImFileMap(). Return false if 'data' is not a mapping.
+
+// Helpers: Time
+IMGUI_API ImU64             ImTimeGetMicroseconds();                                // Monotonic high resolution timer. Only meaningful for measuring durations.
 
 // Helpers: Maths
 IM_MSVC_RUNTIME_CHECKS_OFF
@@ -801,6 +813,43 @@ struct ImGuiTextIndex
     void            append(const char* base, int old_size, int new_size);
 };
 
+// Helper: ImFrameArena
+// Linear allocator for scratch data which doesn't need to survive the frame. Used as g.FrameArena, reset by NewFrame().
+// - Allocations are never freed individually: Reset() releases everything at once.
+// - Allocations are carved out of the current block. When one doesn't fit another block is allocated (large enough for it),
+//   and Reset() merges blocks into a single one sized for that frame usage, so steady frames don't call the allocator.
+// - The block shrinks back after IM_FRAME_ARENA_SHRINK_FRAMES frames using less than half of it.
+// - With IMGUI_DEBUG_PARANOID, released memory is filled with 0xDD to catch pointers kept past Reset().
+// - Only used by scratch buffers which were allocated on each use (e.g. InputText() paste filtering). Buffers reused every
+//   frame (g.TempBuffer, ImDrawListSplitter channels, ImDrawDataBuilder layers, tables and clipper temp data) already
+//   don't allocate in steady state, and stay persistent.
+#define IM_FRAME_ARENA_BLOCK_SIZE       (16 * 1024)     // Minimum size of blocks
+#define IM_FRAME_ARENA_SHRINK_FRAMES    (120)           // Number of frames to look at before shrinking block
+struct ImFrameArenaBlock
+{
+    char*           Data;
+    int             Size;
+};
+struct IMGUI_API ImFrameArena
+{
+    ImVector<ImFrameArenaBlock> Blocks;     // Blocks.back() is the current block
+    int             BlockSize;              // Size of next first block (grows after frames which overflowed, shrinks after frames of low usage)
+    int             CurrentOffset;          // Offset into current block
+    int             UsedBytes;              // Bytes used since last Reset()
+    int             RecentPeakUsedBytes;    // Max UsedBytes over last frames, to decide on shrinking
+    int             RecentFrames;           // Number of frames accounted in RecentPeakUsedBytes
+    int             PeakUsedBytes;          // Metrics: max UsedBytes over a frame
+    int             OverflowCount;          // Metrics: number of blocks allocated after the first block of a frame
+
+    ImFrameArena()  { BlockSize = IM_FRAME_ARENA_BLOCK_SIZE; CurrentOffset = UsedBytes = RecentPeakUsedBytes = RecentFrames = PeakUsedBytes = OverflowCount = 0; }
+    ~ImFrameArena() { ClearFreeMemory(); }
+    void*           Alloc(size_t size, size_t align = 16);
+    template<typename T>
+    T*              AllocArray(int count)   { return (T*)Alloc(sizeof(T) * (size_t)count); }
+    void            Reset();
+    void            ClearFreeMemory();
+};
+
 // Helper: ImGuiStorage
 IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStoragePair* in_end, ImGuiID key);
 
@@ -1396,6 +1445,7 @@ struct ImGuiWindowStackData
     ImGuiErrorRecoveryState StackSizesInBegin;          // Store size of various stacks for asserting
     bool                    DisabledOverrideReenable;   // Non-child window override disabled flag
     float                   DisabledOverrideReenableAlphaBackup;
+    ImU64                   BeginTime;                  // ImTimeGetMicroseconds() at the time of Begin(), for window->Cost
 };
 
 struct ImGuiShrinkWidthItem
@@ -1423,6 +1473,59 @@ struct ImGuiDeactivatedItemData
     bool        IsAlive;
 };
 
+// Spatial index used by FindHoveredWindowEx(): uniform grid storing, for each cell, indices of active windows overlapping it.
+// Rebuilt in EndFrame() when windows were created, moved, resized, (re)activated or reordered. Unused with few windows.
+#define IMGUI_WINDOWS_HIT_GRID_MIN_WINDOWS  64      // Below this number of windows, FindHoveredWindowEx() does a linear scan
+#define IMGUI_WINDOWS_HIT_GRID_MAX_CELLS    64      // Maximum number of cells on each axis
+struct ImGuiWindowsHitGrid
+{
+    ImRect              Bounds;             // Union of padded OuterRectClipped of indexed windows
+    ImVec2              CellSizeInv;
+    ImVec2              Padding;            // Hit padding applied when building. Grid is unused if current padding is larger.
+    int                 CellsX, CellsY;     // 0 when unused
+    bool                Dirty;              // Request rebuild in EndFrame(). Grid is unused until then.
+    ImVector<int>       CellsOffsets;       // [CellsX * CellsY + 1] Offset of each cell in WindowsIndices[]
+    ImVector<int>       WindowsIndices;     // Indices into g.Windows[], ascending (back to front) within each cell
+
+    ImGuiWindowsHitGrid()   { CellsX = CellsY = 0; Dirty = true; }
+    void                Clear() { CellsX = CellsY = 0; Dirty = true; CellsOffsets.clear(); WindowsIndices.clear(); }
+};
+
+// Node of an ImGuiWindowOrderList, stored in ImGuiWindowOrderList::Nodes[] at index window->DisplayOrderIdx or window->FocusOrderIdx.
+struct ImGuiWindowOrderNode
+{
+    ImGuiWindow*        Window;
+    int                 PrevIdx;            // Node behind us, -1 if first
+    int                 NextIdx;            // Node in front of us, -1 if last. Next unused node when unused.
+};
+
+// Doubly linked list of windows, back to front (g.WindowsDisplayOrder, g.WindowsFocusOrder).
+// Moving a window is O(1) and doesn't need searching for it. Nodes are stored contiguously so walking the list doesn't touch windows memory.
+struct IMGUI_API ImGuiWindowOrderList
+{
+    ImVector<ImGuiWindowOrderNode> Nodes;
+    int                 FirstIdx;           // Back-most window node, -1 if empty
+    int                 LastIdx;            // Front-most window node, -1 if empty
+    int                 FreeIdx;            // First unused node, -1 if none
+    int                 Size;
+
+    ImGuiWindowOrderList()  { Clear(); }
+    void                Clear()             { Nodes.clear(); FirstIdx = LastIdx = FreeIdx = -1; Size = 0; } // Doesn't reset windows indices: only use when windows are destroyed.
+    ImGuiWindow*        GetFirst() const    { return FirstIdx >= 0 ? Nodes[FirstIdx].Window : NULL; }
+    ImGuiWindow*        GetLast() const     { return LastIdx >= 0 ? Nodes[LastIdx].Window : NULL; }
+    ImGuiWindow*        GetPrev(ImGuiWindow* window) const;
+    ImGuiWindow*        GetNext(ImGuiWindow* window) const;
+    bool                Contains(ImGuiWindow* window) const;
+    void                InsertAfter(ImGuiWindow* window, ImGuiWindow* prev);   // prev == NULL: insert as first (back-most)
+    void                InsertBefore(ImGuiWindow* window, ImGuiWindow* next);  // next == NULL: insert as last (front-most)
+    void                Remove(ImGuiWindow* window);
+};
+
+// Recycling of unused transient windows (child windows, popups, tooltips), see GcRecycleTransientWindows().
+// Without it, submitting child windows with unique names (e.g. one per data row) accumulates windows forever.
+#define IMGUI_WINDOWS_TRANSIENT_UNUSED_MAX  256     // Unused transient windows kept alive with their state. Least recently used ones are recycled beyond that.
+#define IMGUI_WINDOWS_POOL_MAX              64      // Recycled windows kept in g.WindowsPool[] for reuse by CreateNewWindow(), along with their draw list buffers.
+
 //-----------------------------------------------------------------------------
 // [SECTION] Popup support
 //-----------------------------------------------------------------------------
@@ -2074,6 +2177,105 @@ struct ImGuiDebugAllocInfo
     ImGuiDebugAllocInfo() { memset(this, 0, sizeof(*this)); }
 };
 
+// Allocation tags, only tracked when IMGUI_ENABLE_DEBUG_ALLOC_TAGS is defined.
+// Allocations made through IM_ALLOC() (including ImVector<> growth) are attributed to the current tag of the calling thread,
+// which subsystems set with IM_ALLOC_TAG_SCOPE(). Innermost scope wins. Displayed in 'Metrics/Debugger->Memory allocations'.
+enum ImGuiAllocTag
+{
+    ImGuiAllocTag_Misc,         // Anything outside of a tagged scope
+    ImGuiAllocTag_Windows,      // Windows creation
+    ImGuiAllocTag_DrawList,     // Draw lists commands, vertices, indices and splitter channels
+    ImGuiAllocTag_Text,         // Text buffers, text input
+    ImGuiAllocTag_Tables,       // Tables storage, temp data and settings
+    ImGuiAllocTag_Fonts,        // Font atlas, fonts, baked fonts and textures
+    ImGuiAllocTag_Storage,      // ImGuiStorage maps
+    ImGuiAllocTag_COUNT
+};
+
+#ifdef IMGUI_ENABLE_DEBUG_ALLOC_TAGS
+struct ImGuiAllocTagStats
+{
+    size_t      LiveBytes;
+    size_t      PeakBytes;
+    int         LiveCount;
+    int         TotalAllocCount;
+    int         FrameCount;                 // Last frame with allocations (as per current context at the time of allocating)
+    int         FrameAllocCount;            // Number of allocations during FrameCount
+    int         PrevFrameAllocCount;        // Number of allocations during FrameCount - 1
+};
+#endif
+
+// Profiler, only compiled when IMGUI_ENABLE_PROFILER is defined. See ImGui::ProfileBegin() and IM_PROFILE_SCOPE().
+// Events are recorded for the last IMGUI_PROFILER_FRAMES frames, a frame spanning from one NewFrame() to the next one.
+#ifdef IMGUI_ENABLE_PROFILER
+#define IMGUI_PROFILER_FRAMES               120     // Number of frames kept in the ring buffer (including the one being recorded)
+#define IMGUI_PROFILER_MAX_EVENTS           8192    // Maximum number of events recorded per frame. Further events are counted as dropped.
+
+struct ImGuiProfilerEvent
+{
+    const char*     Name;
+    ImGuiID         WindowID;                   // Window which name is displayed along with Name, if any (e.g. for "Begin")
+    int             Depth;                      // Nesting level within the frame
+    ImU64           StartTime;                  // In microseconds, see ImTimeGetMicroseconds()
+    ImU64           EndTime;                    // == StartTime while event is open
+};
+
+struct ImGuiProfilerFrame
+{
+    int             FrameCount;
+    ImU64           StartTime;
+    ImU64           EndTime;
+    int             DroppedEventsCount;
+    ImVector<ImGuiProfilerEvent> Events;        // In order of ProfileBegin() calls
+
+    ImGuiProfilerFrame() { FrameCount = DroppedEventsCount = 0; StartTime = EndTime = 0; }
+};
+
+struct ImGuiProfiler
+{
+    ImGuiProfilerFrame Frames[IMGUI_PROFILER_FRAMES]; // Ring buffer
+    int             FramesIdx;                  // Frame being recorded (when Recording is set)
+    int             FramesCount;                // Number of completed frames, ending at FramesIdx - 1
+    ImVector<int>   Stack;                      // Index of open events in current frame (-1 for dropped ones)
+    bool            Recording;
+    bool            Paused;                     // Stop recording from next frame (set from Metrics)
+    int             ViewFrameOffset;            // Viewer: displayed frame, 0 == last completed frame
+    float           ViewZoom;                   // Viewer: timeline zoom
+
+    ImGuiProfiler() { FramesIdx = FramesCount = 0; Recording = Paused = false; ViewFrameOffset = 0; ViewZoom = 1.0f; }
+};
+#endif
+
+// Transient memory accounting, see GcCalcTransientMemoryUsage() and io.ConfigMemoryCompactBudget.
+// Only counts buffers which can be freed without user-visible loss when unused (they are regrown on demand).
+enum ImGuiTransientMemoryKind
+{
+    ImGuiTransientMemoryKind_Windows,       // Windows draw lists and stacks
+    ImGuiTransientMemoryKind_Tables,        // Tables sort specs and columns names
+    ImGuiTransientMemoryKind_TablesTempData,// Tables temp data (draw splitters), one per nesting level
+    ImGuiTransientMemoryKind_InputText,     // Text input state buffers
+    ImGuiTransientMemoryKind_Fonts,         // Baked fonts (glyphs + index) of atlases used by the context. A shared atlas is accounted in each context.
+    ImGuiTransientMemoryKind_Clipper,       // List clipper temp data
+    ImGuiTransientMemoryKind_COUNT
+};
+
+struct ImGuiTransientMemoryUsage
+{
+    int         Bytes[ImGuiTransientMemoryKind_COUNT];
+    int         BytesTotal;
+
+    ImGuiTransientMemoryUsage() { memset(this, 0, sizeof(*this)); }
+};
+
+// Trimmable buffer, see GcCompactTransientBuffersToBudget()
+struct ImGuiTransientMemoryEntry
+{
+    ImGuiTransientMemoryKind Kind;
+    void*       Ptr;                        // ImGuiWindow*, ImGuiTable*, ImGuiTableTempData*, ImGuiInputTextState* or ImGuiInputTextDeactivatedState*, ImFontBaked*, ImVector<ImGuiListClipperData>*
+    int         Bytes;
+    float       Score;                      // Bytes * (1 + seconds since last use). Highest are freed first.
+};
+
 struct ImGuiMetricsConfig
 {
     bool        ShowDebugLog = false;
@@ -2164,9 +2366,12 @@ struct ImGuiContext
     bool                    WithinFrameScope;                   // Set by NewFrame(), cleared by EndFrame()
     bool                    WithinFrameScopeWithImplicitWindow; // Set by NewFrame(), cleared by EndFrame() when the implicit debug window has been pushed
     bool                    GcCompactAll;                       // Request full GC
+    ImGuiTransientMemoryUsage GcTransientMemoryUsage;           // Transient memory usage, updated by NewFrame() when io.ConfigMemoryCompactBudget is set (after compacting)
+    int                     GcTransientMemoryCompactedCount;    // Metrics: number of buffers freed to honor io.ConfigMemoryCompactBudget
     bool                    TestEngineHookItems;                // Will call test engine hooks: ImGuiTestEngineHook_ItemAdd(), ImGuiTestEngineHook_ItemInfo(), ImGuiTestEngineHook_Log()
     void*                   TestEngine;                         // Test engine user data
     char                    ContextName[16];                    // Storage for a context name (to facilitate debugging multi-context setups)
+    ImFrameArena            FrameArena;                         // Scratch memory for data which doesn't survive the frame. Reset by NewFrame().
 
     // Inputs
     ImVector<ImGuiInputEvent> InputEventsQueue;                 // Input events which will be trickled/written into IO structure.
@@ -2175,9 +2380,17 @@ struct ImGuiContext
     ImU32                   InputEventsNextEventId;
 
     // Windows state
-    ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
-    ImVector<ImGuiWindow*>  WindowsFocusOrder;                  // Root windows, sorted in focus order, back to front.
-    ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
+    ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front. Copy of WindowsDisplayOrder, updated on demand (see UpdateWindowsFromDisplayOrder()).
+    ImGuiWindowOrderList    WindowsDisplayOrder;                // All windows, sorted in display order, back to front. Active child windows are relinked after their parent in EndFrame().
+    ImGuiWindowOrderList    WindowsFocusOrder;                  // Root windows, sorted in focus order, back to front.
+    ImVector<ImGuiWindow*>  WindowsDisplayOrderRelink;          // Windows which were moved, (de)activated or changed parent/child windows this frame. EndFrame() relinks the child windows of their top-most parent.
+    bool                    WindowsDisplayOrderChanged;         // Set when WindowsDisplayOrder changed, so Windows[] needs to be updated.
+    ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used by GcRecycleTransientWindows(), EndFrame() and debug tools
+    ImGuiWindowsHitGrid     WindowsHitGrid;                     // Spatial index of windows for FindHoveredWindowEx()
+    ImVector<ImGuiWindow*>  WindowsPool;                        // Recycled transient windows, most recently recycled last. Reused by CreateNewWindow().
+    int                     WindowsPoolRecycledCount;           // Metrics: number of transient windows recycled
+    int                     WindowsPoolReusedCount;             // Metrics: number of windows created from WindowsPool[]
+    int                     WindowsTransientUnusedLimit;        // Number of unused transient windows above which GcRecycleTransientWindows() is called. >= IMGUI_WINDOWS_TRANSIENT_UNUSED_MAX, higher when referenced windows couldn't be recycled.
     ImVector<ImGuiWindowStackData> CurrentWindowStack;
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
@@ -2501,6 +2714,11 @@ struct ImGuiContext
     ImGuiMetricsConfig      DebugMetricsConfig;
     ImGuiIDStackTool        DebugIDStackTool;
     ImGuiDebugAllocInfo     DebugAllocInfo;
+    bool                    DebugWindowsCostsEnabled;           // Collect window->Cost this frame. Set by NewFrame() from io.ConfigDebugWindowsCosts or DebugWindowsCostsRequestFrame.
+    int                     DebugWindowsCostsRequestFrame;      // Last frame Metrics->Windows costs was displayed
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiProfiler           Profiler;
+#endif
 #if defined(IMGUI_DEBUG_HIGHLIGHT_ALL_ID_CONFLICTS) && !defined(IMGUI_DISABLE_DEBUG_TOOLS)
     ImGuiStorage            DebugDrawIdConflictsAliveCount;
     ImGuiStorage            DebugDrawIdConflictsHighlightSet;
@@ -2562,6 +2780,7 @@ struct IMGUI_API ImGuiWindowTempData
     ImU32                   TreeHasStackDataDepthMask;      // Store whether given depth has ImGuiTreeNodeStackData data. Could be turned into a ImU64 if necessary.
     ImU32                   TreeRecordsClippedNodesY2Mask;  // Store whether we should keep recording Y2. Cleared when passing clip max. Equivalent TreeHasStackDataDepthMask value should always be set.
     ImVector<ImGuiWindow*>  ChildWindows;
+    bool                    ChildWindowsNeedSort;   // Set when ChildWindows[] was submitted out of ChildWindowComparer() order
     ImGuiStorage*           StateStorage;           // Current persistent per-window storage (store e.g. tree node open/close state)
     ImGuiOldColumns*        CurrentColumns;         // Current columns set
     int                     CurrentTableIdx;        // Current table index (into g.Tables)
@@ -2579,6 +2798,38 @@ struct IMGUI_API ImGuiWindowTempData
     ImVector<float>         TextWrapPosStack;       // Store text wrap pos to restore (attention: .back() is not == TextWrapPos)
 };
 
+// Metrics which may be used to sort windows by cost. See DebugGetWindowsSortedByCost().
+enum ImGuiWindowCostMetric
+{
+    ImGuiWindowCostMetric_TimeSelf,             // Time spent between Begin()/End(), excluding windows begun in-between (e.g. child windows)
+    ImGuiWindowCostMetric_TimeTotal,            // Time spent between Begin()/End(), including windows begun in-between
+    ImGuiWindowCostMetric_ItemsSubmitted,
+    ImGuiWindowCostMetric_ItemsClipped,
+    ImGuiWindowCostMetric_TextBytes,
+    ImGuiWindowCostMetric_DrawCmds,
+    ImGuiWindowCostMetric_AllocCount,
+    ImGuiWindowCostMetric_COUNT
+};
+
+// Per-window cost accounting, accumulated over all Begin()/End() pairs of a frame.
+// Stored in window->Cost (frame being submitted) and window->CostLastFrame (last complete frame, which is what Metrics displays).
+// Only collected when g.DebugWindowsCostsEnabled is set (io.ConfigDebugWindowsCosts, or Metrics->Windows costs open).
+// Times are in microseconds and as precise as ImTimeGetMicroseconds() is. Counters are attributed to g.CurrentWindow.
+struct ImGuiWindowCost
+{
+    ImU64                   TimeTotal;          // Time between Begin()/End()
+    ImU64                   TimeNested;         // Part of TimeTotal spent in windows begun in-between
+    int                     ItemsSubmitted;     // Number of ItemAdd() calls
+    int                     ItemsClipped;       // Number of ItemAdd() calls which were clipped
+    int                     TextBytes;          // Number of bytes of text measured or rendered
+    int                     DrawCmds;           // Size of window->DrawList->CmdBuffer on the last End()
+    int                     AllocCount;         // Number of MemAlloc() calls while the window was current
+
+    ImGuiWindowCost()       { memset(this, 0, sizeof(*this)); }
+    ImU64                   GetTimeSelf() const { return TimeTotal - TimeNested; }
+    ImU64                   GetValue(ImGuiWindowCostMetric metric) const;
+};
+
 // Storage for one window
 struct IMGUI_API ImGuiWindow
 {
@@ -2625,6 +2876,7 @@ struct IMGUI_API ImGuiWindow
     bool                    Hidden;                             // Do not display (== HiddenFrames*** > 0)
     bool                    IsFallbackWindow;                   // Set on the "Debug##Default" window.
     bool                    IsExplicitChild;                    // Set when passed _ChildWindow, left to false by BeginDocked()
+    bool                    DisplayOrderRelinkQueued;           // Set when in g.WindowsDisplayOrderRelink[]
     bool                    HasCloseButton;                     // Set when the window has a close button (p_open != NULL)
     signed char             ResizeBorderHovered;                // Current border being hovered for resize (-1: none, otherwise 0-3)
     signed char             ResizeBorderHeld;                   // Current border being held for resize (-1: none, otherwise 0-3)
@@ -2632,7 +2884,6 @@ struct IMGUI_API ImGuiWindow
     short                   BeginCountPreviousFrame;            // Number of Begin() during the previous frame
     short                   BeginOrderWithinParent;             // Begin() order within immediate parent window, if we are a child window. Otherwise 0.
     short                   BeginOrderWithinContext;            // Begin() order within entire imgui context. This is mostly used for debugging submission order related issues.
-    short                   FocusOrder;                         // Order within WindowsFocusOrder[], altered when windows are focused.
     ImS8                    AutoFitFramesX, AutoFitFramesY;
     bool                    AutoFitOnlyGrows;
     ImGuiDir                AutoPosLastDirection;
@@ -2680,6 +2931,8 @@ struct IMGUI_API ImGuiWindow
     ImGuiWindow*            RootWindowForTitleBarHighlight;     // Point to ourself or first ancestor which will display TitleBgActive color when this window is active.
     ImGuiWindow*            RootWindowForNav;                   // Point to ourself or first ancestor which doesn't have the NavFlattened flag.
     ImGuiWindow*            ParentWindowForFocusRoute;          // Set to manual link a window to its logical parent so that Shortcut() chain are honoerd (e.g. Tool linked to Document)
+    int                     DisplayOrderIdx;                    // Index of our node in g.WindowsDisplayOrder.Nodes[], -1 if not linked.
+    int                     FocusOrderIdx;                      // Index of our node in g.WindowsFocusOrder.Nodes[], -1 if not linked (child windows). The list is altered when windows are focused.
 
     ImGuiWindow*            NavLastChildNavWindow;              // When going to the menu bar, we remember the child window we came from. (This could probably be made implicit if we kept g.Windows sorted by last focused including child window.)
     ImGuiID                 NavLastIds[ImGuiNavLayer_COUNT];    // Last known NavId for this window, per layer (0/1)
@@ -2691,6 +2944,9 @@ struct IMGUI_API ImGuiWindow
     int                     MemoryDrawListVtxCapacity;
     bool                    MemoryCompacted;                    // Set when window extraneous data have been garbage collected
 
+    ImGuiWindowCost         Cost;                               // Cost accounting for the frame being submitted
+    ImGuiWindowCost         CostLastFrame;                      // Cost accounting for the last complete frame
+
 public:
     ImGuiWindow(ImGuiContext* context, const char* name);
     ~ImGuiWindow();
@@ -3627,6 +3883,9 @@ namespace ImGui
     IMGUI_API void          GcCompactTransientMiscBuffers();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API void          GcRecycleTransientWindows(int unused_max);
+    IMGUI_API void          GcCalcTransientMemoryUsage(ImGuiTransientMemoryUsage* out_usage);
+    IMGUI_API void          GcCompactTransientBuffersToBudget(int budget);
 
     // Error handling, State Recovery
     IMGUI_API bool          ErrorLog(const char* msg);
@@ -3640,6 +3899,16 @@ namespace ImGui
 
     // Debug Tools
     IMGUI_API void          DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr, size_t size); // size >= 0 : alloc, size = -1 : free
+#ifdef IMGUI_ENABLE_DEBUG_ALLOC_TAGS
+    IMGUI_API ImGuiAllocTag DebugSetAllocTag(ImGuiAllocTag tag);        // Set allocation tag of calling thread, return previous one. Prefer using IM_ALLOC_TAG_SCOPE().
+    IMGUI_API const ImGuiAllocTagStats* DebugGetAllocTagStats(ImGuiAllocTag tag); // Shared by all contexts
+    IMGUI_API const char*   DebugGetAllocTagName(ImGuiAllocTag tag);
+    IMGUI_API void          DebugAllocTagsExportJson(ImGuiTextBuffer* buf);
+#endif
+#ifdef IMGUI_ENABLE_PROFILER
+    IMGUI_API void          ProfileBeginEx(const char* name, ImGuiID window_id);  // Prefer using IM_PROFILE_SCOPE() or IM_PROFILE_SCOPE_WINDOW()
+    IMGUI_API void          DebugProfilerExportChromeTrace(ImGuiTextBuffer* buf); // Recorded frames in Chrome trace event format (JSON)
+#endif
     IMGUI_API void          DebugDrawCursorPos(ImU32 col = IM_COL32(255, 0, 0, 255));
     IMGUI_API void          DebugDrawLineExtents(ImU32 col = IM_COL32(255, 0, 0, 255));
     IMGUI_API void          DebugDrawItemRect(ImU32 col = IM_COL32(255, 0, 0, 255));
@@ -3659,6 +3928,9 @@ namespace ImGui
     IMGUI_API void          DebugNodeFontGlyphesForSrcMask(ImFont* font, ImFontBaked* baked, int src_mask);
     IMGUI_API void          DebugNodeFontGlyph(ImFont* font, const ImFontGlyph* glyph);
     IMGUI_API void          DebugNodeTexture(ImTextureData* tex, int int_id, const ImFontAtlasRect* highlight_rect = NULL); // ID used to facilitate persisting the "current" texture.
+#ifdef IMGUI_ENABLE_PROFILER
+    IMGUI_API void          DebugNodeProfiler(ImGuiProfiler* profiler);
+#endif
     IMGUI_API void          DebugNodeStorage(ImGuiStorage* storage, const char* label);
     IMGUI_API void          DebugNodeTabBar(ImGuiTabBar* tab_bar, const char* label);
     IMGUI_API void          DebugNodeTable(ImGuiTable* table);
@@ -3669,6 +3941,8 @@ namespace ImGui
     IMGUI_API void          DebugNodeWindow(ImGuiWindow* window, const char* label);
     IMGUI_API void          DebugNodeWindowSettings(ImGuiWindowSettings* settings);
     IMGUI_API void          DebugNodeWindowsList(ImVector<ImGuiWindow*>* windows, const char* label);
+    IMGUI_API void          DebugNodeWindowsCosts();
+    IMGUI_API void          DebugGetWindowsSortedByCost(ImVector<ImGuiWindow*>* out_windows, ImGuiWindowCostMetric metric, bool ascending = false); // Windows active during last frame
     IMGUI_API void          DebugNodeWindowsListByBeginStackParent(ImGuiWindow** windows, int windows_size, ImGuiWindow* parent_in_begin_stack);
     IMGUI_API void          DebugNodeViewport(ImGuiViewportP* viewport);
     IMGUI_API void          DebugRenderKeyboardPreview(ImDrawList* draw_list);
@@ -3690,6 +3964,33 @@ namespace ImGui
 
 } // namespace ImGui
 
+// Allocation tags: set tag of the calling thread until the end of current scope.
+#ifdef IMGUI_ENABLE_DEBUG_ALLOC_TAGS
+struct ImGuiAllocTagScope
+{
+    ImGuiAllocTag   BackupTag;
+    ImGuiAllocTagScope(ImGuiAllocTag tag)   { BackupTag = ImGui::DebugSetAllocTag(tag); }
+    ~ImGuiAllocTagScope()                   { ImGui::DebugSetAllocTag(BackupTag); }
+};
+#define IM_ALLOC_TAG_SCOPE(_TAG)            ImGuiAllocTagScope im_alloc_tag_scope(_TAG)
+#else
+#define IM_ALLOC_TAG_SCOPE(_TAG)            ((void)0)
+#endif
+
+// Profiler: record time spent until the end of current scope (see IMGUI_ENABLE_PROFILER in imconfig.h)
+#ifdef IMGUI_ENABLE_PROFILER
+struct ImGuiProfileScope
+{
+    ImGuiProfileScope(const char* name, ImGuiID window_id = 0) { ImGui::ProfileBeginEx(name, window_id); }
+    ~ImGuiProfileScope()                                        { ImGui::ProfileEnd(); }
+};
+#define IM_PROFILE_SCOPE(_NAME)                     ImGuiProfileScope im_profile_scope(_NAME)
+#define IM_PROFILE_SCOPE_WINDOW(_NAME, _WINDOW_ID)  ImGuiProfileScope im_profile_scope(_NAME, _WINDOW_ID)
+#else
+#define IM_PROFILE_SCOPE(_NAME)                     ((void)0)
+#define IM_PROFILE_SCOPE_WINDOW(_NAME, _WINDOW_ID)  ((void)0)
+#endif
+
 
 //-----------------------------------------------------------------------------
 // [SECTION] ImFontLoader
@@ -3708,7 +4009,8 @@ struct ImFontLoader
     bool            (*FontSrcContainsGlyph)(ImFontAtlas* atlas, ImFontConfig* src, ImWchar codepoint);
     bool            (*FontBakedInit)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src);
     void            (*FontBakedDestroy)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src);
-    bool            (*FontBakedLoadGlyph)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x);
+    bool            (*FontBakedLoadGlyph)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x); // With ImFontAtlasFlags_MetricsOnly: output box/advance/Visible without rasterizing, leave PackId invalid.
+    bool            (*FontBakedLoadGlyphs)(ImFontAtlas* atlas, ImFontBaked* baked, ImFontGlyph* glyphs, bool* out_loaded, int glyphs_count); // Optional: load multiple glyphs of sources using this loader at once (e.g. using threads), for ImFontAtlasFlags_DeferGlyphLoading. Input Codepoint+SourceIdx, output as FontBakedLoadGlyph(). Return false to fallback to FontBakedLoadGlyph().
 
     // Size of backend data, Per Baked * Per Source. Buffers are managed by core to avoid excessive allocations.
     // FIXME: At this point the two other types of buffers may be managed by core to be consistent?
@@ -3751,9 +4053,11 @@ inline ImFontAtlasRectId ImFontAtlasRectId_Make(int index_idx, int gen_idx)
 // Having this also makes it easier to e.g. sort rectangles during repack.
 struct ImFontAtlasRectEntry
 {
-    int                 TargetIndex : 20;   // When Used: ImFontAtlasRectId -> into Rects[]. When unused: index to next unused RectsIndex[] slot to consume free-list.
+    int                 TargetIndex : 20;   // When Used: ImFontAtlasRectId -> into Rects[] (or into Pages[PageIndex - 1]->Rects[]). When unused: index to next unused RectsIndex[] slot to consume free-list.
     unsigned int        Generation : 10;    // Increased each time the entry is reused for a new rectangle.
     unsigned int        IsUsed : 1;
+    unsigned int        PageIndex : 5;      // 0 = main texture, >0 = secondary page (see ImFontAtlas::TexMaxPages)
+    unsigned int        IsCustom : 1;       // Created by AddCustomRect()/AddCustomRectFontGlyph(): never evicted.
 };
 
 // Data available to potential texture post-processing functions
@@ -3783,6 +4087,55 @@ typedef stbrp_node stbrp_node_im;
 #endif
 struct stbrp_context_opaque { char data[80]; };
 
+// Glyph waiting to be rasterized (ImFontAtlasFlags_DeferGlyphLoading)
+// We store the BakedId rather than a pointer as ImFontBaked may be moved or discarded in the meanwhile.
+struct ImFontAtlasDeferredGlyph
+{
+    ImGuiID                     BakedId;
+    unsigned int                Codepoint;
+};
+
+// Prebaked glyphs (ImFontConfig::PrebakedData), decompressed and indexed once per atlas.
+// Bakes of sizes which are not prebaked only look at Sizes[], without decompressing nor parsing the data again.
+struct ImFontAtlasPrebakedSize
+{
+    float                       Size;
+    unsigned int                GlyphsCount;
+    unsigned int                GlyphsOffset;           // Offset of first glyph within data
+};
+
+struct ImFontAtlasPrebakedData
+{
+    const void*                 SrcData;                // ImFontConfig::PrebakedData this was made from
+    int                         SrcDataSize;
+    ImVector<unsigned char>     DecompressedData;       // When SrcData is compressed with 'binary_to_compressed_c -lz4'
+    unsigned int                FontDataSize;           // Size of TTF/OTF data the glyphs were made from
+    unsigned int                FontDataKey;            // adler32 of first 4 KB of TTF/OTF data
+    char                        LoaderName[16];         // Not zero-terminated when 16 characters long
+    ImVector<ImFontAtlasPrebakedSize> Sizes;            // Empty when data is invalid
+
+    ImFontAtlasPrebakedData()   { SrcData = NULL; SrcDataSize = 0; FontDataSize = FontDataKey = 0; memset(LoaderName, 0, sizeof(LoaderName)); }
+    const unsigned char*        GetData() const         { return DecompressedData.Size ? DecompressedData.Data : (const unsigned char*)SrcData; }
+    int                         GetDataSize() const     { return DecompressedData.Size ? DecompressedData.Size : SrcDataSize; }
+};
+
+// Secondary atlas page (ImFontAtlas::TexMaxPages > 1)
+// When the main texture cannot grow anymore, glyphs are packed into additional textures of the same size.
+// Pages only ever store glyphs: custom rectangles and auto-baked ellipsis always stay in the main texture, fallback glyphs too unless it is full.
+// Page textures are never resized or repacked: a page is recycled as a whole once its glyphs are all discarded, or evicted when least recently used.
+// Glyphs of SDF bakes (ImFontBaked::IsSdf) are always stored in their own pages (Tex->UseSdf == true), which don't count toward TexMaxPages.
+struct ImFontAtlasPage
+{
+    ImTextureData*              Tex;                    // NULL when the slot is free
+    stbrp_context_opaque        PackContext;
+    ImVector<stbrp_node_im>     PackNodes;
+    ImVector<ImTextureRect>     Rects;                  // Indexed by ImFontAtlasRectEntry::TargetIndex. Discarded rectangles are left in place until the page is freed.
+    int                         RectsCount;             // Number of rectangles in use
+    int                         LastUsedFrame;          // Last frame any glyph from this page was drawn or added
+
+    ImFontAtlasPage()           { memset((void*)this, 0, sizeof(*this)); }
+};
+
 // Internal storage for incrementally packing and building a ImFontAtlas
 struct ImFontAtlasBuilder
 {
@@ -3800,6 +4153,8 @@ struct ImFontAtlasBuilder
     ImVec2i                     MaxRectSize;            // Largest rectangle to pack (de-facto used as a "minimum texture size")
     ImVec2i                     MaxRectBounds;          // Bottom-right most used pixels
     bool                        LockDisableResize;      // Disable resizing texture
+    bool                        LockDisablePages;       // Disable packing into secondary pages (e.g. custom rectangles, ellipsis)
+    bool                        LockPreferMainTexture;  // Only pack into secondary pages when main texture is full and can't be repacked (e.g. fallback glyphs)
     bool                        PreloadedAllGlyphsRanges; // Set when missing ImGuiBackendFlags_RendererHasTextures features forces atlas to preload everything.
 
     // Cache of all ImFontBaked
@@ -3807,6 +4162,37 @@ struct ImFontAtlasBuilder
     ImGuiStorage                BakedMap;               // BakedId --> ImFontBaked*
     int                         BakedDiscardedCount;
 
+    // Deferred glyph loading (ImFontAtlasFlags_DeferGlyphLoading)
+    ImVector<ImFontAtlasDeferredGlyph> DeferredGlyphs;  // FIFO of placeholder glyphs waiting to be rasterized
+    int                         DeferredGlyphsHead;     // Index of first DeferredGlyphs[] entry not yet processed
+    int                         DeferredGlyphsLoadedTotal; // Statistics
+
+    // Secondary pages (ImFontAtlas::TexMaxPages)
+    ImVector<ImFontAtlasPage*>  Pages;                  // Page N (N > 0) is stored in Pages[N - 1]. Slots are reused but never removed.
+    int                         PagesEvictedTotal;      // Statistics
+
+    // Glyph eviction (ImFontAtlas::TexMemoryTarget, page eviction)
+    int                         GlyphsEvictedCount;     // Number of dead ImFontBaked::Glyphs[] entries left by eviction, compacted on next ImFontAtlasUpdateNewFrame()
+    int                         GlyphsEvictedTotal;     // Statistics
+    int                         GlyphsEvictNextFrame;   // Throttle eviction passes
+
+    // Incremental defragmentation of the main texture (ImFontAtlasPackDefrag())
+    ImVector<ImTextureRect>     FreeRects;              // Space left by discarded rectangles (padding included), always below the packer skyline. Reused by ImFontAtlasPackAddRect().
+    bool                        DefragWanted;           // Set when a free rectangle is added, cleared when a defragmentation step cannot move anything.
+    int                         DefragMovesTotal;       // Statistics
+
+    // Per-frame bake budget (ImFontAtlas::BakeBudgetGlyphs, ImFontAtlas::BakeBudgetMicroseconds)
+    int                         FrameBakeGlyphs;        // Glyphs rasterized during current frame
+    int                         FrameBakeMicroseconds;  // Time spent rasterizing glyphs during current frame
+    ImVector<ImGuiID>           FrameBakesDeferred;     // BakedId of sizes substituted by their closest existing bake during current frame
+    int                         LastFrameBakeGlyphs;    // Statistics for previous frame
+    int                         LastFrameBakeMicroseconds;
+    int                         LastFrameBakesDeferred;
+    int                         BakesDeferredTotal;     // Statistics
+
+    // Prebaked glyphs (ImFontConfig::PrebakedData)
+    ImVector<ImFontAtlasPrebakedData*> PrebakedData;    // One entry per distinct PrebakedData pointer, created on first use
+
     // Custom rectangle identifiers
     ImFontAtlasRectId           PackIdMouseCursors;     // White pixel + mouse cursors. Also happen to be fallback in case of packing failure.
     ImFontAtlasRectId           PackIdLinesTexData;
@@ -3828,11 +4214,14 @@ IMGUI_API void              ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w,
 IMGUI_API void              ImFontAtlasTextureGrow(ImFontAtlas* atlas, int old_w = -1, int old_h = -1);
 IMGUI_API void              ImFontAtlasTextureCompact(ImFontAtlas* atlas);
 IMGUI_API ImVec2i           ImFontAtlasTextureGetSizeEstimate(ImFontAtlas* atlas);
+IMGUI_API int               ImFontAtlasTextureGetMemoryUsage(ImFontAtlas* atlas); // Main texture + secondary pages, in bytes
 
 IMGUI_API void              ImFontAtlasBuildSetupFontSpecialGlyphs(ImFontAtlas* atlas, ImFont* font, ImFontConfig* src);
 IMGUI_API void              ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas); // Legacy
 IMGUI_API void              ImFontAtlasBuildGetOversampleFactors(ImFontConfig* src, ImFontBaked* baked, int* out_oversample_h, int* out_oversample_v);
+IMGUI_API bool              ImFontAtlasBuildAcceptCodepointForSource(ImFontConfig* src, ImWchar codepoint); // Check ImFontConfig::GlyphExcludeRanges
 IMGUI_API void              ImFontAtlasBuildDiscardBakes(ImFontAtlas* atlas, int unused_frames);
+IMGUI_API void              ImFontAtlasBuildLoadDeferredGlyphs(ImFontAtlas* atlas, int max_count); // max_count < 0: load all
 
 IMGUI_API bool              ImFontAtlasFontSourceInit(ImFontAtlas* atlas, ImFontConfig* src);
 IMGUI_API void              ImFontAtlasFontSourceAddToFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* src);
@@ -3844,7 +4233,8 @@ IMGUI_API void              ImFontAtlasFontDiscardBakes(ImFontAtlas* atlas, ImFo
 IMGUI_API ImGuiID           ImFontAtlasBakedGetId(ImGuiID font_id, float baked_size, float rasterizer_density);
 IMGUI_API ImFontBaked*      ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density);
 IMGUI_API ImFontBaked*      ImFontAtlasBakedGetClosestMatch(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density);
-IMGUI_API ImFontBaked*      ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id);
+IMGUI_API ImFontBaked*      ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id, bool is_sdf = false);
+IMGUI_API float             ImFontAtlasBakedGetSdfSize(ImFontAtlas* atlas, ImFont* font, float font_size); // Return size of the SDF bake serving 'font_size', or 0.0f if not using SDF for that size
 IMGUI_API void              ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked);
 IMGUI_API ImFontGlyph*      ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, const ImFontGlyph* in_glyph);
 IMGUI_API void              ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImWchar codepoint, float advance_x);
@@ -3853,9 +4243,18 @@ IMGUI_API void              ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atla
 
 IMGUI_API void              ImFontAtlasPackInit(ImFontAtlas* atlas);
 IMGUI_API ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry = NULL);
+IMGUI_API ImFontAtlasRectId ImFontAtlasPackAddSdfRect(ImFontAtlas* atlas, int w, int h); // Pack into a ImTextureData::UseSdf page (for ImFontBaked::IsSdf glyphs)
 IMGUI_API ImTextureRect*    ImFontAtlasPackGetRect(ImFontAtlas* atlas, ImFontAtlasRectId id);
 IMGUI_API ImTextureRect*    ImFontAtlasPackGetRectSafe(ImFontAtlas* atlas, ImFontAtlasRectId id);
 IMGUI_API void              ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id);
+IMGUI_API void              ImFontAtlasPackDefrag(ImFontAtlas* atlas, int max_moves);
+IMGUI_API int               ImFontAtlasPackGetRectPage(ImFontAtlas* atlas, ImFontAtlasRectId id);
+IMGUI_API ImTextureData*    ImFontAtlasPageGetTexture(ImFontAtlas* atlas, int page_n);
+IMGUI_API void              ImFontAtlasPageDiscard(ImFontAtlas* atlas, int page_n);  // Discard all glyphs stored in a secondary page and release its texture
+IMGUI_API void              ImFontAtlasPagesUpdateNewFrame(ImFontAtlas* atlas);     // Release empty pages
+IMGUI_API void              ImFontAtlasBuildEvictGlyph(ImFontAtlas* atlas, ImFontBaked* baked, int glyph_idx); // Free glyph texture space. Glyph is reloaded on next use.
+IMGUI_API void              ImFontAtlasBuildEvictUnusedGlyphs(ImFontAtlas* atlas); // Evict least recently used glyphs when over ImFontAtlas::TexMemoryTarget
+IMGUI_API void              ImFontAtlasBuildCompactEvictedGlyphs(ImFontAtlas* atlas);
 
 IMGUI_API void              ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool renderer_has_textures);
 IMGUI_API void              ImFontAtlasAddDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* data);
@@ -3863,6 +4262,18 @@ IMGUI_API void              ImFontAtlasRemoveDrawListSharedData(ImFontAtlas* atl
 IMGUI_API void              ImFontAtlasUpdateDrawListsTextures(ImFontAtlas* atlas, ImTextureRef old_tex, ImTextureRef new_tex);
 IMGUI_API void              ImFontAtlasUpdateDrawListsSharedData(ImFontAtlas* atlas);
 
+IMGUI_API void              ImFontAtlasTextureRowAlpha8ToRGBA32(const ImU8* src, ImU32* dst, int w);
+IMGUI_API void              ImFontAtlasTextureRowRGBA32ToAlpha8(const ImU32* src, ImU8* dst, int w);
+IMGUI_API void              ImFontAtlasTextureRowMultiplyAlpha8(ImU8* p, int w, float multiply_factor);
+IMGUI_API void              ImFontAtlasTextureRowMultiplyRGBA32(ImU32* p, int w, float multiply_factor);
+IMGUI_API void              ImFontAtlasTextureRowFillRGBA32(ImU32* p, int w, ImU32 col);
+IMGUI_API void              ImFontAtlasTextureRowPremulBGRA32ToRGBA32(const ImU8* src, ImU32* dst, int w); // Pre-multiplied BGRA (FreeType color glyphs) to straight alpha
+IMGUI_API void              ImFontAtlasTextureRowAlpha8ToRGBA32Scalar(const ImU8* src, ImU32* dst, int w);  // Reference versions of the kernels above, without SIMD
+IMGUI_API void              ImFontAtlasTextureRowRGBA32ToAlpha8Scalar(const ImU32* src, ImU8* dst, int w);
+IMGUI_API void              ImFontAtlasTextureRowMultiplyAlpha8Scalar(ImU8* p, int w, float multiply_factor);
+IMGUI_API void              ImFontAtlasTextureRowMultiplyRGBA32Scalar(ImU32* p, int w, float multiply_factor);
+IMGUI_API void              ImFontAtlasTextureRowFillRGBA32Scalar(ImU32* p, int w, ImU32 col);
+IMGUI_API void              ImFontAtlasTextureRowPremulBGRA32ToRGBA32Scalar(const ImU8* src, ImU32* dst, int w);
 IMGUI_API void              ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h);
 IMGUI_API void              ImFontAtlasTextureBlockPostProcess(ImFontAtlasPostProcessData* data);
 IMGUI_API void              ImFontAtlasTextureBlockPostProcessMultiply(ImFontAtlasPostProcessData* data, float multiply_factor);
@@ -4324,13 +4324,12 @@ void ImGui::PushPasswordFont()
 {
     ImGuiContext& g = *GImGui;
     ImFontBaked* backup = &g.InputTextPasswordFontBackupBaked;
-    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0);
+    IM_ASSERT(backup->IndexPages.Size == 0);
     ImFontGlyph* glyph = g.FontBaked->FindGlyph('*');
     g.InputTextPasswordFontBackupFlags = g.Font->Flags;
     backup->FallbackGlyphIndex = g.FontBaked->FallbackGlyphIndex;
     backup->FallbackAdvanceX = g.FontBaked->FallbackAdvanceX;
-    backup->IndexLookup.swap(g.FontBaked->IndexLookup);
-    backup->IndexAdvanceX.swap(g.FontBaked->IndexAdvanceX);
+    backup->IndexPages.swap(g.FontBaked->IndexPages);
     g.Font->Flags |= ImFontFlags_NoLoadGlyphs;
     g.FontBaked->FallbackGlyphIndex = g.FontBaked->Glyphs.index_from_ptr(glyph);
     g.FontBaked->FallbackAdvanceX = glyph->AdvanceX;
@@ -4343,9 +4342,8 @@ void ImGui::PopPasswordFont()
     g.Font->Flags = g.InputTextPasswordFontBackupFlags;
     g.FontBaked->FallbackGlyphIndex = backup->FallbackGlyphIndex;
     g.FontBaked->FallbackAdvanceX = backup->FallbackAdvanceX;
-    g.FontBaked->IndexLookup.swap(backup->IndexLookup);
-    g.FontBaked->IndexAdvanceX.swap(backup->IndexAdvanceX);
-    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0);
+    g.FontBaked->IndexPages.swap(backup->IndexPages);
+    IM_ASSERT(backup->IndexPages.Size == 0);
 }
 
 // Return false to discard a character.
@@ -4516,6 +4514,7 @@ void ImGui::InputTextDeactivateHook(ImGuiID id)
 //  doing UTF8 > U16 > UTF8 conversions on the go to easily interface with stb_textedit. Ideally should stay in UTF-8 all the time. See https://github.com/nothings/stb/issues/188)
 bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* callback_user_data)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Text);
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
@@ -5015,10 +5014,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         {
             if (const char* clipboard = GetClipboardText())
             {
-                // Filter pasted buffer
+                // Filter pasted buffer (filter may change characters, each of them taking up to 4 bytes in UTF-8)
                 const int clipboard_len = (int)ImStrlen(clipboard);
-                ImVector<char> clipboard_filtered;
-                clipboard_filtered.reserve(clipboard_len + 1);
+                char* clipboard_filtered = g.FrameArena.AllocArray<char>(clipboard_len * 4 + 1);
+                int clipboard_filtered_len = 0;
                 for (const char* s = clipboard; *s != 0; )
                 {
                     unsigned int c;
@@ -5026,16 +5025,12 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     s += in_len;
                     if (!InputTextFilterCharacter(&g, &c, flags, callback, callback_user_data, true))
                         continue;
-                    char c_utf8[5];
-                    ImTextCharToUtf8(c_utf8, c);
-                    int out_len = (int)ImStrlen(c_utf8);
-                    clipboard_filtered.resize(clipboard_filtered.Size + out_len);
-                    memcpy(clipboard_filtered.Data + clipboard_filtered.Size - out_len, c_utf8, out_len);
+                    clipboard_filtered_len += ImTextCharToUtf8(clipboard_filtered + clipboard_filtered_len, c);
                 }
-                if (clipboard_filtered.Size > 0) // If everything was filtered, ignore the pasting operation
+                if (clipboard_filtered_len > 0) // If everything was filtered, ignore the pasting operation
                 {
-                    clipboard_filtered.push_back(0);
-                    stb_textedit_paste(state, state->Stb, clipboard_filtered.Data, clipboard_filtered.Size - 1);
+                    clipboard_filtered[clipboard_filtered_len] = 0;
+                    stb_textedit_paste(state, state->Stb, clipboard_filtered, clipboard_filtered_len);
                     state->CursorFollow = true;
                 }
             }
@@ -7,6 +7,11 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026/10/19: rasterize batches of deferred glyphs (ImFontAtlasFlags_DeferGlyphLoading) using the ImGuiFreeType::PreloadGlyphs() worker threads.
+//  2026/10/19: added support for ImFontAtlasFlags_MetricsOnly: compute glyph boxes without rendering glyphs.
+//  2026/10/19: use shared SSE2 row kernels when converting grayscale and color glyphs to RGBA.
+//  2026/10/19: added ImGuiFreeType::PreloadGlyphs() to rasterize large sets of glyphs (e.g. CJK, emoji) using multiple threads.
+//  2026/10/19: added support for ImFontConfig::SdfBakeSize, rendering signed distance fields with FT_RENDER_MODE_SDF (requires FreeType 2.11+).
 //  2025/06/11: refactored for the new ImFontLoader architecture, and ImGuiBackendFlags_RendererHasTextures support.
 //  2024/10/17: added plutosvg support for SVG Fonts (seems faster/better than lunasvg). Enable by using '#define IMGUI_ENABLE_FREETYPE_PLUTOSVG'. (#7927)
 //  2023/11/13: added support for ImFontConfig::RasterizationDensity field for scaling render density without scaling metrics.
@@ -42,10 +47,14 @@
 #include "imgui_freetype.h"
 #include "imgui_internal.h"     // ImMin,ImMax,ImFontAtlasBuild*,
 #include <stdint.h>
+#ifndef IMGUI_DISABLE_FREETYPE_THREADS
+#include <thread>               // std::thread for ImGuiFreeType::PreloadGlyphs() and deferred glyphs
+#endif
 #include <ft2build.h>
 #include FT_FREETYPE_H          // <freetype/freetype.h>
 #include FT_MODULE_H            // <freetype/ftmodapi.h>
 #include FT_GLYPH_H             // <freetype/ftglyph.h>
+#include FT_OUTLINE_H           // <freetype/ftoutln.h>
 #include FT_SIZES_H             // <freetype/ftsizes.h>
 #include FT_SYNTHESIS_H         // <freetype/ftsynth.h>
 
@@ -95,6 +104,17 @@ static void* (*GImGuiFreeTypeAllocFunc)(size_t size, void* user_data) = ImGuiFre
 static void  (*GImGuiFreeTypeFreeFunc)(void* ptr, void* user_data) = ImGuiFreeTypeDefaultFreeFunc;
 static void* GImGuiFreeTypeAllocatorUserData = nullptr;
 
+// Worker threads used for ImFontAtlasFlags_DeferGlyphLoading (see SetDeferredGlyphsThreadsCount())
+static int   GImGuiFreeTypeDeferredThreadsCount = 0;
+
+// Allocators used by worker threads (see ImGuiFreeType::PreloadGlyphs()), stored in FT_MemoryRec_::user.
+struct ImGui_ImplFreeType_Allocator
+{
+    void*   (*AllocFunc)(size_t size, void* user_data);
+    void    (*FreeFunc)(void* ptr, void* user_data);
+    void*   UserData;
+};
+
 // Lunasvg support
 #ifdef IMGUI_ENABLE_FREETYPE_LUNASVG
 static FT_Error ImGuiLunasvgPortInit(FT_Pointer* state);
@@ -272,9 +292,7 @@ static void ImGui_ImplFreeType_BlitGlyph(const FT_Bitmap* ft_bitmap, uint32_t* d
     {
     case FT_PIXEL_MODE_GRAY: // Grayscale image, 1 byte per pixel.
         {
-            for (uint32_t y = 0; y < h; y++, src += src_pitch, dst += dst_pitch)
-                for (uint32_t x = 0; x < w; x++)
-                    dst[x] = IM_COL32(255, 255, 255, src[x]);
+            ImFontAtlasTextureBlockConvert(src, ImTextureFormat_Alpha8, (int)src_pitch, (unsigned char*)dst, ImTextureFormat_RGBA32, (int)dst_pitch * 4, (int)w, (int)h);
             break;
         }
     case FT_PIXEL_MODE_MONO: // Monochrome image, 1 bit per pixel. The bits in each byte are ordered from MSB to LSB.
@@ -294,15 +312,8 @@ static void ImGui_ImplFreeType_BlitGlyph(const FT_Bitmap* ft_bitmap, uint32_t* d
         }
     case FT_PIXEL_MODE_BGRA:
         {
-            // FIXME: Converting pre-multiplied alpha to straight. Doesn't smell good.
-            #define DE_MULTIPLY(color, alpha) ImMin((ImU32)(255.0f * (float)color / (float)(alpha + FLT_MIN) + 0.5f), 255u)
             for (uint32_t y = 0; y < h; y++, src += src_pitch, dst += dst_pitch)
-                for (uint32_t x = 0; x < w; x++)
-                {
-                    uint8_t r = src[x * 4 + 2], g = src[x * 4 + 1], b = src[x * 4], a = src[x * 4 + 3];
-                    dst[x] = IM_COL32(DE_MULTIPLY(r, a), DE_MULTIPLY(g, a), DE_MULTIPLY(b, a), a);
-                }
-            #undef DE_MULTIPLY
+                ImFontAtlasTextureRowPremulBGRA32ToRGBA32(src, dst, (int)w);
             break;
         }
     default:
@@ -311,72 +322,85 @@ static void ImGui_ImplFreeType_BlitGlyph(const FT_Bitmap* ft_bitmap, uint32_t* d
 }
 
 // FreeType memory allocation callbacks
-static void* FreeType_Alloc(FT_Memory /*memory*/, long size)
+static void* FreeType_Alloc(FT_Memory memory, long size)
 {
+    if (ImGui_ImplFreeType_Allocator* allocator = (ImGui_ImplFreeType_Allocator*)memory->user)
+        return allocator->AllocFunc((size_t)size, allocator->UserData);
     return GImGuiFreeTypeAllocFunc((size_t)size, GImGuiFreeTypeAllocatorUserData);
 }
 
-static void FreeType_Free(FT_Memory /*memory*/, void* block)
+static void FreeType_Free(FT_Memory memory, void* block)
 {
-    GImGuiFreeTypeFreeFunc(block, GImGuiFreeTypeAllocatorUserData);
+    if (ImGui_ImplFreeType_Allocator* allocator = (ImGui_ImplFreeType_Allocator*)memory->user)
+        allocator->FreeFunc(block, allocator->UserData);
+    else
+        GImGuiFreeTypeFreeFunc(block, GImGuiFreeTypeAllocatorUserData);
 }
 
-static void* FreeType_Realloc(FT_Memory /*memory*/, long cur_size, long new_size, void* block)
+static void* FreeType_Realloc(FT_Memory memory, long cur_size, long new_size, void* block)
 {
     // Implement realloc() as we don't ask user to provide it.
     if (block == nullptr)
-        return GImGuiFreeTypeAllocFunc((size_t)new_size, GImGuiFreeTypeAllocatorUserData);
+        return FreeType_Alloc(memory, new_size);
 
     if (new_size == 0)
     {
-        GImGuiFreeTypeFreeFunc(block, GImGuiFreeTypeAllocatorUserData);
+        FreeType_Free(memory, block);
         return nullptr;
     }
 
     if (new_size > cur_size)
     {
-        void* new_block = GImGuiFreeTypeAllocFunc((size_t)new_size, GImGuiFreeTypeAllocatorUserData);
+        void* new_block = FreeType_Alloc(memory, new_size);
         memcpy(new_block, block, (size_t)cur_size);
-        GImGuiFreeTypeFreeFunc(block, GImGuiFreeTypeAllocatorUserData);
+        FreeType_Free(memory, block);
         return new_block;
     }
 
     return block;
 }
 
-static bool ImGui_ImplFreeType_LoaderInit(ImFontAtlas* atlas)
+// Create a FreeType library instance using our allocators (or 'allocator' if not null).
+// Also used by worker threads in ImGuiFreeType::PreloadGlyphs(), as a FT_Library cannot be shared between threads creating faces.
+static bool ImGui_ImplFreeType_NewLibrary(FT_MemoryRec_* memory_manager, ImGui_ImplFreeType_Allocator* allocator, FT_Library* out_library)
 {
-    IM_ASSERT(atlas->FontLoaderData == nullptr);
-    ImGui_ImplFreeType_Data* bd = IM_NEW(ImGui_ImplFreeType_Data)();
-
     // FreeType memory management: https://www.freetype.org/freetype2/docs/design/design-4.html
-    bd->MemoryManager.user = nullptr;
-    bd->MemoryManager.alloc = &FreeType_Alloc;
-    bd->MemoryManager.free = &FreeType_Free;
-    bd->MemoryManager.realloc = &FreeType_Realloc;
+    memory_manager->user = allocator;
+    memory_manager->alloc = &FreeType_Alloc;
+    memory_manager->free = &FreeType_Free;
+    memory_manager->realloc = &FreeType_Realloc;
 
     // https://www.freetype.org/freetype2/docs/reference/ft2-module_management.html#FT_New_Library
-    FT_Error error = FT_New_Library(&bd->MemoryManager, &bd->Library);
+    FT_Error error = FT_New_Library(memory_manager, out_library);
     if (error != 0)
-    {
-        IM_DELETE(bd);
         return false;
-    }
 
     // If you don't call FT_Add_Default_Modules() the rest of code may work, but FreeType won't use our custom allocator.
-    FT_Add_Default_Modules(bd->Library);
+    FT_Add_Default_Modules(*out_library);
 
 #ifdef IMGUI_ENABLE_FREETYPE_LUNASVG
     // Install svg hooks for FreeType
     // https://freetype.org/freetype2/docs/reference/ft2-properties.html#svg-hooks
     // https://freetype.org/freetype2/docs/reference/ft2-svg_fonts.html#svg_fonts
     SVG_RendererHooks hooks = { ImGuiLunasvgPortInit, ImGuiLunasvgPortFree, ImGuiLunasvgPortRender, ImGuiLunasvgPortPresetSlot };
-    FT_Property_Set(bd->Library, "ot-svg", "svg-hooks", &hooks);
+    FT_Property_Set(*out_library, "ot-svg", "svg-hooks", &hooks);
 #endif // IMGUI_ENABLE_FREETYPE_LUNASVG
 #ifdef IMGUI_ENABLE_FREETYPE_PLUTOSVG
     // With plutosvg, use provided hooks
-    FT_Property_Set(bd->Library, "ot-svg", "svg-hooks", plutosvg_ft_svg_hooks());
+    FT_Property_Set(*out_library, "ot-svg", "svg-hooks", plutosvg_ft_svg_hooks());
 #endif // IMGUI_ENABLE_FREETYPE_PLUTOSVG
+    return true;
+}
+
+static bool ImGui_ImplFreeType_LoaderInit(ImFontAtlas* atlas)
+{
+    IM_ASSERT(atlas->FontLoaderData == nullptr);
+    ImGui_ImplFreeType_Data* bd = IM_NEW(ImGui_ImplFreeType_Data)();
+    if (!ImGui_ImplFreeType_NewLibrary(&bd->MemoryManager, nullptr, &bd->Library))
+    {
+        IM_DELETE(bd);
+        return false;
+    }
 
     // Store our data
     atlas->FontLoaderData = (void*)bd;
@@ -418,43 +442,48 @@ static void ImGui_ImplFreeType_FontSrcDestroy(ImFontAtlas* atlas, ImFontConfig*
     src->FontLoaderData = nullptr;
 }
 
-static bool ImGui_ImplFreeType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src)
+// Set size of currently active FT_Size of 'face' for given baked size.
+static void ImGui_ImplFreeType_RequestSize(FT_Face face, ImFontConfig* src, ImFontBaked* baked, ImGuiFreeTypeLoaderFlags user_flags)
 {
-    IM_UNUSED(atlas);
     float size = baked->Size;
     if (src->MergeMode && src->SizePixels != 0.0f)
         size *= (src->SizePixels / baked->ContainerFont->Sources[0]->SizePixels);
 
-    ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
-    bd_font_data->BakedLastActivated = baked;
-
-    // We use one FT_Size per (source + baked) combination.
-    ImGui_ImplFreeType_FontSrcBakedData* bd_baked_data = (ImGui_ImplFreeType_FontSrcBakedData*)loader_data_for_baked_src;
-    IM_ASSERT(bd_baked_data != nullptr);
-    IM_PLACEMENT_NEW(bd_baked_data) ImGui_ImplFreeType_FontSrcBakedData();
-
-    FT_New_Size(bd_font_data->FtFace, &bd_baked_data->FtSize);
-    FT_Activate_Size(bd_baked_data->FtSize);
-
     // Vuhdo 2017: "I'm not sure how to deal with font sizes properly. As far as I understand, currently ImGui assumes that the 'pixel_height'
     // is a maximum height of an any given glyph, i.e. it's the sum of font's ascender and descender. Seems strange to me.
     // FT_Set_Pixel_Sizes() doesn't seem to get us the same result."
     // (FT_Set_Pixel_Sizes() essentially calls FT_Request_Size() with FT_SIZE_REQUEST_TYPE_NOMINAL)
     const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
     FT_Size_RequestRec req;
-    req.type = (bd_font_data->UserFlags & ImGuiFreeTypeLoaderFlags_Bitmap) ? FT_SIZE_REQUEST_TYPE_NOMINAL : FT_SIZE_REQUEST_TYPE_REAL_DIM;
+    req.type = (user_flags & ImGuiFreeTypeLoaderFlags_Bitmap) ? FT_SIZE_REQUEST_TYPE_NOMINAL : FT_SIZE_REQUEST_TYPE_REAL_DIM;
     req.width = 0;
     req.height = (uint32_t)(size * 64 * rasterizer_density);
     req.horiResolution = 0;
     req.vertResolution = 0;
-    FT_Request_Size(bd_font_data->FtFace, &req);
+    FT_Request_Size(face, &req);
+}
+
+static bool ImGui_ImplFreeType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src)
+{
+    IM_UNUSED(atlas);
+    ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
+    bd_font_data->BakedLastActivated = baked;
+
+    // We use one FT_Size per (source + baked) combination.
+    ImGui_ImplFreeType_FontSrcBakedData* bd_baked_data = (ImGui_ImplFreeType_FontSrcBakedData*)loader_data_for_baked_src;
+    IM_ASSERT(bd_baked_data != nullptr);
+    IM_PLACEMENT_NEW(bd_baked_data) ImGui_ImplFreeType_FontSrcBakedData();
+
+    FT_New_Size(bd_font_data->FtFace, &bd_baked_data->FtSize);
+    FT_Activate_Size(bd_baked_data->FtSize);
+    ImGui_ImplFreeType_RequestSize(bd_font_data->FtFace, src, baked, bd_font_data->UserFlags);
 
     // Output
     if (src->MergeMode == false)
     {
         // Read metrics
         FT_Size_Metrics metrics = bd_baked_data->FtSize->metrics;
-        const float scale = 1.0f / rasterizer_density;
+        const float scale = 1.0f / (src->RasterizerDensity * baked->RasterizerDensity);
         baked->Ascent     = (float)FT_CEIL(metrics.ascender) * scale;       // The pixel extents above the baseline in pixels (typically positive).
         baked->Descent    = (float)FT_CEIL(metrics.descender) * scale;      // The extents below the baseline in pixels (typically negative).
         //LineSpacing     = (float)FT_CEIL(metrics.height) * scale;         // The baseline-to-baseline distance. Note that it usually is larger than the sum of the ascender and descender taken as absolute values. There is also no guarantee that no glyphs extend above or below subsequent baselines when using this distance. Think of it as a value the designer of the font finds appropriate.
@@ -475,6 +504,130 @@ static void ImGui_ImplFreeType_FontBakedDestroy(ImFontAtlas* atlas, ImFontConfig
     bd_baked_data->~ImGui_ImplFreeType_FontSrcBakedData(); // ~IM_PLACEMENT_DELETE()
 }
 
+static FT_Render_Mode ImGui_ImplFreeType_GetRenderMode(FT_Library library, ImGui_ImplFreeType_FontSrcData* src_data, ImFontBaked* baked, FT_GlyphSlot slot)
+{
+    FT_Render_Mode render_mode = (src_data->UserFlags & ImGuiFreeTypeLoaderFlags_Monochrome) ? FT_RENDER_MODE_MONO : FT_RENDER_MODE_NORMAL;
+#if ((FREETYPE_MAJOR >= 2) && (FREETYPE_MINOR >= 11))
+    // Signed distance field (ImFontConfig::SdfBakeSize). Output has 'spread' pixels of padding around the glyph and the edge at 128.
+    if (baked->IsSdf && slot->format == FT_GLYPH_FORMAT_OUTLINE)
+    {
+        FT_Int spread = ImMax((FT_Int)baked->ContainerFont->Sources[0]->SdfSpread, (FT_Int)2); // FreeType requires 2..32
+        FT_Bool overlaps = 1; // Handle overlapping contours, e.g. our default font is made of overlapping squares. Otherwise distances inside glyphs are wrong.
+        FT_Property_Set(library, "sdf", "spread", &spread);
+        FT_Property_Set(library, "sdf", "overlaps", &overlaps);
+        render_mode = FT_RENDER_MODE_SDF;
+    }
+#else
+    IM_UNUSED(library);
+    IM_UNUSED(baked);
+    IM_UNUSED(slot);
+#endif
+    return render_mode;
+}
+
+// Compute the bitmap box FT_Render_Glyph() would output, without rendering (for ImFontAtlasFlags_MetricsOnly).
+// Same rounding as ft_glyphslot_preset_bitmap() used by FreeType 2.10+ rasterizers. Return false if the glyph needs to be rendered (e.g. SVG).
+static bool ImGui_ImplFreeType_GetGlyphBitmapBox(FT_GlyphSlot slot, FT_Render_Mode render_mode, ImFontBaked* baked, int* out_w, int* out_h, int* out_left, int* out_top)
+{
+    if (slot->format == FT_GLYPH_FORMAT_BITMAP)
+    {
+        *out_w = (int)slot->bitmap.width;
+        *out_h = (int)slot->bitmap.rows;
+        *out_left = slot->bitmap_left;
+        *out_top = slot->bitmap_top;
+        return true;
+    }
+    if (slot->format != FT_GLYPH_FORMAT_OUTLINE)
+        return false;
+
+    FT_BBox cbox;
+    FT_Outline_Get_CBox(&slot->outline, &cbox);
+    FT_Pos x0 = cbox.xMin >> 6, y0 = cbox.yMin >> 6, x1 = cbox.xMax >> 6, y1 = cbox.yMax >> 6;
+    const FT_Pos rem_x0 = cbox.xMin & 63, rem_y0 = cbox.yMin & 63, rem_x1 = cbox.xMax & 63, rem_y1 = cbox.yMax & 63;
+    if (render_mode == FT_RENDER_MODE_MONO)
+    {
+        // Round so that the center of a pixel is always included, add a pixel if the box collapsed.
+        x0 += (rem_x0 + 31) >> 6;
+        x1 += (rem_x1 + 32) >> 6;
+        if (x0 == x1 && ((rem_x0 + 31) & 63) - 31 + ((rem_x1 + 32) & 63) - 32 < 0)
+            x0--;
+        else if (x0 == x1)
+            x1++;
+        y0 += (rem_y0 + 31) >> 6;
+        y1 += (rem_y1 + 32) >> 6;
+        if (y0 == y1 && ((rem_y0 + 31) & 63) - 31 + ((rem_y1 + 32) & 63) - 32 < 0)
+            y0--;
+        else if (y0 == y1)
+            y1++;
+    }
+    else
+    {
+        x1 += (rem_x1 + 63) >> 6;
+        y1 += (rem_y1 + 63) >> 6;
+    }
+    *out_w = (int)(x1 - x0);
+    *out_h = (int)(y1 - y0);
+    *out_left = (int)x0;
+    *out_top = (int)y1;
+
+#if ((FREETYPE_MAJOR >= 2) && (FREETYPE_MINOR >= 11))
+    // Signed distance field: 'spread' pixels of padding (see ImGui_ImplFreeType_GetRenderMode())
+    if (render_mode == FT_RENDER_MODE_SDF && *out_w != 0 && *out_h != 0)
+    {
+        const int spread = ImMax((int)baked->ContainerFont->Sources[0]->SdfSpread, 2);
+        *out_w += spread * 2;
+        *out_h += spread * 2;
+        *out_left -= spread;
+        *out_top += spread;
+    }
+#else
+    IM_UNUSED(baked);
+#endif
+    return true;
+}
+
+// Pack a rendered glyph and copy its pixels into the atlas.
+// In metrics only mode (pixels == NULL), only output the glyph box.
+static bool ImGui_ImplFreeType_PackGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, int w, int h, int bitmap_left, int bitmap_top, const unsigned char* pixels, ImTextureFormat pixels_fmt, ImFontGlyph* out_glyph)
+{
+    ImFontAtlasRectId pack_id = ImFontAtlasRectId_Invalid;
+    if (pixels != nullptr)
+    {
+        pack_id = baked->IsSdf ? ImFontAtlasPackAddSdfRect(atlas, w, h) : ImFontAtlasPackAddRect(atlas, w, h);
+        if (pack_id == ImFontAtlasRectId_Invalid)
+        {
+            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
+            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+            return false;
+        }
+    }
+
+    const float ref_size = baked->ContainerFont->Sources[0]->SizePixels;
+    const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
+    float font_off_x = (src->GlyphOffset.x * offsets_scale);
+    float font_off_y = (src->GlyphOffset.y * offsets_scale) + baked->Ascent;
+    if (src->PixelSnapH) // Snap scaled offset. This is to mitigate backward compatibility issues for GlyphOffset, but a better design would be welcome.
+        font_off_x = IM_ROUND(font_off_x);
+    if (src->PixelSnapV)
+        font_off_y = IM_ROUND(font_off_y);
+    const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
+    float recip_h = 1.0f / rasterizer_density;
+    float recip_v = 1.0f / rasterizer_density;
+
+    // Register glyph
+    float glyph_off_x = (float)bitmap_left;
+    float glyph_off_y = (float)-bitmap_top;
+    out_glyph->X0 = glyph_off_x * recip_h + font_off_x;
+    out_glyph->Y0 = glyph_off_y * recip_v + font_off_y;
+    out_glyph->X1 = (glyph_off_x + w) * recip_h + font_off_x;
+    out_glyph->Y1 = (glyph_off_y + h) * recip_v + font_off_y;
+    out_glyph->Visible = true;
+    out_glyph->PackId = pack_id;
+    if (pixels != nullptr)
+        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, ImFontAtlasPackGetRect(atlas, pack_id), pixels, pixels_fmt, w * ImTextureDataGetFormatBytesPerPixel(pixels_fmt));
+    return true;
+}
+
 static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
 {
     ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
@@ -507,8 +660,21 @@ static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConf
         return true;
     }
 
+    // Metrics only mode (ImFontAtlasFlags_MetricsOnly): output the same box without rendering nor packing
+    ImGui_ImplFreeType_Data* bd = (ImGui_ImplFreeType_Data*)atlas->FontLoaderData;
+    const FT_Render_Mode render_mode = ImGui_ImplFreeType_GetRenderMode(bd->Library, bd_font_data, baked, slot);
+    int box_w, box_h, box_left, box_top;
+    if ((atlas->Flags & ImFontAtlasFlags_MetricsOnly) && ImGui_ImplFreeType_GetGlyphBitmapBox(slot, render_mode, baked, &box_w, &box_h, &box_left, &box_top))
+    {
+        out_glyph->Codepoint = codepoint;
+        out_glyph->AdvanceX = advance_x;
+        out_glyph->Colored = (slot->format == FT_GLYPH_FORMAT_BITMAP && slot->bitmap.pixel_mode == FT_PIXEL_MODE_BGRA);
+        if (box_w != 0 && box_h != 0)
+            return ImGui_ImplFreeType_PackGlyph(atlas, src, baked, box_w, box_h, box_left, box_top, nullptr, ImTextureFormat_RGBA32, out_glyph);
+        return true;
+    }
+
     // Render glyph into a bitmap (currently held by FreeType)
-    FT_Render_Mode render_mode = (bd_font_data->UserFlags & ImGuiFreeTypeLoaderFlags_Monochrome) ? FT_RENDER_MODE_MONO : FT_RENDER_MODE_NORMAL;
     FT_Error error = FT_Render_Glyph(slot, render_mode);
     const FT_Bitmap* ft_bitmap = &slot->bitmap;
     if (error != 0 || ft_bitmap == nullptr)
@@ -525,42 +691,17 @@ static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConf
     // Pack and retrieve position inside texture atlas
     if (is_visible)
     {
-        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
-        if (pack_id == ImFontAtlasRectId_Invalid)
-        {
-            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
-            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
-            return false;
-        }
-        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+        out_glyph->Colored = (ft_bitmap->pixel_mode == FT_PIXEL_MODE_BGRA);
+        if (atlas->Flags & ImFontAtlasFlags_MetricsOnly) // e.g. SVG glyphs which needed rendering to obtain their box
+            return ImGui_ImplFreeType_PackGlyph(atlas, src, baked, w, h, slot->bitmap_left, slot->bitmap_top, nullptr, ImTextureFormat_RGBA32, out_glyph);
 
         // Render pixels to our temporary buffer
         atlas->Builder->TempBuffer.resize(w * h * 4);
         uint32_t* temp_buffer = (uint32_t*)atlas->Builder->TempBuffer.Data;
         ImGui_ImplFreeType_BlitGlyph(ft_bitmap, temp_buffer, w);
 
-        const float ref_size = baked->ContainerFont->Sources[0]->SizePixels;
-        const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
-        float font_off_x = (src->GlyphOffset.x * offsets_scale);
-        float font_off_y = (src->GlyphOffset.y * offsets_scale) + baked->Ascent;
-        if (src->PixelSnapH) // Snap scaled offset. This is to mitigate backward compatibility issues for GlyphOffset, but a better design would be welcome.
-            font_off_x = IM_ROUND(font_off_x);
-        if (src->PixelSnapV)
-            font_off_y = IM_ROUND(font_off_y);
-        float recip_h = 1.0f / rasterizer_density;
-        float recip_v = 1.0f / rasterizer_density;
-
-        // Register glyph
-        float glyph_off_x = (float)face->glyph->bitmap_left;
-        float glyph_off_y = (float)-face->glyph->bitmap_top;
-        out_glyph->X0 = glyph_off_x * recip_h + font_off_x;
-        out_glyph->Y0 = glyph_off_y * recip_v + font_off_y;
-        out_glyph->X1 = (glyph_off_x + w) * recip_h + font_off_x;
-        out_glyph->Y1 = (glyph_off_y + h) * recip_v + font_off_y;
-        out_glyph->Visible = true;
-        out_glyph->Colored = (ft_bitmap->pixel_mode == FT_PIXEL_MODE_BGRA);
-        out_glyph->PackId = pack_id;
-        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, (const unsigned char*)temp_buffer, ImTextureFormat_RGBA32, w * 4);
+        if (!ImGui_ImplFreeType_PackGlyph(atlas, src, baked, w, h, slot->bitmap_left, slot->bitmap_top, (const unsigned char*)temp_buffer, ImTextureFormat_RGBA32, out_glyph))
+            return false;
     }
 
     return true;
@@ -574,6 +715,8 @@ static bool ImGui_ImplFreetype_FontSrcContainsGlyph(ImFontAtlas* atlas, ImFontCo
     return glyph_index != 0;
 }
 
+static bool ImGui_ImplFreeType_FontBakedLoadGlyphs(ImFontAtlas* atlas, ImFontBaked* baked, ImFontGlyph* glyphs, bool* out_loaded, int glyphs_count);
+
 const ImFontLoader* ImGuiFreeType::GetFontLoader()
 {
     static ImFontLoader loader;
@@ -586,6 +729,7 @@ const ImFontLoader* ImGuiFreeType::GetFontLoader()
     loader.FontBakedInit = ImGui_ImplFreeType_FontBakedInit;
     loader.FontBakedDestroy = ImGui_ImplFreeType_FontBakedDestroy;
     loader.FontBakedLoadGlyph = ImGui_ImplFreeType_FontBakedLoadGlyph;
+    loader.FontBakedLoadGlyphs = ImGui_ImplFreeType_FontBakedLoadGlyphs;
     loader.FontBakedSrcLoaderDataSize = sizeof(ImGui_ImplFreeType_FontSrcBakedData);
     return &loader;
 }
@@ -597,6 +741,366 @@ void ImGuiFreeType::SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* u
     GImGuiFreeTypeAllocatorUserData = user_data;
 }
 
+//-------------------------------------------------------------------------
+// Parallel glyph preloading (ImGuiFreeType::PreloadGlyphs(), ImFontAtlasFlags_DeferGlyphLoading)
+//-------------------------------------------------------------------------
+// - Workers each create their own FT_Library and FT_Face instances over the shared ImFontConfig::FontData, and rasterize a slice of the codepoints.
+// - Bitmaps are then packed and copied into the atlas on the calling thread, in codepoint order.
+// - Workers never touch the atlas or the Dear ImGui context. They allocate with the FreeType allocators (see SetAllocatorFunctions()),
+//   or when those are the defaults, with the Dear ImGui allocators bypassing IM_ALLOC() debug hooks. Those need to be thread-safe.
+//-------------------------------------------------------------------------
+
+#define IMGUI_FREETYPE_PRELOAD_MAX_THREADS          16
+#define IMGUI_FREETYPE_PRELOAD_GLYPHS_PER_BATCH     4096    // Bound memory used by bitmaps waiting to be packed
+#define IMGUI_FREETYPE_PRELOAD_MIN_GLYPHS_PER_THREAD 64
+#define IMGUI_FREETYPE_DEFERRED_MIN_GLYPHS_PER_THREAD 16   // Smaller batches of deferred glyphs are loaded with the atlas FT_Face, without opening new ones
+
+struct ImGui_ImplFreeType_PreloadGlyph
+{
+    ImWchar             Codepoint;          // As requested
+    ImWchar             LoaderCodepoint;    // After ImFont::AddRemapChar() remapping
+    int                 SourceIdx;          // Index into ImFont::Sources[]
+    bool                Loaded;             // Output: set by worker if glyph was rendered
+    bool                Colored;
+    ImTextureFormat     Format;             // ImTextureFormat_Alpha8 for grayscale output, ImTextureFormat_RGBA32 otherwise
+    int                 Width, Height;
+    int                 BitmapLeft, BitmapTop;
+    float               AdvanceX;
+    int                 PixelsOffset;       // Offset into ImGui_ImplFreeType_PreloadWorker::Pixels
+};
+
+struct ImGui_ImplFreeType_PreloadWorker
+{
+    ImFontBaked*                        Baked;
+    ImGui_ImplFreeType_Allocator*       Allocator;
+    ImGui_ImplFreeType_PreloadGlyph*    Glyphs;
+    int                                 GlyphsCount;
+    unsigned char*                      Pixels;
+    int                                 PixelsSize;
+    int                                 PixelsCapacity;
+    ImGui_ImplFreeType_PreloadWorker()  { memset((void*)this, 0, sizeof(*this)); }
+    ~ImGui_ImplFreeType_PreloadWorker() { if (Pixels) Allocator->FreeFunc(Pixels, Allocator->UserData); }
+
+    unsigned char* AllocPixels(int size, int* out_offset)
+    {
+        const int offset = (PixelsSize + 3) & ~3; // Keep RGBA32 data aligned
+        if (offset + size > PixelsCapacity)
+        {
+            const int new_capacity = ImMax(PixelsCapacity * 2, offset + size + 64 * 1024);
+            unsigned char* new_pixels = (unsigned char*)Allocator->AllocFunc((size_t)new_capacity, Allocator->UserData);
+            if (Pixels)
+            {
+                memcpy(new_pixels, Pixels, (size_t)PixelsSize);
+                Allocator->FreeFunc(Pixels, Allocator->UserData);
+            }
+            Pixels = new_pixels;
+            PixelsCapacity = new_capacity;
+        }
+        PixelsSize = offset + size;
+        *out_offset = offset;
+        return Pixels + offset;
+    }
+};
+
+static void ImGui_ImplFreeType_PreloadWorkerMain(ImGui_ImplFreeType_PreloadWorker* worker)
+{
+    ImFontBaked* baked = worker->Baked;
+    ImFont* font = baked->ContainerFont;
+    FT_MemoryRec_ memory_manager;
+    FT_Library library;
+    if (!ImGui_ImplFreeType_NewLibrary(&memory_manager, worker->Allocator, &library))
+        return;
+
+    // Faces are opened on first use as most glyphs often come from a single source.
+    const size_t faces_size = sizeof(FT_Face) * (size_t)font->Sources.Size;
+    FT_Face* faces = (FT_Face*)worker->Allocator->AllocFunc(faces_size, worker->Allocator->UserData);
+    memset(faces, 0, faces_size);
+
+    ImGui_ImplFreeType_FontSrcData src_data; // Copy of the source settings, using our face
+    for (int glyph_n = 0; glyph_n < worker->GlyphsCount; glyph_n++)
+    {
+        ImGui_ImplFreeType_PreloadGlyph* glyph = &worker->Glyphs[glyph_n];
+        ImFontConfig* src = font->Sources[glyph->SourceIdx];
+        const ImGui_ImplFreeType_FontSrcData* owner_src_data = (const ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
+        FT_Face* p_face = &faces[glyph->SourceIdx];
+        if (*p_face == nullptr)
+        {
+            if (FT_New_Memory_Face(library, (uint8_t*)src->FontData, (FT_Long)src->FontDataSize, (FT_Long)src->FontNo, p_face) != 0)
+                continue;
+            if (FT_Select_Charmap(*p_face, FT_ENCODING_UNICODE) != 0)
+            {
+                FT_Done_Face(*p_face);
+                *p_face = nullptr;
+                continue;
+            }
+            ImGui_ImplFreeType_RequestSize(*p_face, src, baked, owner_src_data->UserFlags);
+        }
+        src_data.FtFace = *p_face;
+        src_data.UserFlags = owner_src_data->UserFlags;
+        src_data.LoadFlags = owner_src_data->LoadFlags;
+
+        if (ImGui_ImplFreeType_LoadGlyph(&src_data, glyph->LoaderCodepoint) == nullptr)
+            continue;
+        FT_GlyphSlot slot = src_data.FtFace->glyph;
+        if (FT_Render_Glyph(slot, ImGui_ImplFreeType_GetRenderMode(library, &src_data, baked, slot)) != 0)
+            continue;
+        const FT_Bitmap* ft_bitmap = &slot->bitmap;
+        glyph->Loaded = true;
+        glyph->Colored = (ft_bitmap->pixel_mode == FT_PIXEL_MODE_BGRA);
+        glyph->Width = (int)ft_bitmap->width;
+        glyph->Height = (int)ft_bitmap->rows;
+        glyph->BitmapLeft = slot->bitmap_left;
+        glyph->BitmapTop = slot->bitmap_top;
+        glyph->AdvanceX = (slot->advance.x / FT_SCALEFACTOR) / (src->RasterizerDensity * baked->RasterizerDensity);
+        if (glyph->Width == 0 || glyph->Height == 0)
+            continue;
+
+        // Keep grayscale output as Alpha8 to reduce memory held until packing
+        if (ft_bitmap->pixel_mode == FT_PIXEL_MODE_GRAY)
+        {
+            glyph->Format = ImTextureFormat_Alpha8;
+            unsigned char* dst = worker->AllocPixels(glyph->Width * glyph->Height, &glyph->PixelsOffset);
+            for (int y = 0; y < glyph->Height; y++)
+                memcpy(dst + y * glyph->Width, ft_bitmap->buffer + y * ft_bitmap->pitch, (size_t)glyph->Width);
+        }
+        else
+        {
+            glyph->Format = ImTextureFormat_RGBA32;
+            unsigned char* dst = worker->AllocPixels(glyph->Width * glyph->Height * 4, &glyph->PixelsOffset);
+            ImGui_ImplFreeType_BlitGlyph(ft_bitmap, (uint32_t*)(void*)dst, (uint32_t)glyph->Width);
+        }
+    }
+    src_data.FtFace = nullptr; // Closed below
+
+    for (int src_n = 0; src_n < font->Sources.Size; src_n++)
+        if (faces[src_n] != nullptr)
+            FT_Done_Face(faces[src_n]);
+    worker->Allocator->FreeFunc(faces, worker->Allocator->UserData);
+    FT_Done_Library(library);
+}
+
+// Workers use our allocators, or the Dear ImGui allocators without the debug hooks of IM_ALLOC() which are not thread-safe.
+static void ImGui_ImplFreeType_PreloadGetAllocator(ImGui_ImplFreeType_Allocator* out_allocator)
+{
+    out_allocator->AllocFunc = GImGuiFreeTypeAllocFunc;
+    out_allocator->FreeFunc = GImGuiFreeTypeFreeFunc;
+    out_allocator->UserData = GImGuiFreeTypeAllocatorUserData;
+    if (out_allocator->AllocFunc == ImGuiFreeTypeDefaultAllocFunc && out_allocator->FreeFunc == ImGuiFreeTypeDefaultFreeFunc)
+        ImGui::GetAllocatorFunctions(&out_allocator->AllocFunc, &out_allocator->FreeFunc, &out_allocator->UserData);
+}
+
+// Split 'glyphs' into contiguous slices and rasterize them (the calling thread processes the first slice).
+// Output stays in workers[] until they are destructed.
+static void ImGui_ImplFreeType_PreloadRun(ImGui_ImplFreeType_PreloadWorker* workers, int workers_count, ImFontBaked* baked, ImGui_ImplFreeType_Allocator* allocator, ImGui_ImplFreeType_PreloadGlyph* glyphs, int glyphs_count)
+{
+    for (int worker_n = 0; worker_n < workers_count; worker_n++)
+    {
+        const int slice_start = glyphs_count * worker_n / workers_count;
+        const int slice_end = glyphs_count * (worker_n + 1) / workers_count;
+        workers[worker_n].Baked = baked;
+        workers[worker_n].Allocator = allocator;
+        workers[worker_n].Glyphs = &glyphs[slice_start];
+        workers[worker_n].GlyphsCount = slice_end - slice_start;
+    }
+#ifndef IMGUI_DISABLE_FREETYPE_THREADS
+    std::thread threads[IMGUI_FREETYPE_PRELOAD_MAX_THREADS];
+    for (int worker_n = 1; worker_n < workers_count; worker_n++)
+        threads[worker_n] = std::thread(ImGui_ImplFreeType_PreloadWorkerMain, &workers[worker_n]);
+    ImGui_ImplFreeType_PreloadWorkerMain(&workers[0]);
+    for (int worker_n = 1; worker_n < workers_count; worker_n++)
+        threads[worker_n].join();
+#else
+    for (int worker_n = 0; worker_n < workers_count; worker_n++)
+        ImGui_ImplFreeType_PreloadWorkerMain(&workers[worker_n]);
+#endif
+}
+
+// Pack a glyph rasterized by a worker. Output glyph uses the loader codepoint, same as ImGui_ImplFreeType_FontBakedLoadGlyph().
+static bool ImGui_ImplFreeType_PreloadPackGlyph(ImFontAtlas* atlas, ImFontBaked* baked, const ImGui_ImplFreeType_PreloadWorker* worker, const ImGui_ImplFreeType_PreloadGlyph* preload_glyph, ImFontGlyph* out_glyph)
+{
+    ImFontConfig* src = baked->ContainerFont->Sources[preload_glyph->SourceIdx];
+    out_glyph->Codepoint = preload_glyph->LoaderCodepoint;
+    out_glyph->AdvanceX = preload_glyph->AdvanceX;
+    if (preload_glyph->Width == 0 || preload_glyph->Height == 0)
+        return true;
+    out_glyph->Colored = preload_glyph->Colored;
+    return ImGui_ImplFreeType_PackGlyph(atlas, src, baked, preload_glyph->Width, preload_glyph->Height, preload_glyph->BitmapLeft, preload_glyph->BitmapTop, worker->Pixels + preload_glyph->PixelsOffset, preload_glyph->Format, out_glyph);
+}
+
+// Return index of the source providing 'codepoint', or -1 if not provided or if it may be provided by a source not using this loader.
+static int ImGui_ImplFreeType_PreloadFindSource(ImFontAtlas* atlas, ImFont* font, ImWchar codepoint)
+{
+    for (int src_n = 0; src_n < font->Sources.Size; src_n++)
+    {
+        ImFontConfig* src = font->Sources[src_n];
+        if (src->GlyphExcludeRanges && !ImFontAtlasBuildAcceptCodepointForSource(src, codepoint))
+            continue;
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        if (loader->FontBakedLoadGlyph != ImGui_ImplFreeType_FontBakedLoadGlyph)
+        {
+            if (loader->FontSrcContainsGlyph == nullptr || loader->FontSrcContainsGlyph(atlas, src, codepoint))
+                return -1;
+            continue;
+        }
+        ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
+        if (FT_Get_Char_Index(bd_font_data->FtFace, codepoint) != 0)
+            return src_n;
+    }
+    return -1;
+}
+
+static void ImGui_ImplFreeType_PreloadAddRange(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked, const ImWchar* ranges, ImVector<ImGui_ImplFreeType_PreloadGlyph>* out_glyphs)
+{
+    for (; ranges[0]; ranges += 2)
+        for (unsigned int c = ranges[0]; c <= ranges[1] && c <= IM_UNICODE_CODEPOINT_MAX; c++) //-V560
+        {
+            ImWchar codepoint = (ImWchar)c;
+            if (baked->IsGlyphLoaded(codepoint) || (codepoint == font->EllipsisChar && font->EllipsisAutoBake))
+                continue;
+            ImWchar loader_codepoint = codepoint;
+            if (font->RemapPairs.Data.Size != 0)
+                loader_codepoint = (ImWchar)font->RemapPairs.GetInt((ImGuiID)codepoint, (int)codepoint);
+            const int src_n = ImGui_ImplFreeType_PreloadFindSource(atlas, font, loader_codepoint);
+            if (src_n == -1)
+                continue; // Left to regular loading
+            ImGui_ImplFreeType_PreloadGlyph glyph;
+            memset((void*)&glyph, 0, sizeof(glyph));
+            glyph.Codepoint = codepoint;
+            glyph.LoaderCodepoint = loader_codepoint;
+            glyph.SourceIdx = src_n;
+            out_glyphs->push_back(glyph);
+        }
+}
+
+int ImGuiFreeType::PreloadGlyphs(ImFontAtlas* atlas, ImFont* font, float font_size, const ImWchar* glyph_ranges, int threads_count)
+{
+    IM_ASSERT(font != nullptr && font->ContainerAtlas == atlas);
+    IM_ASSERT(!atlas->Locked && "Cannot preload glyphs while atlas is locked!");
+    if (atlas->Builder == nullptr)
+        ImFontAtlasBuildMain(atlas);
+    ImFontBaked* baked = font->GetFontBaked(font_size);
+    if (baked == nullptr)
+        return 0;
+
+    // Gather glyphs not loaded yet
+    ImVector<ImGui_ImplFreeType_PreloadGlyph> glyphs;
+    if (glyph_ranges != nullptr)
+        ImGui_ImplFreeType_PreloadAddRange(atlas, font, baked, glyph_ranges, &glyphs);
+    else
+        for (ImFontConfig* src : font->Sources)
+            ImGui_ImplFreeType_PreloadAddRange(atlas, font, baked, src->GlyphRanges ? src->GlyphRanges : atlas->GetGlyphRangesDefault(), &glyphs);
+    if (glyphs.Size == 0)
+        return 0;
+
+    // Metrics only mode (ImFontAtlasFlags_MetricsOnly): nothing to rasterize, regular loading is cheap enough.
+    if (atlas->Flags & ImFontAtlasFlags_MetricsOnly)
+    {
+        int loaded_count = 0;
+        for (const ImGui_ImplFreeType_PreloadGlyph& glyph : glyphs)
+            if (baked->FindGlyphNoFallback(glyph.Codepoint) != nullptr)
+                loaded_count++;
+        return loaded_count;
+    }
+
+    ImGui_ImplFreeType_Allocator allocator;
+    ImGui_ImplFreeType_PreloadGetAllocator(&allocator);
+
+#ifndef IMGUI_DISABLE_FREETYPE_THREADS
+    if (threads_count <= 0)
+        threads_count = (int)std::thread::hardware_concurrency();
+#else
+    threads_count = 1;
+#endif
+    threads_count = ImClamp(threads_count, 1, IMGUI_FREETYPE_PRELOAD_MAX_THREADS);
+
+    int loaded_count = 0;
+    for (int batch_start = 0; batch_start < glyphs.Size; batch_start += IMGUI_FREETYPE_PRELOAD_GLYPHS_PER_BATCH)
+    {
+        // Rasterize
+        const int batch_size = ImMin(glyphs.Size - batch_start, IMGUI_FREETYPE_PRELOAD_GLYPHS_PER_BATCH);
+        const int workers_count = ImClamp(batch_size / IMGUI_FREETYPE_PRELOAD_MIN_GLYPHS_PER_THREAD, 1, threads_count);
+        ImGui_ImplFreeType_PreloadWorker workers[IMGUI_FREETYPE_PRELOAD_MAX_THREADS];
+        ImGui_ImplFreeType_PreloadRun(workers, workers_count, baked, &allocator, &glyphs[batch_start], batch_size);
+
+        // Pack and register, in codepoint order. Glyphs which failed are left to regular loading.
+        for (int worker_n = 0; worker_n < workers_count; worker_n++)
+        {
+            ImGui_ImplFreeType_PreloadWorker* worker = &workers[worker_n];
+            for (int glyph_n = 0; glyph_n < worker->GlyphsCount; glyph_n++)
+            {
+                const ImGui_ImplFreeType_PreloadGlyph* preload_glyph = &worker->Glyphs[glyph_n];
+                if (!preload_glyph->Loaded || baked->IsGlyphLoaded(preload_glyph->Codepoint)) // (ranges of multiple sources may overlap)
+                    continue;
+                ImFontGlyph glyph;
+                if (!ImGui_ImplFreeType_PreloadPackGlyph(atlas, baked, worker, preload_glyph, &glyph))
+                    return loaded_count;
+                glyph.Codepoint = preload_glyph->Codepoint;
+                glyph.SourceIdx = preload_glyph->SourceIdx;
+                ImFontAtlasBakedAddFontGlyph(atlas, baked, font->Sources[preload_glyph->SourceIdx], &glyph);
+                loaded_count++;
+            }
+        }
+    }
+    return loaded_count;
+}
+
+// Load deferred glyphs (ImFontAtlasFlags_DeferGlyphLoading) using worker threads.
+// Input glyphs[] have Codepoint (after remapping) and SourceIdx set. Output is the same as ImGui_ImplFreeType_FontBakedLoadGlyph(), nothing is added to 'baked'.
+// Return false to let the caller load small batches one by one: opening new faces would cost more than rasterizing.
+static bool ImGui_ImplFreeType_FontBakedLoadGlyphs(ImFontAtlas* atlas, ImFontBaked* baked, ImFontGlyph* glyphs, bool* out_loaded, int glyphs_count)
+{
+#ifndef IMGUI_DISABLE_FREETYPE_THREADS
+    int threads_count = GImGuiFreeTypeDeferredThreadsCount;
+    if (threads_count <= 0)
+        threads_count = (int)std::thread::hardware_concurrency();
+    threads_count = ImMin(threads_count, IMGUI_FREETYPE_PRELOAD_MAX_THREADS);
+    const int workers_count = ImMin(glyphs_count / IMGUI_FREETYPE_DEFERRED_MIN_GLYPHS_PER_THREAD, threads_count);
+    if (workers_count < 2 || (atlas->Flags & ImFontAtlasFlags_MetricsOnly))
+        return false;
+
+    ImVector<ImGui_ImplFreeType_PreloadGlyph> preload_glyphs;
+    preload_glyphs.resize(glyphs_count);
+    for (int glyph_n = 0; glyph_n < glyphs_count; glyph_n++)
+    {
+        ImGui_ImplFreeType_PreloadGlyph* preload_glyph = &preload_glyphs[glyph_n];
+        memset((void*)preload_glyph, 0, sizeof(*preload_glyph));
+        preload_glyph->Codepoint = preload_glyph->LoaderCodepoint = (ImWchar)glyphs[glyph_n].Codepoint;
+        preload_glyph->SourceIdx = glyphs[glyph_n].SourceIdx;
+    }
+
+    ImGui_ImplFreeType_Allocator allocator;
+    ImGui_ImplFreeType_PreloadGetAllocator(&allocator);
+    ImGui_ImplFreeType_PreloadWorker workers[IMGUI_FREETYPE_PRELOAD_MAX_THREADS];
+    ImGui_ImplFreeType_PreloadRun(workers, workers_count, baked, &allocator, preload_glyphs.Data, glyphs_count);
+
+    // Pack in submission order
+    for (int worker_n = 0; worker_n < workers_count; worker_n++)
+    {
+        const ImGui_ImplFreeType_PreloadWorker* worker = &workers[worker_n];
+        for (int glyph_n = 0; glyph_n < worker->GlyphsCount; glyph_n++)
+        {
+            const ImGui_ImplFreeType_PreloadGlyph* preload_glyph = &worker->Glyphs[glyph_n];
+            const int idx = (int)(preload_glyph - preload_glyphs.Data);
+            glyphs[idx] = ImFontGlyph();
+            out_loaded[idx] = preload_glyph->Loaded && ImGui_ImplFreeType_PreloadPackGlyph(atlas, baked, worker, preload_glyph, &glyphs[idx]);
+        }
+    }
+    return true;
+#else
+    IM_UNUSED(atlas);
+    IM_UNUSED(baked);
+    IM_UNUSED(glyphs);
+    IM_UNUSED(out_loaded);
+    IM_UNUSED(glyphs_count);
+    return false;
+#endif
+}
+
+void ImGuiFreeType::SetDeferredGlyphsThreadsCount(int threads_count)
+{
+    GImGuiFreeTypeDeferredThreadsCount = threads_count;
+}
+
 bool ImGuiFreeType::DebugEditFontLoaderFlags(unsigned int* p_font_loader_flags)
 {
     bool edited = false;
@@ -15,6 +15,7 @@
 // - Add '#define IMGUI_ENABLE_FREETYPE_LUNASVG' to use lunasvg (not provided). See #6591.
 
 // Forward declarations
+struct ImFont;
 struct ImFontAtlas;
 struct ImFontLoader;
 
@@ -70,6 +71,19 @@ namespace ImGuiFreeType
     // However, as FreeType does lots of allocations we provide a way for the user to redirect it to a separate memory heap if desired.
     IMGUI_API void                      SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data), void (*free_func)(void* ptr, void* user_data), void* user_data = nullptr);
 
+    // Rasterize glyphs for a given font size using multiple threads, e.g. to preload large CJK or emoji sets. Return number of glyphs loaded.
+    // - Each worker opens its own FT_Face over the font data and rasterizes a slice of the codepoints. Packing into the atlas is done on the calling thread.
+    // - glyph_ranges: zero-terminated list of inclusive pairs (e.g. ImFontAtlas::GetGlyphRangesChineseFull()). NULL to use ImFontConfig::GlyphRanges of each source.
+    // - threads_count: 0 to use std::thread::hardware_concurrency(). Add '#define IMGUI_DISABLE_FREETYPE_THREADS' to disable threads altogether.
+    // - Allocators set with SetAllocatorFunctions() (or ImGui::SetAllocatorFunctions() when using default ones) are called from worker threads and need to be thread-safe.
+    // - Call outside of NewFrame()..EndFrame() if your backend doesn't support ImGuiBackendFlags_RendererHasTextures.
+    IMGUI_API int                       PreloadGlyphs(ImFontAtlas* atlas, ImFont* font, float font_size, const ImWchar* glyph_ranges = nullptr, int threads_count = 0);
+
+    // Set number of threads used to rasterize glyphs with ImFontAtlasFlags_DeferGlyphLoading, using the same workers as PreloadGlyphs().
+    // - threads_count: 0 to use std::thread::hardware_concurrency() (default), 1 to load glyphs one by one on the calling thread.
+    // - Batches smaller than 16 glyphs per thread are always loaded one by one.
+    IMGUI_API void                      SetDeferredGlyphsThreadsCount(int threads_count);
+
     // Display UI to edit ImFontAtlas::FontLoaderFlags (shared) or ImFontConfig::FontLoaderFlags (single source)
     IMGUI_API bool                      DebugEditFontLoaderFlags(ImGuiFreeTypeLoaderFlags* p_font_loader_flags);
 
@@ -0,0 +1,21 @@
+// dear imgui: headless tests for internal helpers
+// See main.cpp
+
+#pragma once
+
+#include "imgui.h"
+#include "imgui_internal.h"
+
+// Check macro: report failure and keep going, so one run shows all failures.
+#define IM_CHECK(_EXPR)     do { if (!(_EXPR)) ImGuiTests_ReportFailure(__FILE__, __LINE__, #_EXPR); } while (0)
+
+void    ImGuiTests_ReportFailure(const char* file, int line, const char* expr);
+void    ImGuiTests_AckTextures();   // Pretend to be a renderer backend: acknowledge texture requests of current context, after Render().
+
+// Tests
+void    Test_FontAtlasTextureRowKernels();
+void    Test_FontCalcTextSizeBatch();
+void    Test_FontDeferredGlyphLoading();
+void    Test_FontSdf();
+void    Test_FontMetricsOnly();
+void    Test_WindowsOrder();
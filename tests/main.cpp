@@ -0,0 +1,57 @@
+// dear imgui: headless tests for internal helpers
+// Those don't need a backend or a window: build and run with 'make test'.
+// Exit code is 0 when all tests passed.
+
+#include "imgui_tests.h"
+#include <stdio.h>
+
+static int  GTestsFailures = 0;
+
+void ImGuiTests_ReportFailure(const char* file, int line, const char* expr)
+{
+    if (GTestsFailures < 50)
+        fprintf(stderr, "%s(%d): check failed: %s\n", file, line, expr);
+    GTestsFailures++;
+}
+
+void ImGuiTests_AckTextures()
+{
+    for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
+        if (tex->Status == ImTextureStatus_WantCreate || tex->Status == ImTextureStatus_WantUpdates)
+            tex->SetStatus(ImTextureStatus_OK);
+        else if (tex->Status == ImTextureStatus_WantDestroy)
+            tex->SetStatus(ImTextureStatus_Destroyed);
+}
+
+struct ImGuiTestEntry
+{
+    const char* Name;
+    void        (*Func)();
+};
+
+static const ImGuiTestEntry GTests[] =
+{
+    { "FontAtlasTextureRowKernels", Test_FontAtlasTextureRowKernels },
+    { "FontCalcTextSizeBatch",      Test_FontCalcTextSizeBatch },
+    { "FontDeferredGlyphLoading",   Test_FontDeferredGlyphLoading },
+    { "FontSdf",                    Test_FontSdf },
+    { "FontMetricsOnly",            Test_FontMetricsOnly },
+    { "WindowsOrder",               Test_WindowsOrder },
+};
+
+int main(int, char**)
+{
+    IMGUI_CHECKVERSION();
+    int tests_failed = 0;
+    for (const ImGuiTestEntry& test : GTests)
+    {
+        const int failures_before = GTestsFailures;
+        test.Func();
+        const bool ok = (GTestsFailures == failures_before);
+        printf("[%s] %s\n", ok ? " OK " : "FAIL", test.Name);
+        if (!ok)
+            tests_failed++;
+    }
+    printf("%d/%d tests passed.\n", IM_ARRAYSIZE(GTests) - tests_failed, IM_ARRAYSIZE(GTests));
+    return (tests_failed == 0) ? 0 : 1;
+}
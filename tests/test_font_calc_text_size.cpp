@@ -0,0 +1,89 @@
+// dear imgui: headless tests for internal helpers
+// - CalcTextSizeBatch(): same output as calling CalcTextSize() on each string (ASCII, UTF-8, new lines, empty strings, wrapping).
+
+#include "imgui_tests.h"
+#include <string.h>
+
+static const char* const GCalcTextSizeTestStrings[] =
+{
+    "",
+    "a",
+    "Hello",
+    "Hello, world!",
+    "0123456789ABCDEF",                                 // Exactly 16 bytes
+    "0123456789ABCDEFG",                                // One byte above
+    "The quick brown fox jumps over the lazy dog",
+    "   leading and trailing blanks   ",
+    "Tab\tseparated\tvalues",
+    "Line 1\nLine 2",
+    "Trailing new line\n",
+    "\n",
+    "\n\n\n",
+    "Windows\r\nline ending",
+    "Caf\xC3\xA9 \xC3\x89t\xC3\xA9 \xC3\xBC\xC3\x9F",   // Latin-1 Supplement (in default font)
+    "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E",             // CJK (missing from default font: fallback glyph)
+    "Mixed ASCII and \xC2\xA9 symbol in a long enough string",
+    "\xF0\x9F\x98\x80 emoji",                           // 4 bytes sequence
+    "\xC3",                                             // Truncated sequence
+    "A very long line of text without any new line, to be wrapped at various widths when wrapping is enabled",
+};
+
+static const float GCalcTextSizeTestWrapWidths[] = { -1.0f, 0.0f, 1.0f, 50.0f, 123.5f, 1000.0f };
+
+static bool CalcTextSizeTestEqual(const ImVec2& a, const ImVec2& b)
+{
+    return a.x == b.x && a.y == b.y;
+}
+
+void Test_FontCalcTextSizeBatch()
+{
+    ImGuiContext* ctx = ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(800.0f, 600.0f);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+    io.Fonts->AddFontDefault();
+
+    const int count = IM_ARRAYSIZE(GCalcTextSizeTestStrings);
+    ImVector<const char*> texts_end;
+    for (int n = 0; n < count; n++)
+        texts_end.push_back((n & 1) ? GCalcTextSizeTestStrings[n] + strlen(GCalcTextSizeTestStrings[n]) : NULL); // Mix explicit and zero-terminated ends
+    ImVector<ImVec2> sizes;
+    sizes.resize(count);
+
+    // Second frame measures with all glyphs already loaded. Other sizes load glyphs while measuring.
+    const float font_sizes[] = { 13.0f, 13.0f, 20.0f, 7.5f };
+    for (float font_size : font_sizes)
+    {
+        ImGui::NewFrame();
+        ImGui::PushFont(NULL, font_size);
+        for (float wrap_width : GCalcTextSizeTestWrapWidths)
+        {
+            // Whole list, then every sub-range size (exercising partial batches)
+            for (int batch_size = 1; batch_size <= count; batch_size++)
+                for (int first = 0; first + batch_size <= count; first += batch_size)
+                {
+                    ImGui::CalcTextSizeBatch(&GCalcTextSizeTestStrings[first], (first & 1) ? NULL : &texts_end[first], batch_size, sizes.Data, wrap_width);
+                    for (int n = 0; n < batch_size; n++)
+                        IM_CHECK(CalcTextSizeTestEqual(sizes[n], ImGui::CalcTextSize(GCalcTextSizeTestStrings[first + n], NULL, false, wrap_width)));
+                }
+        }
+
+        // Lower level: ImFont::CalcTextSizeBatch() vs ImFont::CalcTextSizeA()
+        ImFont* font = ImGui::GetFont();
+        font->CalcTextSizeBatch(font_size, 0.0f, GCalcTextSizeTestStrings, texts_end.Data, count, sizes.Data);
+        for (int n = 0; n < count; n++)
+            IM_CHECK(CalcTextSizeTestEqual(sizes[n], font->CalcTextSizeA(font_size, FLT_MAX, 0.0f, GCalcTextSizeTestStrings[n])));
+        ImGui::PopFont();
+        ImGui::Render();
+        ImGuiTests_AckTextures();
+    }
+
+    // Empty batch
+    ImGui::NewFrame();
+    ImGui::CalcTextSizeBatch(GCalcTextSizeTestStrings, NULL, 0, sizes.Data);
+    ImGui::Render();
+    ImGuiTests_AckTextures();
+    ImGui::DestroyContext(ctx);
+}
@@ -0,0 +1,150 @@
+// dear imgui: headless tests for internal helpers
+// - Deferred glyph loading (ImFontAtlasFlags_DeferGlyphLoading): placeholders have final advances, and glyphs loaded on following frames
+//   are the same as glyphs loaded immediately (metrics and pixels), for each available font loader and various GlyphLoadMaxPerFrame values.
+
+#include "imgui_tests.h"
+#ifdef IMGUI_ENABLE_FREETYPE
+#include "misc/freetype/imgui_freetype.h"
+#endif
+
+static const float GDeferredTestFontSize = 20.0f;
+
+struct DeferredTestOutput
+{
+    ImVector<float>         FirstFrameAdvanceX; // AdvanceX returned on the frame each glyph was requested
+    ImVector<ImFontGlyph>   Glyphs;             // Final glyphs
+    ImVector<int>           PixelsOffset;       // One per glyph, -1 when not packed
+    ImVector<int>           PixelsSize;
+    ImVector<unsigned char> Pixels;             // Packed pixels of all glyphs, in texture format
+};
+
+// ASCII, Latin-1 Supplement, and a codepoint missing from the default font.
+static void DeferredTestGetCodepoints(ImVector<ImWchar>* out)
+{
+    for (ImWchar c = 0x20; c <= 0x7E; c++)
+        out->push_back(c);
+    for (ImWchar c = 0xA0; c <= 0xFF; c++)
+        out->push_back(c);
+    out->push_back(0x4E00);
+}
+
+// max_per_frame < 0: immediate loading
+static void DeferredTestRun(const ImFontLoader* loader, int max_per_frame, DeferredTestOutput* out)
+{
+    ImGuiContext* ctx = ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(800.0f, 600.0f);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+    ImFontAtlas* atlas = io.Fonts;
+    atlas->SetFontLoader(loader);
+    if (max_per_frame >= 0)
+    {
+        atlas->Flags |= ImFontAtlasFlags_DeferGlyphLoading;
+        atlas->GlyphLoadMaxPerFrame = max_per_frame;
+    }
+    ImFont* font = atlas->AddFontDefault();
+
+    ImVector<ImWchar> codepoints;
+    DeferredTestGetCodepoints(&codepoints);
+
+    // Request all glyphs on first frame
+    ImGui::NewFrame();
+    ImFontBaked* baked = font->GetFontBaked(GDeferredTestFontSize);
+    for (ImWchar c : codepoints)
+        out->FirstFrameAdvanceX.push_back(baked->FindGlyph(c)->AdvanceX);
+    if (max_per_frame >= 0)
+        IM_CHECK(atlas->Builder->DeferredGlyphs.Size > 100);
+    ImGui::Render();
+    ImGuiTests_AckTextures();
+
+    // Load pending glyphs on following frames (all of them on next frame when GlyphLoadMaxPerFrame == 0)
+    const int pending_count = atlas->Builder->DeferredGlyphs.Size;
+    int frames_count = 0;
+    while (atlas->Builder->DeferredGlyphs.Size > 0 && frames_count < 1000)
+    {
+        ImGui::NewFrame();
+        font->GetFontBaked(GDeferredTestFontSize);
+        ImGui::Render();
+        ImGuiTests_AckTextures();
+        frames_count++;
+    }
+    IM_CHECK(atlas->Builder->DeferredGlyphs.Size == 0);
+    if (max_per_frame == 0)
+        IM_CHECK(frames_count <= 1);
+    else if (max_per_frame > 0)
+        IM_CHECK(frames_count >= (pending_count + max_per_frame - 1) / max_per_frame);
+
+    // Record final glyphs
+    ImGui::NewFrame();
+    baked = font->GetFontBaked(GDeferredTestFontSize);
+    for (ImWchar c : codepoints)
+    {
+        const ImFontGlyph* glyph = baked->FindGlyph(c);
+        out->Glyphs.push_back(*glyph);
+        if (glyph->PackId == ImFontAtlasRectId_Invalid)
+        {
+            out->PixelsOffset.push_back(-1);
+            out->PixelsSize.push_back(0);
+            continue;
+        }
+        ImTextureData* tex = ImFontAtlasPageGetTexture(atlas, glyph->PageIndex);
+        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph->PackId);
+        const int row_size = r->w * tex->BytesPerPixel;
+        out->PixelsOffset.push_back(out->Pixels.Size);
+        out->PixelsSize.push_back(row_size * r->h);
+        for (int y = 0; y < r->h; y++)
+        {
+            const unsigned char* row = (const unsigned char*)tex->GetPixelsAt(r->x, r->y + y);
+            for (int x = 0; x < row_size; x++)
+                out->Pixels.push_back(row[x]);
+        }
+    }
+    ImGui::Render();
+    ImGuiTests_AckTextures();
+    ImGui::DestroyContext(ctx);
+}
+
+static void Test_FontDeferredGlyphLoadingWithLoader(const ImFontLoader* loader)
+{
+    DeferredTestOutput immediate;
+    DeferredTestRun(loader, -1, &immediate);
+
+    // 0 = no limit: a single large batch.
+    const int max_per_frame_values[] = { 0, 7, 64 };
+    for (int max_per_frame : max_per_frame_values)
+    {
+        DeferredTestOutput deferred;
+        DeferredTestRun(loader, max_per_frame, &deferred);
+        IM_CHECK(immediate.Glyphs.Size > 0 && deferred.Glyphs.Size == immediate.Glyphs.Size);
+        if (deferred.Glyphs.Size != immediate.Glyphs.Size)
+            continue;
+        for (int n = 0; n < immediate.Glyphs.Size; n++)
+        {
+            const ImFontGlyph& a = immediate.Glyphs[n];
+            const ImFontGlyph& b = deferred.Glyphs[n];
+            IM_CHECK(deferred.FirstFrameAdvanceX[n] == a.AdvanceX); // Layout is the same while waiting for glyphs
+            IM_CHECK(a.Codepoint == b.Codepoint && a.Visible == b.Visible && a.Colored == b.Colored && a.AdvanceX == b.AdvanceX);
+            IM_CHECK(a.X0 == b.X0 && a.Y0 == b.Y0 && a.X1 == b.X1 && a.Y1 == b.Y1);
+            IM_CHECK(immediate.PixelsSize[n] == deferred.PixelsSize[n]);
+            if (immediate.PixelsSize[n] == deferred.PixelsSize[n] && immediate.PixelsSize[n] > 0)
+                IM_CHECK(memcmp(&immediate.Pixels[immediate.PixelsOffset[n]], &deferred.Pixels[deferred.PixelsOffset[n]], (size_t)immediate.PixelsSize[n]) == 0);
+        }
+    }
+}
+
+void Test_FontDeferredGlyphLoading()
+{
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+    Test_FontDeferredGlyphLoadingWithLoader(ImFontAtlasGetFontLoaderForStbTruetype());
+#endif
+#ifdef IMGUI_ENABLE_FREETYPE
+    // Batches loaded one by one, then by worker threads (whatever the number of cores)
+    ImGuiFreeType::SetDeferredGlyphsThreadsCount(1);
+    Test_FontDeferredGlyphLoadingWithLoader(ImGuiFreeType::GetFontLoader());
+    ImGuiFreeType::SetDeferredGlyphsThreadsCount(4);
+    Test_FontDeferredGlyphLoadingWithLoader(ImGuiFreeType::GetFontLoader());
+    ImGuiFreeType::SetDeferredGlyphsThreadsCount(0);
+#endif
+}
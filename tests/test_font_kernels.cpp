@@ -0,0 +1,223 @@
+// dear imgui: headless tests for internal helpers
+// - Font atlas texture row kernels: SIMD paths (when enabled) vs *Scalar() reference versions.
+
+#include "imgui_tests.h"
+#include <string.h>
+
+// Widths: empty, below one vector, around vector multiples, large with a tail.
+static const int    GKernelTestWidths[] = { 0, 1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 19, 31, 32, 33, 47, 63, 64, 65, 257 };
+static const float  GKernelTestMultiplyFactors[] = { 0.0f, 0.25f, 0.5f, 1.0f, 1.37f, 2.0f, 3.0f, 255.0f };
+static const int    GKernelTestMaxWidth = 257;
+static const int    GKernelTestGuard = 16;      // Extra bytes/pixels after each row, which must not be written to.
+static const ImU8   GKernelTestGuardValue = 0xCD;
+
+// Alpha values mixing 0, 255, mid values and pseudo-random ones.
+static ImU8 KernelTestValue(int n, ImU32* seed)
+{
+    *seed = *seed * 1664525u + 1013904223u;
+    switch (n % 6)
+    {
+    case 0: return 0;
+    case 1: return 255;
+    case 2: return 128;
+    case 3: return 127;
+    default: return (ImU8)(*seed >> 24);
+    }
+}
+
+// Fill 'size' bytes then a guard area with the same contents in both buffers.
+static void KernelTestFillBytes(ImU8* a, ImU8* b, int size, ImU32* seed)
+{
+    for (int n = 0; n < size; n++)
+        a[n] = b[n] = KernelTestValue(n, seed);
+    memset(a + size, GKernelTestGuardValue, GKernelTestGuard);
+    memset(b + size, GKernelTestGuardValue, GKernelTestGuard);
+}
+
+static bool KernelTestGuardIntact(const ImU8* p)
+{
+    for (int n = 0; n < GKernelTestGuard; n++)
+        if (p[n] != GKernelTestGuardValue)
+            return false;
+    return true;
+}
+
+// Storage aligned on 16 bytes, so 'head' offsets give every possible misalignment.
+struct KernelTestBuffer
+{
+    ImVector<ImU8>  Data;
+    KernelTestBuffer(int size)          { Data.resize(size + 64); }
+    ImU8*           At(int head)        { return (ImU8*)(((size_t)Data.Data + 15) & ~(size_t)15) + head; }
+};
+
+static void Test_RowAlpha8ToRGBA32()
+{
+    ImU32 seed = 0x12345678;
+    KernelTestBuffer src_buf(GKernelTestMaxWidth + GKernelTestGuard);
+    KernelTestBuffer dst_a(GKernelTestMaxWidth * 4 + GKernelTestGuard * 4), dst_b(GKernelTestMaxWidth * 4 + GKernelTestGuard * 4);
+    for (int src_head = 0; src_head < 16; src_head++)
+        for (int dst_head = 0; dst_head < 16; dst_head += 4)
+            for (int w : GKernelTestWidths)
+            {
+                ImU8* src = src_buf.At(src_head);
+                for (int n = 0; n < w; n++)
+                    src[n] = KernelTestValue(n, &seed);
+                ImU8* a = dst_a.At(dst_head);
+                ImU8* b = dst_b.At(dst_head);
+                memset(a, GKernelTestGuardValue, (size_t)(w + GKernelTestGuard) * 4);
+                memset(b, GKernelTestGuardValue, (size_t)(w + GKernelTestGuard) * 4);
+                ImFontAtlasTextureRowAlpha8ToRGBA32(src, (ImU32*)(void*)a, w);
+                ImFontAtlasTextureRowAlpha8ToRGBA32Scalar(src, (ImU32*)(void*)b, w);
+                IM_CHECK(memcmp(a, b, (size_t)w * 4) == 0);
+                IM_CHECK(KernelTestGuardIntact(a + w * 4));
+                for (int n = 0; n < w; n++)
+                    IM_CHECK(((ImU32*)(void*)b)[n] == IM_COL32(255, 255, 255, src[n]));
+            }
+}
+
+static void Test_RowRGBA32ToAlpha8()
+{
+    ImU32 seed = 0x23456789;
+    KernelTestBuffer src_buf(GKernelTestMaxWidth * 4);
+    KernelTestBuffer dst_a(GKernelTestMaxWidth + GKernelTestGuard), dst_b(GKernelTestMaxWidth + GKernelTestGuard);
+    for (int src_head = 0; src_head < 16; src_head += 4)
+        for (int dst_head = 0; dst_head < 16; dst_head++)
+            for (int w : GKernelTestWidths)
+            {
+                ImU32* src = (ImU32*)(void*)src_buf.At(src_head);
+                for (int n = 0; n < w; n++)
+                    src[n] = IM_COL32(KernelTestValue(n + 3, &seed), KernelTestValue(n + 4, &seed), KernelTestValue(n + 5, &seed), KernelTestValue(n, &seed));
+                ImU8* a = dst_a.At(dst_head);
+                ImU8* b = dst_b.At(dst_head);
+                memset(a, GKernelTestGuardValue, (size_t)(w + GKernelTestGuard));
+                memset(b, GKernelTestGuardValue, (size_t)(w + GKernelTestGuard));
+                ImFontAtlasTextureRowRGBA32ToAlpha8(src, a, w);
+                ImFontAtlasTextureRowRGBA32ToAlpha8Scalar(src, b, w);
+                IM_CHECK(memcmp(a, b, (size_t)w) == 0);
+                IM_CHECK(KernelTestGuardIntact(a + w));
+            }
+}
+
+static void Test_RowMultiplyAlpha8()
+{
+    ImU32 seed = 0x3456789A;
+    KernelTestBuffer buf_a(256 + GKernelTestGuard), buf_b(256 + GKernelTestGuard);
+    for (float factor : GKernelTestMultiplyFactors)
+    {
+        // Every possible value
+        ImU8* a = buf_a.At(0);
+        ImU8* b = buf_b.At(0);
+        for (int n = 0; n < 256; n++)
+            a[n] = b[n] = (ImU8)n;
+        ImFontAtlasTextureRowMultiplyAlpha8(a, 256, factor);
+        ImFontAtlasTextureRowMultiplyAlpha8Scalar(b, 256, factor);
+        IM_CHECK(memcmp(a, b, 256) == 0);
+
+        // Heads and tails
+        for (int head = 0; head < 16; head++)
+            for (int w : GKernelTestWidths)
+            {
+                if (w > 256)
+                    continue;
+                a = buf_a.At(head);
+                b = buf_b.At(head);
+                KernelTestFillBytes(a, b, w, &seed);
+                ImFontAtlasTextureRowMultiplyAlpha8(a, w, factor);
+                ImFontAtlasTextureRowMultiplyAlpha8Scalar(b, w, factor);
+                IM_CHECK(memcmp(a, b, (size_t)w) == 0);
+                IM_CHECK(KernelTestGuardIntact(a + w));
+            }
+    }
+}
+
+static void Test_RowMultiplyRGBA32()
+{
+    ImU32 seed = 0x456789AB;
+    KernelTestBuffer buf_a(GKernelTestMaxWidth * 4 + GKernelTestGuard), buf_b(GKernelTestMaxWidth * 4 + GKernelTestGuard);
+    for (float factor : GKernelTestMultiplyFactors)
+        for (int head = 0; head < 16; head += 4)
+            for (int w : GKernelTestWidths)
+            {
+                ImU8* a = buf_a.At(head);
+                ImU8* b = buf_b.At(head);
+                KernelTestFillBytes(a, b, w * 4, &seed);
+                ImFontAtlasTextureRowMultiplyRGBA32((ImU32*)(void*)a, w, factor);
+                ImFontAtlasTextureRowMultiplyRGBA32Scalar((ImU32*)(void*)b, w, factor);
+                IM_CHECK(memcmp(a, b, (size_t)w * 4) == 0);
+                IM_CHECK(KernelTestGuardIntact(a + w * 4));
+            }
+}
+
+static void Test_RowFillRGBA32()
+{
+    const ImU32 cols[] = { IM_COL32(0, 0, 0, 0), IM_COL32(255, 255, 255, 255), IM_COL32(255, 255, 255, 128), IM_COL32(1, 2, 3, 4) };
+    KernelTestBuffer buf_a(GKernelTestMaxWidth * 4 + GKernelTestGuard), buf_b(GKernelTestMaxWidth * 4 + GKernelTestGuard);
+    for (ImU32 col : cols)
+        for (int head = 0; head < 16; head += 4)
+            for (int w : GKernelTestWidths)
+            {
+                ImU8* a = buf_a.At(head);
+                ImU8* b = buf_b.At(head);
+                memset(a, GKernelTestGuardValue, (size_t)(w * 4 + GKernelTestGuard));
+                memset(b, GKernelTestGuardValue, (size_t)(w * 4 + GKernelTestGuard));
+                ImFontAtlasTextureRowFillRGBA32((ImU32*)(void*)a, w, col);
+                ImFontAtlasTextureRowFillRGBA32Scalar((ImU32*)(void*)b, w, col);
+                IM_CHECK(memcmp(a, b, (size_t)w * 4) == 0);
+                IM_CHECK(KernelTestGuardIntact(a + w * 4));
+            }
+}
+
+static void Test_RowPremulBGRA32ToRGBA32()
+{
+    // Every (color, alpha) pair, including invalid pre-multiplied colors > alpha, and alpha == 0.
+    const int pairs_count = 256 * 256;
+    ImVector<ImU8> src;
+    src.resize(pairs_count * 4);
+    for (int n = 0; n < pairs_count; n++)
+    {
+        const int c = n & 0xFF, a = n >> 8;
+        src[n * 4 + 0] = (ImU8)c;           // B
+        src[n * 4 + 1] = (ImU8)(c / 2);     // G
+        src[n * 4 + 2] = (ImU8)(255 - c);   // R
+        src[n * 4 + 3] = (ImU8)a;           // A
+    }
+    ImVector<ImU32> dst_a, dst_b;
+    dst_a.resize(pairs_count);
+    dst_b.resize(pairs_count);
+    ImFontAtlasTextureRowPremulBGRA32ToRGBA32(src.Data, dst_a.Data, pairs_count);
+    ImFontAtlasTextureRowPremulBGRA32ToRGBA32Scalar(src.Data, dst_b.Data, pairs_count);
+    IM_CHECK(memcmp(dst_a.Data, dst_b.Data, (size_t)pairs_count * 4) == 0);
+    IM_CHECK(dst_b[255 * 256 + 10] == IM_COL32(245, 5, 10, 255)); // alpha == 255: unchanged
+    IM_CHECK((dst_b[10] >> IM_COL32_A_SHIFT) == 0);               // alpha == 0: transparent
+
+    // Heads and tails
+    ImU32 seed = 0x56789ABC;
+    KernelTestBuffer src_buf(GKernelTestMaxWidth * 4);
+    KernelTestBuffer buf_a(GKernelTestMaxWidth * 4 + GKernelTestGuard), buf_b(GKernelTestMaxWidth * 4 + GKernelTestGuard);
+    for (int src_head = 0; src_head < 16; src_head++)
+        for (int dst_head = 0; dst_head < 16; dst_head += 4)
+            for (int w : GKernelTestWidths)
+            {
+                ImU8* s = src_buf.At(src_head);
+                for (int n = 0; n < w * 4; n++)
+                    s[n] = KernelTestValue(n, &seed);
+                ImU8* a = buf_a.At(dst_head);
+                ImU8* b = buf_b.At(dst_head);
+                memset(a, GKernelTestGuardValue, (size_t)(w * 4 + GKernelTestGuard));
+                memset(b, GKernelTestGuardValue, (size_t)(w * 4 + GKernelTestGuard));
+                ImFontAtlasTextureRowPremulBGRA32ToRGBA32(s, (ImU32*)(void*)a, w);
+                ImFontAtlasTextureRowPremulBGRA32ToRGBA32Scalar(s, (ImU32*)(void*)b, w);
+                IM_CHECK(memcmp(a, b, (size_t)w * 4) == 0);
+                IM_CHECK(KernelTestGuardIntact(a + w * 4));
+            }
+}
+
+void Test_FontAtlasTextureRowKernels()
+{
+    Test_RowAlpha8ToRGBA32();
+    Test_RowRGBA32ToAlpha8();
+    Test_RowMultiplyAlpha8();
+    Test_RowMultiplyRGBA32();
+    Test_RowFillRGBA32();
+    Test_RowPremulBGRA32ToRGBA32();
+}
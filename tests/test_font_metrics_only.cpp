@@ -0,0 +1,184 @@
+// dear imgui: headless tests for internal helpers
+// - Metrics only atlas (ImFontAtlasFlags_MetricsOnly): same layout and vertex positions as a regular atlas, for each available font loader.
+
+#include "imgui_tests.h"
+#ifdef IMGUI_ENABLE_FREETYPE
+#include "misc/freetype/imgui_freetype.h"
+#endif
+
+struct MetricsOnlyTestOutput
+{
+    ImVector<ImVec2>        ItemRects;      // Min/Max of each submitted item
+    ImVector<ImVec2>        WindowRects;    // Pos/Size of each window
+    ImVector<ImDrawVert>    Vertices;
+    ImVector<ImDrawIdx>     Indices;
+    ImVector<ImVec4>        ClipRects;      // One per draw command
+    ImVector<unsigned int>  ElemCounts;     // One per draw command
+};
+
+static void MetricsOnlyTestRecordItem(MetricsOnlyTestOutput* out)
+{
+    out->ItemRects.push_back(ImGui::GetItemRectMin());
+    out->ItemRects.push_back(ImGui::GetItemRectMax());
+}
+
+// Widgets covering most text layout paths: single line, wrapping, multi-line, non-ASCII, ellipsis, tables, auto-resize.
+static void MetricsOnlyTestGui(MetricsOnlyTestOutput* out)
+{
+    ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f));
+    ImGui::Begin("Auto-resize", NULL, ImGuiWindowFlags_AlwaysAutoResize);
+    ImGui::Text("Hello, world! 0123456789");
+    MetricsOnlyTestRecordItem(out);
+    ImGui::Text("Multi-line\ntext with\ttab\nand Latin-1: \xC3\x89t\xC3\xA9 \xC3\xBC\xC3\x9F \xC2\xA9");
+    MetricsOnlyTestRecordItem(out);
+    ImGui::PushTextWrapPos(ImGui::GetCursorPosX() + 150.0f);
+    ImGui::TextWrapped("This is a long paragraph of text which is wrapped at a fixed width, so word boundaries matter.");
+    MetricsOnlyTestRecordItem(out);
+    ImGui::PopTextWrapPos();
+    ImGui::Button("Button");
+    MetricsOnlyTestRecordItem(out);
+    ImGui::SameLine();
+    static bool check = true;
+    ImGui::Checkbox("Checkbox", &check);
+    MetricsOnlyTestRecordItem(out);
+    static float value = 0.5f;
+    ImGui::SliderFloat("Slider", &value, 0.0f, 1.0f);
+    MetricsOnlyTestRecordItem(out);
+    static char buf[64] = "InputText contents";
+    ImGui::InputText("Input", buf, IM_ARRAYSIZE(buf));
+    MetricsOnlyTestRecordItem(out);
+    ImGui::SetNextItemOpen(true);
+    if (ImGui::TreeNode("Tree node"))
+    {
+        ImGui::BulletText("Bullet text");
+        MetricsOnlyTestRecordItem(out);
+        ImGui::Selectable("Selectable");
+        MetricsOnlyTestRecordItem(out);
+        ImGui::TreePop();
+    }
+    ImGui::SeparatorText("Separator");
+    MetricsOnlyTestRecordItem(out);
+    ImGui::ProgressBar(0.25f, ImVec2(200.0f, 0.0f));
+    MetricsOnlyTestRecordItem(out);
+    ImGui::End();
+
+    ImGui::SetNextWindowPos(ImVec2(400.0f, 10.0f));
+    ImGui::SetNextWindowSize(ImVec2(300.0f, 300.0f));
+    ImGui::Begin("Fixed size");
+    if (ImGui::BeginTable("Table", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+    {
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableSetupColumn("Value");
+        ImGui::TableSetupColumn("Comment", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableHeadersRow();
+        for (int row = 0; row < 4; row++)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("Row %d", row);
+            MetricsOnlyTestRecordItem(out);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", row * 1.25f);
+            MetricsOnlyTestRecordItem(out);
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted("A comment which is too long to fit and gets clipped");
+            MetricsOnlyTestRecordItem(out);
+        }
+        ImGui::EndTable();
+    }
+    ImGui::Button("Clipped button label with ellipsis", ImVec2(120.0f, 0.0f));
+    MetricsOnlyTestRecordItem(out);
+    ImGui::End();
+
+    for (ImGuiWindow* window : ImGui::GetCurrentContext()->Windows)
+        if (window->Active)
+        {
+            out->WindowRects.push_back(window->Pos);
+            out->WindowRects.push_back(window->Size);
+        }
+}
+
+static void MetricsOnlyTestRun(const ImFontLoader* loader, bool metrics_only, MetricsOnlyTestOutput* out)
+{
+    ImGuiContext* ctx = ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(800.0f, 600.0f);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+    ImFontAtlas* atlas = io.Fonts;
+    atlas->SetFontLoader(loader);
+    if (metrics_only)
+        atlas->Flags |= ImFontAtlasFlags_MetricsOnly;
+    atlas->AddFontDefault();
+
+    // A few frames for auto-resizing windows and tables to settle. Only record the last one.
+    for (int frame = 0; frame < 4; frame++)
+    {
+        *out = MetricsOnlyTestOutput();
+        ImGui::NewFrame();
+        MetricsOnlyTestGui(out);
+        ImGui::Render();
+        ImGuiTests_AckTextures();
+    }
+    for (ImDrawList* draw_list : ImGui::GetDrawData()->CmdLists)
+    {
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            out->ClipRects.push_back(cmd.ClipRect);
+            out->ElemCounts.push_back(cmd.ElemCount);
+        }
+        for (const ImDrawVert& vtx : draw_list->VtxBuffer)
+            out->Vertices.push_back(vtx);
+        for (ImDrawIdx idx : draw_list->IdxBuffer)
+            out->Indices.push_back(idx);
+    }
+    IM_CHECK(!metrics_only || (atlas->TexData->Width <= 256 && atlas->TexData->Height <= 128));
+    ImGui::DestroyContext(ctx);
+}
+
+static void Test_FontMetricsOnlyWithLoader(const ImFontLoader* loader)
+{
+    MetricsOnlyTestOutput regular, metrics_only;
+    MetricsOnlyTestRun(loader, false, &regular);
+    MetricsOnlyTestRun(loader, true, &metrics_only);
+
+    IM_CHECK(regular.ItemRects.Size > 0 && regular.ItemRects.Size == metrics_only.ItemRects.Size);
+    if (regular.ItemRects.Size == metrics_only.ItemRects.Size)
+        for (int n = 0; n < regular.ItemRects.Size; n++)
+            IM_CHECK(regular.ItemRects[n].x == metrics_only.ItemRects[n].x && regular.ItemRects[n].y == metrics_only.ItemRects[n].y);
+    IM_CHECK(regular.WindowRects.Size > 0 && regular.WindowRects.Size == metrics_only.WindowRects.Size);
+    if (regular.WindowRects.Size == metrics_only.WindowRects.Size)
+        for (int n = 0; n < regular.WindowRects.Size; n++)
+            IM_CHECK(regular.WindowRects[n].x == metrics_only.WindowRects[n].x && regular.WindowRects[n].y == metrics_only.WindowRects[n].y);
+
+    // Same draw commands, and same vertices except for UV
+    IM_CHECK(regular.ElemCounts.Size > 0 && regular.ElemCounts.Size == metrics_only.ElemCounts.Size);
+    if (regular.ElemCounts.Size == metrics_only.ElemCounts.Size)
+        for (int n = 0; n < regular.ElemCounts.Size; n++)
+        {
+            IM_CHECK(regular.ElemCounts[n] == metrics_only.ElemCounts[n]);
+            IM_CHECK(memcmp(&regular.ClipRects[n], &metrics_only.ClipRects[n], sizeof(ImVec4)) == 0);
+        }
+    IM_CHECK(regular.Vertices.Size > 0 && regular.Vertices.Size == metrics_only.Vertices.Size);
+    if (regular.Vertices.Size == metrics_only.Vertices.Size)
+        for (int n = 0; n < regular.Vertices.Size; n++)
+        {
+            const ImDrawVert& a = regular.Vertices[n];
+            const ImDrawVert& b = metrics_only.Vertices[n];
+            IM_CHECK(a.pos.x == b.pos.x && a.pos.y == b.pos.y && a.col == b.col);
+        }
+    IM_CHECK(regular.Indices.Size > 0 && regular.Indices.Size == metrics_only.Indices.Size);
+    if (regular.Indices.Size == metrics_only.Indices.Size)
+        IM_CHECK(memcmp(regular.Indices.Data, metrics_only.Indices.Data, (size_t)regular.Indices.size_in_bytes()) == 0);
+}
+
+void Test_FontMetricsOnly()
+{
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+    Test_FontMetricsOnlyWithLoader(ImFontAtlasGetFontLoaderForStbTruetype());
+#endif
+#ifdef IMGUI_ENABLE_FREETYPE
+    Test_FontMetricsOnlyWithLoader(ImGuiFreeType::GetFontLoader());
+#endif
+}
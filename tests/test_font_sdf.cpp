@@ -0,0 +1,172 @@
+// dear imgui: headless tests for internal helpers
+// - Signed distance field glyphs (ImFontConfig::SdfBakeSize): distance values and placement of packed rectangles, for each available font loader.
+
+#include "imgui_tests.h"
+#ifdef IMGUI_ENABLE_FREETYPE
+#include "misc/freetype/imgui_freetype.h"
+#endif
+
+static const float  GSdfTestBakeSize = 32.0f;
+static const int    GSdfTestSpread = 4;
+static const float  GSdfTestRenderSize = 40.0f;     // Any size within SdfMinSize..SdfMaxSize is served by the SDF bake.
+
+struct SdfTestRect
+{
+    int             PageIndex;
+    ImTextureRect   Rect;
+};
+
+static int SdfTestGetValue(ImTextureData* tex, int x, int y)
+{
+    const unsigned char* p = (const unsigned char*)tex->GetPixelsAt(x, y);
+    if (tex->Format == ImTextureFormat_Alpha8)
+        return *p;
+    return (int)((*(const ImU32*)(const void*)p >> IM_COL32_A_SHIFT) & 0xFF);
+}
+
+// Packed rectangles must be inside their page, and separated by at least TexGlyphPadding pixels.
+static void SdfTestCheckPlacement(ImFontAtlas* atlas, const ImVector<SdfTestRect>& rects)
+{
+    const int pad = atlas->TexGlyphPadding;
+    for (int n = 0; n < rects.Size; n++)
+    {
+        const SdfTestRect& a = rects[n];
+        ImTextureData* tex = ImFontAtlasPageGetTexture(atlas, a.PageIndex);
+        IM_CHECK(a.PageIndex > 0 && tex != NULL && tex->UseSdf);
+        if (tex == NULL)
+            continue;
+        IM_CHECK(a.Rect.x + a.Rect.w + pad <= tex->Width);
+        IM_CHECK(a.Rect.y + a.Rect.h + pad <= tex->Height);
+        for (int m = n + 1; m < rects.Size; m++)
+        {
+            const SdfTestRect& b = rects[m];
+            if (b.PageIndex != a.PageIndex)
+                continue;
+            const bool separated = (a.Rect.x + a.Rect.w + pad <= b.Rect.x) || (b.Rect.x + b.Rect.w + pad <= a.Rect.x) || (a.Rect.y + a.Rect.h + pad <= b.Rect.y) || (b.Rect.y + b.Rect.h + pad <= a.Rect.y);
+            IM_CHECK(separated);
+        }
+    }
+}
+
+// Check distance field of one glyph:
+// - Outer ring is at least 'spread - 1' pixels away from the outline, so close to 0.
+// - Glyph has pixels at least half a pixel inside (> 128), and pixels near the edge.
+// - Adjacent pixels can't differ by more than one pixel of distance (128 / spread), plus rounding.
+static void SdfTestCheckGlyphValues(ImTextureData* tex, const ImTextureRect& r)
+{
+    const int max_outside = 128 / GSdfTestSpread + 8;
+    const int max_step = 128 / GSdfTestSpread + 4;
+    int max_value = 0;
+    int edge_count = 0;
+    for (int y = 0; y < r.h; y++)
+        for (int x = 0; x < r.w; x++)
+        {
+            const int v = SdfTestGetValue(tex, r.x + x, r.y + y);
+            if (x == 0 || y == 0 || x == r.w - 1 || y == r.h - 1)
+                IM_CHECK(v <= max_outside);
+            if (x > 0)
+                IM_CHECK(ImAbs(v - SdfTestGetValue(tex, r.x + x - 1, r.y + y)) <= max_step);
+            if (y > 0)
+                IM_CHECK(ImAbs(v - SdfTestGetValue(tex, r.x + x, r.y + y - 1)) <= max_step);
+            max_value = ImMax(max_value, v);
+            if (v >= 128 - max_step / 2 && v <= 128 + max_step / 2)
+                edge_count++;
+        }
+    IM_CHECK(max_value > 128 + max_step / 2);
+    IM_CHECK(edge_count > 0);
+}
+
+static void Test_FontSdfWithLoader(const ImFontLoader* loader)
+{
+    ImGuiContext* ctx = ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(800.0f, 600.0f);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasSdfTextures;
+    ImFontAtlas* atlas = io.Fonts;
+    atlas->SetFontLoader(loader);
+    ImFontConfig font_cfg;
+    font_cfg.SdfBakeSize = GSdfTestBakeSize;
+    font_cfg.SdfSpread = (ImU8)GSdfTestSpread;
+    ImFont* font = atlas->AddFontDefault(&font_cfg);
+    IM_CHECK(font != NULL);
+
+    ImGui::NewFrame();
+    ImFontBaked* baked = font->GetFontBaked(GSdfTestRenderSize);
+    IM_CHECK(baked != NULL && baked->IsSdf && baked->Size == GSdfTestBakeSize);
+    IM_CHECK(font->GetFontBaked(GSdfTestBakeSize * 0.5f) == baked);
+
+    ImVector<SdfTestRect> rects;
+    const char* glyphs = "AIOWgl.#";
+    for (const char* p = glyphs; *p; p++)
+    {
+        ImFontGlyph* glyph = baked->FindGlyph((ImWchar)*p);
+        IM_CHECK(glyph != NULL && glyph->Codepoint == (unsigned int)*p && glyph->Visible);
+        if (glyph == NULL || !glyph->Visible)
+            continue;
+        IM_CHECK(glyph->PageIndex > 0 && glyph->PackId != ImFontAtlasRectId_Invalid);
+        IM_CHECK(ImFontAtlasPackGetRectPage(atlas, glyph->PackId) == (int)glyph->PageIndex);
+        ImTextureData* tex = ImFontAtlasPageGetTexture(atlas, glyph->PageIndex);
+        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph->PackId);
+        IM_CHECK(tex != NULL && tex->UseSdf && r != NULL);
+        if (tex == NULL || r == NULL)
+            continue;
+        SdfTestRect entry = { (int)glyph->PageIndex, *r };
+        rects.push_back(entry);
+
+        // Glyph box has 'spread' pixels of padding around the outline, and matches UV.
+        IM_CHECK(r->w > GSdfTestSpread * 2 && r->h > GSdfTestSpread * 2);
+        IM_CHECK(ImFabs((glyph->X1 - glyph->X0) - r->w) < 0.01f && ImFabs((glyph->Y1 - glyph->Y0) - r->h) < 0.01f);
+        IM_CHECK(ImFabs(glyph->U0 * tex->Width - r->x) < 0.01f && ImFabs(glyph->V1 * tex->Height - (r->y + r->h)) < 0.01f);
+        SdfTestCheckGlyphValues(tex, *r);
+
+        // Middle row of 'I' crosses a single stem: values increase up to the stem then decrease.
+        if (*p == 'I')
+        {
+            const int y = r->y + r->h / 2;
+            int x = r->x;
+            while (x + 1 < r->x + r->w && SdfTestGetValue(tex, x + 1, y) >= SdfTestGetValue(tex, x, y))
+                x++;
+            IM_CHECK(SdfTestGetValue(tex, x, y) > 128);
+            for (; x + 1 < r->x + r->w; x++)
+                IM_CHECK(SdfTestGetValue(tex, x + 1, y) <= SdfTestGetValue(tex, x, y));
+        }
+
+        // Center of 'O' is its hole, which is outside of the glyph.
+        if (*p == 'O')
+            IM_CHECK(SdfTestGetValue(tex, r->x + r->w / 2, r->y + r->h / 2) < 128);
+    }
+    IM_CHECK(baked->FindGlyphNoFallback(' ') != NULL && !baked->FindGlyphNoFallback(' ')->Visible);
+
+    // Rectangles added directly, including one larger than default SDF pages.
+    const int rect_sizes[][2] = { { 1, 1 }, { 7, 3 }, { 20, 30 }, { 64, 64 }, { 600, 40 }, { 5, 9 } };
+    for (const int* size : rect_sizes)
+    {
+        ImFontAtlasRectId id = ImFontAtlasPackAddSdfRect(atlas, size[0], size[1]);
+        IM_CHECK(id != ImFontAtlasRectId_Invalid);
+        if (id == ImFontAtlasRectId_Invalid)
+            continue;
+        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, id);
+        IM_CHECK(r->w == size[0] && r->h == size[1]);
+        SdfTestRect entry = { ImFontAtlasPackGetRectPage(atlas, id), *r };
+        rects.push_back(entry);
+    }
+    SdfTestCheckPlacement(atlas, rects);
+
+    // Main texture doesn't store SDF data
+    IM_CHECK(!atlas->TexData->UseSdf);
+    ImGui::Render();
+    ImGuiTests_AckTextures();
+    ImGui::DestroyContext(ctx);
+}
+
+void Test_FontSdf()
+{
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+    Test_FontSdfWithLoader(ImFontAtlasGetFontLoaderForStbTruetype());
+#endif
+#ifdef IMGUI_ENABLE_FREETYPE
+    Test_FontSdfWithLoader(ImGuiFreeType::GetFontLoader());
+#endif
+}
@@ -0,0 +1,218 @@
+// dear imgui: headless tests for internal helpers
+// - Window display and focus order (g.WindowsDisplayOrder, g.WindowsFocusOrder, g.Windows[]) with 10k windows: random FocusWindow()/BringWindowToDisplayXXX() calls,
+//   roots appearing/disappearing and child windows submitted in varying order. g.Windows[] must match a full sort of the windows (children after their parent,
+//   sorted with the same keys as ChildWindowComparer()), and root windows must follow the requested order. Prints timings.
+
+#include "imgui_tests.h"
+#include <stdio.h>
+
+static const int GWindowsOrderTestRootsCount = 2500;    // Each root has 3 child windows (one nested): 10000 windows
+static const int GWindowsOrderTestOpsPerFrame = 200;
+
+struct WindowsOrderTestState
+{
+    ImVector<ImGuiWindow*>  Roots;                      // Root windows, in expected display order (back to front)
+    ImGuiWindow*            LastFocused;
+    unsigned int            Seed;
+};
+
+static int WindowsOrderTestRand(WindowsOrderTestState* state, int count)
+{
+    state->Seed = state->Seed * 1664525u + 1013904223u;
+    return (int)((state->Seed >> 8) % (unsigned int)count);
+}
+
+static void WindowsOrderTestSubmit(int frame, bool churn)
+{
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    for (int root_n = 0; root_n < GWindowsOrderTestRootsCount; root_n++)
+    {
+        char name[32];
+        ImFormatString(name, IM_ARRAYSIZE(name), "Root %d", root_n);
+        if (churn && (root_n + frame) % 7 == 0 && !(g.NavWindow && g.NavWindow == ImGui::FindWindowByName(name))) // Closing the focused window would focus another one
+            continue;
+        ImGui::SetNextWindowPos(ImVec2((float)(root_n % 50) * 38.0f, (float)(root_n / 50) * 21.0f));
+        ImGui::SetNextWindowSize(ImVec2(80.0f, 60.0f));
+        ImGui::Begin(name, NULL, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoFocusOnAppearing);
+        const bool swap = churn && (root_n + frame) % 5 == 0; // Change submission order of child windows
+        for (int n = 0; n < 2; n++)
+        {
+            if ((n == 0) != swap)
+            {
+                ImGui::BeginChild("a", ImVec2(30.0f, 20.0f));
+                ImGui::BeginChild("b", ImVec2(10.0f, 10.0f));
+                ImGui::EndChild();
+                ImGui::EndChild();
+            }
+            else
+            {
+                ImGui::BeginChild("c", ImVec2(30.0f, 20.0f));
+                ImGui::EndChild();
+            }
+        }
+        ImGui::End();
+    }
+}
+
+static void WindowsOrderTestMoveRoot(WindowsOrderTestState* state, ImGuiWindow* window, int dst_n)
+{
+    state->Roots.erase(state->Roots.find(window));
+    state->Roots.insert(state->Roots.Data + dst_n, window);
+}
+
+// Random reordering of root windows, applied to the expected order too. Return time spent in imgui functions.
+static ImU64 WindowsOrderTestReorder(WindowsOrderTestState* state)
+{
+    ImU64 duration = 0;
+    for (int op_n = 0; op_n < GWindowsOrderTestOpsPerFrame; op_n++)
+    {
+        ImGuiWindow* window = state->Roots[WindowsOrderTestRand(state, state->Roots.Size)];
+        ImGuiWindow* behind_window = state->Roots[WindowsOrderTestRand(state, state->Roots.Size)];
+        const int op = WindowsOrderTestRand(state, 4);
+        const ImU64 t0 = ImTimeGetMicroseconds();
+        if (op <= 1)
+            ImGui::FocusWindow(window);
+        else if (op == 2)
+            ImGui::BringWindowToDisplayBack(window);
+        else
+            ImGui::BringWindowToDisplayBehind(window, behind_window);
+        duration += ImTimeGetMicroseconds() - t0;
+        if (op <= 1)
+        {
+            WindowsOrderTestMoveRoot(state, window, state->Roots.Size - 1);
+            state->LastFocused = window;
+        }
+        else if (op == 2)
+        {
+            WindowsOrderTestMoveRoot(state, window, 0);
+        }
+        else if (window != behind_window)
+        {
+            state->Roots.erase(state->Roots.find(window));
+            state->Roots.insert(state->Roots.find(behind_window), window);
+        }
+    }
+    return duration;
+}
+
+static int IMGUI_CDECL WindowsOrderTestChildComparer(const void* lhs, const void* rhs)
+{
+    const ImGuiWindow* const a = *(const ImGuiWindow* const*)lhs;
+    const ImGuiWindow* const b = *(const ImGuiWindow* const*)rhs;
+    if (int d = (a->Flags & ImGuiWindowFlags_Popup) - (b->Flags & ImGuiWindowFlags_Popup))
+        return d;
+    if (int d = (a->Flags & ImGuiWindowFlags_Tooltip) - (b->Flags & ImGuiWindowFlags_Tooltip))
+        return d;
+    return a->BeginOrderWithinParent - b->BeginOrderWithinParent;
+}
+
+// Full sort: each window not being an active child window, followed by its active child windows (recursively)
+static void WindowsOrderTestAddWindow(ImVector<ImGuiWindow*>* out, ImGuiWindow* window)
+{
+    out->push_back(window);
+    if (!window->Active)
+        return;
+    ImVector<ImGuiWindow*> children = window->DC.ChildWindows;
+    ImQsort(children.Data, (size_t)children.Size, sizeof(ImGuiWindow*), WindowsOrderTestChildComparer);
+    for (ImGuiWindow* child : children)
+        if (child->Active)
+            WindowsOrderTestAddWindow(out, child);
+}
+
+static void WindowsOrderTestCheck(const WindowsOrderTestState* state)
+{
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+
+    // Lists and g.Windows[] are consistent
+    IM_CHECK(g.WindowsDisplayOrder.Size == g.Windows.Size);
+    int n = 0;
+    ImGuiWindow* prev = NULL;
+    for (ImGuiWindow* window = g.WindowsDisplayOrder.GetFirst(); window != NULL && n < g.Windows.Size; window = g.WindowsDisplayOrder.GetNext(window), n++)
+    {
+        IM_CHECK(window == g.Windows[n] && g.WindowsDisplayOrder.GetPrev(window) == prev);
+        prev = window;
+    }
+    IM_CHECK(n == g.Windows.Size && prev == g.WindowsDisplayOrder.GetLast());
+    n = 0;
+    prev = NULL;
+    for (ImGuiWindow* window = g.WindowsFocusOrder.GetFirst(); window != NULL && n <= g.Windows.Size; window = g.WindowsFocusOrder.GetNext(window), n++)
+    {
+        IM_CHECK(window->RootWindow == window && g.WindowsFocusOrder.GetPrev(window) == prev);
+        prev = window;
+    }
+    IM_CHECK(n == g.WindowsFocusOrder.Size && prev == g.WindowsFocusOrder.GetLast());
+    for (ImGuiWindow* window : g.Windows)
+        IM_CHECK(g.WindowsDisplayOrder.Contains(window) && g.WindowsFocusOrder.Contains(window) == !window->IsExplicitChild);
+    if (state->LastFocused != NULL)
+        IM_CHECK(g.WindowsFocusOrder.GetLast() == state->LastFocused);
+
+    // Same order as a full sort
+    ImVector<ImGuiWindow*> sorted;
+    for (ImGuiWindow* window : g.Windows)
+        if (!window->Active || !(window->Flags & ImGuiWindowFlags_ChildWindow))
+            WindowsOrderTestAddWindow(&sorted, window);
+    IM_CHECK(sorted.Size == g.Windows.Size);
+    if (sorted.Size == g.Windows.Size)
+        IM_CHECK(memcmp(sorted.Data, g.Windows.Data, (size_t)sorted.size_in_bytes()) == 0);
+
+    // Root windows in requested order
+    ImVector<ImGuiWindow*> roots;
+    for (ImGuiWindow* window : g.Windows)
+        if (!(window->Flags & ImGuiWindowFlags_ChildWindow))
+            roots.push_back(window);
+    IM_CHECK(roots.Size == state->Roots.Size);
+    if (roots.Size == state->Roots.Size)
+        IM_CHECK(memcmp(roots.Data, state->Roots.Data, (size_t)roots.size_in_bytes()) == 0);
+}
+
+void Test_WindowsOrder()
+{
+    ImGuiContext* ctx = ImGui::CreateContext();
+    ImGuiContext& g = *ctx;
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+    io.Fonts->AddFontDefault();
+
+    WindowsOrderTestState state;
+    state.LastFocused = NULL;
+    state.Seed = 0x12345678;
+
+    // Create windows
+    ImGui::NewFrame();
+    WindowsOrderTestSubmit(0, false);
+    ImGui::Render();
+    ImGuiTests_AckTextures();
+    IM_CHECK(g.Windows.Size > GWindowsOrderTestRootsCount * 4);
+    for (ImGuiWindow* window : g.Windows)
+        if (!(window->Flags & ImGuiWindowFlags_ChildWindow))
+            state.Roots.push_back(window);
+    WindowsOrderTestCheck(&state);
+
+    // Steady state, then random reordering, then reordering with windows appearing/disappearing and child windows changing order
+    const char* phase_names[] = { "steady", "reorder", "reorder+churn" };
+    const int frames_count = 8;
+    for (int phase = 0; phase < 3; phase++)
+    {
+        ImU64 reorder_duration = 0;
+        ImU64 end_frame_duration = 0;
+        for (int frame = 1; frame <= frames_count; frame++)
+        {
+            ImGui::NewFrame();
+            if (phase > 0)
+                reorder_duration += WindowsOrderTestReorder(&state);
+            WindowsOrderTestSubmit(frame, phase == 2);
+            const ImU64 t0 = ImTimeGetMicroseconds();
+            ImGui::EndFrame();
+            end_frame_duration += ImTimeGetMicroseconds() - t0;
+            ImGui::Render();
+            ImGuiTests_AckTextures();
+            WindowsOrderTestCheck(&state);
+        }
+        printf("  WindowsOrder: %d windows, %-13s: %.3f us per FocusWindow()/BringWindowToDisplayXXX(), %.1f us per EndFrame()\n",
+            g.Windows.Size, phase_names[phase], (phase > 0) ? (double)reorder_duration / (frames_count * GWindowsOrderTestOpsPerFrame) : 0.0, (double)end_frame_duration / frames_count);
+    }
+    ImGui::DestroyContext(ctx);
+}